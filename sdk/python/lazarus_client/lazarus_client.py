@@ -8,7 +8,7 @@
 # ****************************************************
 
 import requests
-from typing import Any
+from typing import Any, Iterator, Optional
 from .pandora_client_error import PandoraDBClientError
 
 # Python client for the PandoraDB.
@@ -24,12 +24,40 @@ class PandoraDBClient:
     OBJECT_ENDPOINT: str = "object_endpoint/"
     # Ping endpoint path.
     PING_ENDPOINT: str = "ping_endpoint/"
+    # Administration endpoint path.
+    ADMIN_ENDPOINT: str = "admin_endpoint/"
+    # Log level path, relative to the administration endpoint.
+    LOG_LEVEL_PATH: str = "log_level"
+    # Storage engine statistics path, relative to the administration endpoint.
+    ENGINE_STATISTICS_PATH: str = "engine_statistics"
+    # Data partition list string literal for storage engine statistics responses.
+    PARTITIONS_STRING: str = "partitions"
+    # Log subsystem string literal for log level requests.
+    LOG_SUBSYSTEM_STRING: str = "log_subsystem"
+    # Log level string literal for log level requests.
+    LOG_LEVEL_STRING: str = "log_level"
     # Container name string literal for requests and responses.
     CONTAINER_NAME_STRING: str = "container_name"
     # Object ID string literal for requests and responses.
     OBJECT_ID_STRING: str = "object_id"
     # Object data string literal for requests and responses.
     OBJECT_DATA_STRING: str = "object_data"
+    # Object list string literal for scan responses.
+    OBJECTS_STRING: str = "objects"
+    # Continuation token string literal for scan requests and responses.
+    CONTINUATION_TOKEN_STRING: str = "continuation_token"
+    # Maximum number of objects string literal for scan requests.
+    MAX_NUMBER_OBJECTS_STRING: str = "max_number_objects"
+    # Object container scan path, relative to the object endpoint.
+    SCAN_PATH: str = "scan"
+    # Object batch path, relative to the object endpoint.
+    BATCH_PATH: str = "batch"
+    # Media type of the binary object transport.
+    BINARY_MEDIA_TYPE: str = "application/octet-stream"
+    # Response header carrying the internal status code in the binary transport.
+    INTERNAL_STATUS_CODE_HEADER: str = "x-pandora-internal-status-code"
+    # Request header with the number of milliseconds the client waits for an operation.
+    DEADLINE_HEADER: str = "x-pandora-deadline-ms"
 
     # Init method.
     def __init__(
@@ -42,6 +70,8 @@ class PandoraDBClient:
         self.base_url = f"http://{host}:{port}/pandora/network"
         self.timeout = timeout
         self.session = requests.Session()
+        # Let the server drop queued operations once the client has timed out on them.
+        self.session.headers[self.DEADLINE_HEADER] = str(int(timeout * 1000))
 
     # Sends a request to the PandoraDB server.
     # Returns the parsed response object on success, or
@@ -115,6 +145,60 @@ class PandoraDBClient:
                 self.host,
                 self.port) from None
 
+    # Sends an object request over the binary transport, where the object data
+    # travels as the raw body and the rest of the parameters as query parameters.
+    # Returns the raw response body on success, or yields PandoraDBClientError on failure.
+    def _binary_request(
+            self,
+            method: str,
+            container_name: str,
+            object_id: str,
+            data: bytes | None = None) -> bytes:
+        url = f"{self.base_url}/{self.OBJECT_ENDPOINT}"
+        headers = {"Accept": self.BINARY_MEDIA_TYPE}
+        if data is not None:
+            headers["Content-Type"] = self.BINARY_MEDIA_TYPE
+        try:
+            response = self.session.request(
+                method,
+                url,
+                timeout=self.timeout,
+                params={
+                    self.CONTAINER_NAME_STRING: container_name,
+                    self.OBJECT_ID_STRING: object_id
+                },
+                headers=headers,
+                data=data)
+        except requests.exceptions.RequestException:
+            # This indicates a failure with the request processing.
+            raise PandoraDBClientError(
+                None,
+                None,
+                "Failed to send the request to PandoraDB.",
+                self.host,
+                self.port) from None
+        try:
+            internal_status_code = int(
+                response.headers[self.INTERNAL_STATUS_CODE_HEADER],
+                base=0)
+        except (ValueError, KeyError):
+            # This situation is not expected since the server should
+            # always reply back with the internal status code header.
+            raise PandoraDBClientError(
+                response.status_code,
+                None,
+                "Failed to parse the binary response from PandoraDB.",
+                self.host,
+                self.port) from None
+        if internal_status_code != self.SUCCESS_INTERNAL_STATUS_CODE:
+            raise PandoraDBClientError(
+                response.status_code,
+                internal_status_code,
+                "PandoraDB returned an error.",
+                self.host,
+                self.port) from None
+        return response.content
+
     # ------------------------
     # Container operations.
     # ------------------------
@@ -157,6 +241,19 @@ class PandoraDBClient:
             self.OBJECT_ENDPOINT,
             json=payload)
 
+    # Executes an insert operation for an object over the binary transport.
+    # The data can hold arbitrary bytes. Yields PandoraDBClientError on failure.
+    def insert_object_bytes(
+            self,
+            container_name: str,
+            object_id: str,
+            data: bytes) -> None:
+        self._binary_request(
+            "POST",
+            container_name,
+            object_id,
+            data)
+
     # Executes a remove operation for an object.
     # Yields PandoraDBClientError on failure.
     def remove_object(
@@ -198,6 +295,139 @@ class PandoraDBClient:
                 self.port) from None
         return result[self.OBJECT_DATA_STRING]
 
+    # Executes a get operation for an object over the binary transport.
+    # Returns the raw bytes of the object on success,
+    # or yields PandoraDBClientError on failure.
+    def get_object_bytes(
+            self,
+            container_name: str,
+            object_id: str) -> bytes:
+        return self._binary_request(
+            "GET",
+            container_name,
+            object_id)
+
+    # Sends a batch request and returns the per-object results in request order.
+    # Every result is a dict with the object internal status code, plus the
+    # object data for successful gets. Yields PandoraDBClientError on failure.
+    def _batch_request(
+            self,
+            method: str,
+            container_name: str,
+            objects: list[dict[str, str]]) -> list[dict[str, Any]]:
+        payload = {
+            self.CONTAINER_NAME_STRING: container_name,
+            self.OBJECTS_STRING: objects
+        }
+        result = self._request(
+            method,
+            self.OBJECT_ENDPOINT + self.BATCH_PATH,
+            json=payload)
+        if not isinstance(result, dict) or self.OBJECTS_STRING not in result:
+            raise PandoraDBClientError(
+                None,
+                None,
+                f"Response from PandoraDB is missing the '{self.OBJECTS_STRING}' field.",
+                self.host,
+                self.port) from None
+        return [
+            {
+                self.INTERNAL_STATUS_CODE_RESPONSE_STRING: int(
+                    entry[self.INTERNAL_STATUS_CODE_RESPONSE_STRING],
+                    base=0),
+                **({self.OBJECT_DATA_STRING: entry[self.OBJECT_DATA_STRING]}
+                   if self.OBJECT_DATA_STRING in entry else {})
+            }
+            for entry in result[self.OBJECTS_STRING]
+        ]
+
+    # Executes an insert operation for a batch of objects.
+    # Returns the internal status code of every object in request order.
+    # Yields PandoraDBClientError if the batch as a whole fails.
+    def insert_objects(
+            self,
+            container_name: str,
+            objects: dict[str, str]) -> list[int]:
+        results = self._batch_request(
+            "POST",
+            container_name,
+            [{self.OBJECT_ID_STRING: object_id, self.OBJECT_DATA_STRING: data}
+             for object_id, data in objects.items()])
+        return [entry[self.INTERNAL_STATUS_CODE_RESPONSE_STRING] for entry in results]
+
+    # Executes a remove operation for a batch of objects.
+    # Returns the internal status code of every object in request order.
+    # Yields PandoraDBClientError if the batch as a whole fails.
+    def remove_objects(
+            self,
+            container_name: str,
+            object_ids: list[str]) -> list[int]:
+        results = self._batch_request(
+            "DELETE",
+            container_name,
+            [{self.OBJECT_ID_STRING: object_id} for object_id in object_ids])
+        return [entry[self.INTERNAL_STATUS_CODE_RESPONSE_STRING] for entry in results]
+
+    # Executes a get operation for a batch of objects.
+    # Returns the value of every object in request order, or None for
+    # the objects which failed. Yields PandoraDBClientError if the batch as a whole fails.
+    def get_objects(
+            self,
+            container_name: str,
+            object_ids: list[str]) -> list[str | None]:
+        results = self._batch_request(
+            "GET",
+            container_name,
+            [{self.OBJECT_ID_STRING: object_id} for object_id in object_ids])
+        return [entry.get(self.OBJECT_DATA_STRING) for entry in results]
+
+    # Executes a single page of an object container scan.
+    # Returns the (object_id, object_data) pairs of the page in key order along
+    # with the continuation token for the next page, which is empty once the scan
+    # is complete. Yields PandoraDBClientError on failure.
+    def scan_objects(
+            self,
+            container_name: str,
+            continuation_token: str = "",
+            max_number_objects: int = 0) -> tuple[list[tuple[str, str]], str]:
+        payload = {
+            self.CONTAINER_NAME_STRING: container_name,
+            self.CONTINUATION_TOKEN_STRING: continuation_token,
+            self.MAX_NUMBER_OBJECTS_STRING: max_number_objects
+        }
+        result = self._request(
+            "GET",
+            self.OBJECT_ENDPOINT + self.SCAN_PATH,
+            json=payload)
+        if not isinstance(result, dict) or self.OBJECTS_STRING not in result:
+            raise PandoraDBClientError(
+                None,
+                None,
+                f"Response from PandoraDB is missing the '{self.OBJECTS_STRING}' field.",
+                self.host,
+                self.port) from None
+        objects = [
+            (entry[self.OBJECT_ID_STRING], entry[self.OBJECT_DATA_STRING])
+            for entry in result[self.OBJECTS_STRING]
+        ]
+        return objects, result.get(self.CONTINUATION_TOKEN_STRING, "")
+
+    # Iterates over all objects of a container in key order,
+    # fetching the pages lazily. Yields PandoraDBClientError on failure.
+    def scan_all_objects(
+            self,
+            container_name: str,
+            page_max_number_objects: int = 0) -> Iterator[tuple[str, str]]:
+        continuation_token = ""
+        while True:
+            objects, continuation_token = self.scan_objects(
+                container_name,
+                continuation_token,
+                page_max_number_objects)
+            yield from objects
+            if not continuation_token:
+                return
+
     # ------------------------
     # Service operations.
     # ------------------------
@@ -210,4 +440,30 @@ class PandoraDBClient:
                 self.PING_ENDPOINT)
             return True
         except PandoraDBClientError:
-            return False
\ No newline at end of file
+            return False
+
+    # Changes the log level of a server subsystem at runtime, such as 'cache' or 'io',
+    # or of all subsystems if none is given. Levels are 'trace', 'debug', 'info',
+    # 'warn', 'error', 'critical' and 'off'.
+    # Yields PandoraDBClientError on failure.
+    def set_log_level(
+            self,
+            log_level: str,
+            log_subsystem: Optional[str] = None) -> None:
+        request_body = {self.LOG_LEVEL_STRING: log_level}
+        if log_subsystem is not None:
+            request_body[self.LOG_SUBSYSTEM_STRING] = log_subsystem
+        self._request(
+            "PUT",
+            self.ADMIN_ENDPOINT + self.LOG_LEVEL_PATH,
+            json=request_body)
+
+    # Gets the storage engine statistics of every data partition, including the
+    # engine properties of every object container, and the tickers and histograms
+    # of the partition if statistics are enabled on the server.
+    # Yields PandoraDBClientError on failure.
+    def get_engine_statistics(self) -> list[dict[str, Any]]:
+        result = self._request(
+            "GET",
+            self.ADMIN_ENDPOINT + self.ENGINE_STATISTICS_PATH)
+        return result[self.PARTITIONS_STRING]
@@ -131,6 +131,45 @@ class PandoraDBStatusCode(Enum):
     # Unexpected null engine reference.
     null_storage_engine_reference = 0x80000026
 
+    # Object rejected by the frontline cache admission filter.
+    cache_admission_rejected = 0x80000027
+
+    # Frontline cache fill dropped since the object was modified after it was read.
+    cache_fill_superseded = 0x80000028
+
+    # The configured number of collocations does not match the persisted topology of the data store.
+    collocation_topology_mismatch = 0x80000029
+
+    # Failed to read or persist the collocation topology marker.
+    collocation_topology_marker_failed = 0x8000002a
+
+    # Failed to redistribute the objects between data partitions.
+    collocation_resharding_failed = 0x8000002b
+
+    # The provided continuation token for the container scan is malformed.
+    invalid_continuation_token = 0x8000002c
+
+    # Object batch request contains no objects.
+    object_batch_empty = 0x8000002d
+
+    # Object batch request exceeds the maximum number of objects.
+    object_batch_size_exceeds_limit = 0x8000002e
+
+    # Invalid log level or log subsystem.
+    invalid_log_level = 0x8000002f
+
+    # Write IO queue of the collocation is at capacity. The operation can be retried later.
+    write_io_queue_full = 0x80000030
+
+    # Request deadline expired before the operation was executed, so it was dropped.
+    deadline_exceeded = 0x80000031
+
+    # Object does not exist in the specified object container.
+    object_not_found = 0x80000032
+
+    # Object data is not valid UTF-8, so it cannot be returned as JSON. Use the application/octet-stream transport.
+    object_data_not_json_representable = 0x80000033
+
     @classmethod
     def from_code(cls, code: int):
         for s in cls:
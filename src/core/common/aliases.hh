@@ -14,9 +14,12 @@
 
 #pragma once
 
+#include <memory>
 #include <cstdint>
 #include <functional>
 #include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
+#include <rocksdb/iterator.h>
 #include <drogon/drogon.h>
 #include "../logger/logging.hh"
 
@@ -34,8 +37,8 @@ using exit_code = std::int32_t;
 namespace network
 {
 using server_response_callback = std::function<void(const drogon::HttpResponsePtr&)>;
-using response_fields = std::unordered_map<const char*, std::string*>;
 using http_request = drogon::HttpRequestPtr;
+using server_response_stream = drogon::ResponseStreamPtr;
 }
 
 //
@@ -45,8 +48,11 @@ namespace storage
 {
 using byte = char;
 using byte_stream = std::string;
+using shared_byte_stream = std::shared_ptr<const byte_stream>;
 using storage_engine_reference = rocksdb::ColumnFamilyHandle;
 using storage_engine_write_batch = rocksdb::WriteBatch;
+using storage_engine_iterator = rocksdb::Iterator;
+using pinned_byte_stream = rocksdb::PinnableSlice;
 }
 
 } // namespace pandora.
\ No newline at end of file
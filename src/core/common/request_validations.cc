@@ -69,7 +69,7 @@ validate_object_id(
 
 status::status_code
 validate_object_data(
-    const storage::byte_stream& object_data,
+    std::string_view object_data,
     const storage::storage_configuration& storage_configuration)
 {
     if (object_data.empty())
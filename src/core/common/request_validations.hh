@@ -15,6 +15,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "aliases.hh"
 #include "../status/status.hh"
 #include "../storage/storage_configuration.hh"
@@ -43,7 +44,7 @@ validate_object_id(
 //
 status::status_code
 validate_object_data(
-    const storage::byte_stream& object_data,
+    std::string_view object_data,
     const storage::storage_configuration& storage_configuration);
 
 } // namespace pandora::common::request_validations.
\ No newline at end of file
@@ -12,30 +12,371 @@
 //     Helper functions for server responses.
 // ****************************************************
 
-#include <format>
-#include "nlohmann/json.hpp"
+#include <bit>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
 #include "response_utilities.hh"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace pandora::common::response_utilities
 {
 
+namespace
+{
+
+//
+// Prefix of every server JSON response up to the internal status code value.
+//
+constexpr std::string_view k_internal_status_code_prefix = "{\"internal_status_code\":\"";
+
+//
+// Determines whether a byte can be copied into a JSON string as-is.
+// Non-ASCII bytes are excluded since they need to be validated as UTF-8 first.
+//
+constexpr
+bool
+is_plain_byte(
+    const unsigned char byte)
+{
+    return byte >= 0x20u &&
+        byte < 0x80u &&
+        byte != '"' &&
+        byte != '\\';
+}
+
+//
+// Gets the length of the leading run of plain bytes of the given data.
+// With SSE2, sixteen bytes are classified per step, which covers
+// the common case of object data without characters to escape.
+//
+std::size_t
+get_plain_prefix_length(
+    const char* data,
+    const std::size_t size)
+{
+    std::size_t offset = 0u;
+
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i first_printable = _mm_set1_epi8(0x20);
+
+    for (; offset + sizeof(__m128i) <= size; offset += sizeof(__m128i))
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+
+        //
+        // The signed comparison flags control characters as well as
+        // non-ASCII bytes, which are negative as signed bytes.
+        //
+        const __m128i special_bytes = _mm_or_si128(
+            _mm_cmplt_epi8(chunk, first_printable),
+            _mm_or_si128(
+                _mm_cmpeq_epi8(chunk, quote),
+                _mm_cmpeq_epi8(chunk, backslash)));
+
+        const std::uint32_t special_bytes_mask = static_cast<std::uint32_t>(_mm_movemask_epi8(special_bytes));
+
+        if (special_bytes_mask != 0u)
+        {
+            return offset + static_cast<std::size_t>(std::countr_zero(special_bytes_mask));
+        }
+    }
+#endif
+
+    while (offset < size &&
+        is_plain_byte(static_cast<unsigned char>(data[offset])))
+    {
+        ++offset;
+    }
+
+    return offset;
+}
+
+//
+// Validates the UTF-8 sequence starting at the given non-ASCII lead byte.
+// Returns the number of bytes consumed and whether they form a valid sequence.
+//
+std::pair<std::size_t, bool>
+validate_utf8_sequence(
+    const unsigned char* data,
+    const std::size_t size)
+{
+    const unsigned char lead_byte = data[0];
+    std::size_t sequence_length = 0u;
+    unsigned char lower_bound = 0x80u;
+    unsigned char upper_bound = 0xbfu;
+
+    if (lead_byte >= 0xc2u && lead_byte <= 0xdfu)
+    {
+        sequence_length = 2u;
+    }
+    else if (lead_byte >= 0xe0u && lead_byte <= 0xefu)
+    {
+        //
+        // Reject overlong encodings and UTF-16 surrogates.
+        //
+        sequence_length = 3u;
+        lower_bound = lead_byte == 0xe0u ? 0xa0u : lower_bound;
+        upper_bound = lead_byte == 0xedu ? 0x9fu : upper_bound;
+    }
+    else if (lead_byte >= 0xf0u && lead_byte <= 0xf4u)
+    {
+        //
+        // Reject overlong encodings and code points beyond U+10FFFF.
+        //
+        sequence_length = 4u;
+        lower_bound = lead_byte == 0xf0u ? 0x90u : lower_bound;
+        upper_bound = lead_byte == 0xf4u ? 0x8fu : upper_bound;
+    }
+    else
+    {
+        return {1u, false};
+    }
+
+    for (std::size_t index = 1u; index < sequence_length; ++index)
+    {
+        if (index >= size ||
+            data[index] < lower_bound ||
+            data[index] > upper_bound)
+        {
+            return {index, false};
+        }
+
+        lower_bound = 0x80u;
+        upper_bound = 0xbfu;
+    }
+
+    return {sequence_length, true};
+}
+
+//
+// Appends the JSON escape sequence for an ASCII byte which is not plain.
+//
+void
+append_escaped_byte(
+    std::string& buffer,
+    const unsigned char byte)
+{
+    switch (byte)
+    {
+        case '"':
+            buffer += "\\\"";
+            return;
+        case '\\':
+            buffer += "\\\\";
+            return;
+        case '\b':
+            buffer += "\\b";
+            return;
+        case '\f':
+            buffer += "\\f";
+            return;
+        case '\n':
+            buffer += "\\n";
+            return;
+        case '\r':
+            buffer += "\\r";
+            return;
+        case '\t':
+            buffer += "\\t";
+            return;
+        default:
+            break;
+    }
+
+    constexpr char k_hex_digits[] = "0123456789abcdef";
+    const char escape_sequence[] = {
+        '\\',
+        'u',
+        '0',
+        '0',
+        k_hex_digits[byte >> 4u],
+        k_hex_digits[byte & 0xfu]};
+
+    buffer.append(
+        escape_sequence,
+        sizeof(escape_sequence));
+}
+
+} // namespace.
+
 std::string
 generate_server_json_response(
-    const std::uint32_t internal_status_code,
-    network::response_fields* response_fields)
+    const status::status_code& status,
+    std::initializer_list<response_field> response_fields)
+{
+    //
+    // Size the buffer for the whole response upfront,
+    // so that it is built with a single allocation unless values need escaping.
+    //
+    std::size_t response_size_bytes = k_internal_status_code_prefix.size() +
+        status.get_internal_status_code_string().size() + 2u;
+
+    for (const response_field& response_field : response_fields)
+    {
+        response_size_bytes += response_field.key_.size() + response_field.value_.size() + 6u;
+    }
+
+    std::string response_body;
+    response_body.reserve(response_size_bytes);
+
+    if (!append_server_json_response(
+        response_body,
+        status,
+        response_fields))
+    {
+        //
+        // Callers check the values upfront; should one slip through,
+        // the client is told rather than handed a corrupted value.
+        //
+        append_server_json_response(
+            response_body,
+            status::object_data_not_json_representable);
+    }
+
+    return response_body;
+}
+
+bool
+append_server_json_response(
+    std::string& buffer,
+    const status::status_code& status,
+    std::initializer_list<response_field> response_fields)
+{
+    const std::size_t initial_size = buffer.size();
+    buffer += k_internal_status_code_prefix;
+    buffer += status.get_internal_status_code_string();
+    buffer += '"';
+
+    for (const response_field& response_field : response_fields)
+    {
+        buffer += ",\"";
+        buffer += response_field.key_;
+        buffer += "\":";
+
+        if (!append_json_string(
+            buffer,
+            response_field.value_))
+        {
+            buffer.resize(initial_size);
+
+            return false;
+        }
+    }
+
+    buffer += '}';
+
+    return true;
+}
+
+bool
+append_json_string(
+    std::string& buffer,
+    std::string_view value)
 {
-    nlohmann::json response_body;
-    response_body["internal_status_code"] = std::format("{:#x}", internal_status_code);
+    const std::size_t initial_size = buffer.size();
+    buffer.reserve(buffer.size() + value.size() + 2u);
+    buffer += '"';
+
+    const char* data = value.data();
+    const std::size_t size = value.size();
+    std::size_t offset = 0u;
 
-    if (response_fields != nullptr)
+    while (offset < size)
     {
-        for (auto& [key, value] : *response_fields)
+        //
+        // Copy the run of bytes which need no escaping in one go.
+        //
+        const std::size_t plain_prefix_length = get_plain_prefix_length(
+            data + offset,
+            size - offset);
+        buffer.append(
+            data + offset,
+            plain_prefix_length);
+        offset += plain_prefix_length;
+
+        if (offset == size)
         {
-            response_body[key] = *value;
+            break;
         }
+
+        const unsigned char byte = static_cast<unsigned char>(data[offset]);
+
+        if (byte < 0x80u)
+        {
+            append_escaped_byte(
+                buffer,
+                byte);
+            ++offset;
+
+            continue;
+        }
+
+        const auto [sequence_length, is_valid_sequence] = validate_utf8_sequence(
+            reinterpret_cast<const unsigned char*>(data + offset),
+            size - offset);
+
+        if (!is_valid_sequence)
+        {
+            buffer.resize(initial_size);
+
+            return false;
+        }
+
+        buffer.append(
+            data + offset,
+            sequence_length);
+        offset += sequence_length;
+    }
+
+    buffer += '"';
+
+    return true;
+}
+
+bool
+is_json_representable(
+    std::string_view value)
+{
+    const char* data = value.data();
+    const std::size_t size = value.size();
+    std::size_t offset = 0u;
+
+    while (offset < size)
+    {
+        //
+        // Skip the runs of ASCII bytes, which are always representable,
+        // and validate the multi-byte sequences in between.
+        //
+        if (static_cast<unsigned char>(data[offset]) < 0x80u)
+        {
+            offset += std::max<std::size_t>(
+                get_plain_prefix_length(
+                    data + offset,
+                    size - offset),
+                1u);
+
+            continue;
+        }
+
+        const auto [sequence_length, is_valid_sequence] = validate_utf8_sequence(
+            reinterpret_cast<const unsigned char*>(data + offset),
+            size - offset);
+
+        if (!is_valid_sequence)
+        {
+            return false;
+        }
+
+        offset += sequence_length;
     }
 
-    return response_body.dump();
+    return true;
 }
 
-} // namespace pandora::common::response_utilities.
\ No newline at end of file
+} // namespace pandora::common::response_utilities.
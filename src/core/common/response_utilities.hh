@@ -15,21 +15,64 @@
 #pragma once
 
 #include <string>
-#include <cstdint>
-#include "aliases.hh"
-#include <unordered_map>
+#include <string_view>
+#include <initializer_list>
+#include "../status/status.hh"
 
 namespace pandora::common::response_utilities
 {
 
+//
+// Field of a server JSON response.
+// The key must be one of the constant tags of the request interfaces,
+// as it is written as-is; only the value gets escaped.
+//
+struct response_field
+{
+    std::string_view key_;
+    std::string_view value_;
+};
+
 //
 // Generates a server response in JSON
 // format to be sent back to the client.
-// Expects that the response fields given are references with a valid lifetime.
+// The internal status code always goes first, followed by the given fields,
+// whose values must be JSON representable.
 //
 std::string
 generate_server_json_response(
-    const std::uint32_t internal_status_code,
-    network::response_fields* response_fields);
+    const status::status_code& status,
+    std::initializer_list<response_field> response_fields = {});
+
+//
+// Appends a server response in JSON format to the buffer.
+// Used for building the per-object entries of composite responses.
+// Returns false, leaving the buffer untouched, if a field value is not JSON representable.
+//
+bool
+append_server_json_response(
+    std::string& buffer,
+    const status::status_code& status,
+    std::initializer_list<response_field> response_fields = {});
+
+//
+// Appends the given value as a quoted and escaped JSON string to the buffer.
+// Used for incrementally building streamed responses without a JSON document.
+// Invalid UTF-8 is never replaced, as that would hand the client corrupted
+// data; instead false is returned and the buffer is left untouched.
+//
+bool
+append_json_string(
+    std::string& buffer,
+    std::string_view value);
+
+//
+// Determines whether the given value can be returned as a JSON string,
+// which is the case for valid UTF-8 only. Values stored over the binary
+// transport may not be, and are then only served over that transport.
+//
+bool
+is_json_representable(
+    std::string_view value);
 
-} // namespace pandora::common::response_utilities.
\ No newline at end of file
+} // namespace pandora::common::response_utilities.
@@ -16,6 +16,7 @@
 #include <format>
 #include <fstream>
 #include "system_configuration.hh"
+#include "../storage/io/collocation_topology.hh"
 
 namespace pandora
 {
@@ -114,6 +115,57 @@ system_configuration::load_logger_configuration(
 
     logger_configuration_.logging_session_directory_prefix_ =
         config_section.value("logging_session_directory_prefix", logger_configuration_.logging_session_directory_prefix_);
+
+    if (config_section.contains("log_level"))
+    {
+        const std::string log_level_name =
+            config_section.value("log_level", std::string{});
+        const std::optional<spdlog::level::level_enum> log_level =
+            logger::get_log_level_from_name(log_level_name);
+
+        if (!log_level.has_value())
+        {
+            throw std::runtime_error(std::format(
+                "Invalid log level in the configuration file. "
+                "Supported levels are 'trace', 'debug', 'info', 'warn', 'error', 'critical' and 'off'. "
+                "LogLevel={}.",
+                log_level_name));
+        }
+
+        logger_configuration_.log_level_ = log_level.value();
+    }
+
+    //
+    // Subsystem log levels are given as an object of subsystem names to level names.
+    //
+    const auto subsystem_log_levels = config_section.find("subsystem_log_levels");
+
+    if (subsystem_log_levels != config_section.end() &&
+        subsystem_log_levels->is_object())
+    {
+        for (const auto& [subsystem_name, log_level_value] : subsystem_log_levels->items())
+        {
+            const std::string log_level_name =
+                log_level_value.is_string() ? log_level_value.get<std::string>() : std::string{};
+            const std::optional<logger::log_subsystem> subsystem =
+                logger::get_log_subsystem_from_name(subsystem_name);
+            const std::optional<spdlog::level::level_enum> log_level =
+                logger::get_log_level_from_name(log_level_name);
+
+            if (!subsystem.has_value() ||
+                !log_level.has_value())
+            {
+                throw std::runtime_error(std::format(
+                    "Invalid subsystem log level in the configuration file. "
+                    "LogSubsystem={}, "
+                    "LogLevel={}.",
+                    subsystem_name,
+                    log_level_name));
+            }
+
+            logger_configuration_.subsystem_log_levels_[subsystem.value()] = log_level.value();
+        }
+    }
 }
 
 void
@@ -138,6 +190,23 @@ system_configuration::load_storage_configuration(
     storage_configuration_.max_number_containers_ =
         config_section.value("max_number_containers", storage_configuration_.max_number_containers_);
 
+    //
+    // Read into a wider type, so out of range values are rejected instead of wrapping around.
+    //
+    const std::int64_t number_collocations = config_section.value(
+        "number_collocations",
+        static_cast<std::int64_t>(storage_configuration_.number_collocations_));
+
+    if (!storage::collocation_topology::is_valid_number_collocations(number_collocations))
+    {
+        throw std::runtime_error(
+            "Invalid number of collocations in the configuration file. "
+            "It must be between 1 and " +
+            std::to_string(storage::collocation_topology::k_max_number_collocations) + ".");
+    }
+
+    storage_configuration_.number_collocations_ = static_cast<std::uint16_t>(number_collocations);
+
     storage_configuration_.number_write_io_threads_ =
         config_section.value("number_write_io_threads", storage_configuration_.number_write_io_threads_);
 
@@ -147,6 +216,34 @@ system_configuration::load_storage_configuration(
     storage_configuration_.storage_engine_block_cache_size_mib_ =
         config_section.value("storage_engine_block_cache_size_mib", storage_configuration_.storage_engine_block_cache_size_mib_);
 
+    storage_configuration_.storage_engine_hyper_clock_cache_enabled_ =
+        config_section.value("storage_engine_hyper_clock_cache_enabled", storage_configuration_.storage_engine_hyper_clock_cache_enabled_);
+
+    storage_configuration_.storage_engine_write_buffer_manager_size_mib_ =
+        config_section.value("storage_engine_write_buffer_manager_size_mib", storage_configuration_.storage_engine_write_buffer_manager_size_mib_);
+
+    if (config_section.contains("storage_engine_statistics_level"))
+    {
+        const std::string statistics_level_name =
+            config_section.value("storage_engine_statistics_level", std::string{});
+        const std::optional<storage::storage_engine_statistics_level> statistics_level =
+            storage::get_storage_engine_statistics_level_from_name(statistics_level_name);
+
+        if (!statistics_level.has_value())
+        {
+            throw std::runtime_error(std::format(
+                "Invalid storage engine statistics level in the configuration file. "
+                "Supported levels are 'disabled', 'except_histograms', 'except_detailed_timers' and 'all'. "
+                "StorageEngineStatisticsLevel={}.",
+                statistics_level_name));
+        }
+
+        storage_configuration_.storage_engine_statistics_level_ = statistics_level.value();
+    }
+
+    storage_configuration_.storage_engine_number_background_threads_ =
+        config_section.value("storage_engine_number_background_threads", storage_configuration_.storage_engine_number_background_threads_);
+
     storage_configuration_.container_index_number_buckets_ =
         config_section.value("container_index_number_buckets", storage_configuration_.container_index_number_buckets_);
 
@@ -158,6 +255,71 @@ system_configuration::load_storage_configuration(
 
     storage_configuration_.max_frontline_cache_shard_object_size_bytes =
         config_section.value("max_frontline_cache_shard_object_size_bytes", storage_configuration_.max_frontline_cache_shard_object_size_bytes);
+
+    if (config_section.contains("frontline_cache_eviction_policy"))
+    {
+        const std::string eviction_policy_name =
+            config_section.value("frontline_cache_eviction_policy", std::string{});
+        const std::optional<storage::cache_eviction_policy> eviction_policy =
+            storage::get_cache_eviction_policy_from_name(eviction_policy_name);
+
+        if (!eviction_policy.has_value())
+        {
+            throw std::runtime_error(std::format(
+                "Invalid frontline cache eviction policy in the configuration file. "
+                "Supported policies are 'lru' and 'clock'. "
+                "FrontlineCacheEvictionPolicy={}.",
+                eviction_policy_name));
+        }
+
+        storage_configuration_.frontline_cache_eviction_policy_ = eviction_policy.value();
+    }
+
+    storage_configuration_.frontline_cache_admission_enabled_ =
+        config_section.value("frontline_cache_admission_enabled", storage_configuration_.frontline_cache_admission_enabled_);
+
+    storage_configuration_.frontline_cache_max_number_negative_entries_ =
+        config_section.value("frontline_cache_max_number_negative_entries", storage_configuration_.frontline_cache_max_number_negative_entries_);
+
+    storage_configuration_.frontline_cache_negative_entry_ttl_ms_ =
+        config_section.value("frontline_cache_negative_entry_ttl_ms", storage_configuration_.frontline_cache_negative_entry_ttl_ms_);
+
+    storage_configuration_.write_io_batch_max_number_tasks_ =
+        config_section.value("write_io_batch_max_number_tasks", storage_configuration_.write_io_batch_max_number_tasks_);
+
+    storage_configuration_.write_io_batch_max_size_bytes_ =
+        config_section.value("write_io_batch_max_size_bytes", storage_configuration_.write_io_batch_max_size_bytes_);
+
+    storage_configuration_.write_io_batch_max_wait_time_us_ =
+        config_section.value("write_io_batch_max_wait_time_us", storage_configuration_.write_io_batch_max_wait_time_us_);
+
+    storage_configuration_.write_io_queue_max_number_tasks_ =
+        config_section.value("write_io_queue_max_number_tasks", storage_configuration_.write_io_queue_max_number_tasks_);
+
+    storage_configuration_.write_io_queue_max_size_bytes_ =
+        config_section.value("write_io_queue_max_size_bytes", storage_configuration_.write_io_queue_max_size_bytes_);
+
+    storage_configuration_.read_io_batch_max_number_tasks_ =
+        config_section.value("read_io_batch_max_number_tasks", storage_configuration_.read_io_batch_max_number_tasks_);
+
+    storage_configuration_.read_io_batch_max_wait_time_us_ =
+        config_section.value("read_io_batch_max_wait_time_us", storage_configuration_.read_io_batch_max_wait_time_us_);
+
+    storage_configuration_.container_scan_max_number_objects_ =
+        config_section.value("container_scan_max_number_objects", storage_configuration_.container_scan_max_number_objects_);
+
+    storage_configuration_.container_scan_max_page_size_bytes_ =
+        config_section.value("container_scan_max_page_size_bytes", storage_configuration_.container_scan_max_page_size_bytes_);
+
+    if (storage_configuration_.container_scan_max_number_objects_ == 0u)
+    {
+        throw std::runtime_error(
+            "Invalid container scan maximum number of objects in the configuration file. "
+            "At least one object per page is required.");
+    }
+
+    storage_configuration_.max_number_objects_per_batch_ =
+        config_section.value("max_number_objects_per_batch", storage_configuration_.max_number_objects_per_batch_);
 }
 
 void
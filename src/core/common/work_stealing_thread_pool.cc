@@ -0,0 +1,166 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Common
+// 'work_stealing_thread_pool.cc'
+// Author: jcjuarez
+// Description:
+//      Thread pool with per-worker task queues and
+//      work stealing between idle workers.
+// ****************************************************
+
+#include <pthread.h>
+#include <algorithm>
+#include "work_stealing_thread_pool.hh"
+
+namespace pandora::common
+{
+
+work_stealing_thread_pool::work_stealing_thread_pool(
+    const std::uint32_t number_threads,
+    const char* threads_name)
+    : number_threads_{std::max(number_threads, 1u)},
+      stop_requested_{false},
+      joined_{false}
+{
+    worker_queues_.reserve(number_threads_);
+    for (std::uint32_t worker_index = 0u; worker_index < number_threads_; ++worker_index)
+    {
+        worker_queues_.emplace_back(std::make_unique<worker_queue>());
+    }
+
+    //
+    // Workers are spawned only after all queues exist,
+    // given any worker can steal from any queue.
+    //
+    workers_.reserve(number_threads_);
+    for (std::uint32_t worker_index = 0u; worker_index < number_threads_; ++worker_index)
+    {
+        workers_.emplace_back(
+            [this, worker_index, threads_name]()
+            {
+                pthread_setname_np(pthread_self(), threads_name);
+                this->run_worker(worker_index);
+            });
+    }
+}
+
+work_stealing_thread_pool::~work_stealing_thread_pool()
+{
+    join();
+}
+
+bool
+work_stealing_thread_pool::post(
+    task&& task,
+    const std::uint32_t affinity_hint)
+{
+    //
+    // No worker is left to execute the task, so reject it rather than leaving it queued forever.
+    //
+    if (joined_.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    //
+    // The task must be visible in the queue before the
+    // semaphore is signaled so the woken worker can claim it.
+    //
+    worker_queues_[affinity_hint % number_threads_]->tasks_.enqueue(std::move(task));
+    pending_tasks_semaphore_.signal();
+
+    return true;
+}
+
+void
+work_stealing_thread_pool::join()
+{
+    stop_requested_.store(true, std::memory_order_release);
+
+    for (std::jthread& worker : workers_)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+
+    joined_.store(true, std::memory_order_release);
+}
+
+std::uint32_t
+work_stealing_thread_pool::get_num_threads() const
+{
+    return number_threads_;
+}
+
+bool
+work_stealing_thread_pool::has_pending_tasks() const
+{
+    return pending_tasks_semaphore_.availableApprox() > 0;
+}
+
+void
+work_stealing_thread_pool::run_worker(
+    const std::uint32_t worker_index)
+{
+    task task;
+
+    while (true)
+    {
+        //
+        // Acquiring the semaphore reserves exactly one posted task for this worker.
+        // On timeout, exit only if stopping and there is no pending work left behind.
+        //
+        if (!pending_tasks_semaphore_.wait(k_stop_check_interval_us))
+        {
+            if (stop_requested_.load(std::memory_order_acquire) &&
+                pending_tasks_semaphore_.availableApprox() == 0)
+            {
+                return;
+            }
+
+            continue;
+        }
+
+        //
+        // The reserved task may still be in flight between the producer's enqueue
+        // and this worker's view of the queues, so retry until it is claimed.
+        //
+        while (!try_dequeue_task(worker_index, task))
+        {
+            std::this_thread::yield();
+        }
+
+        task();
+        task = nullptr;
+    }
+}
+
+bool
+work_stealing_thread_pool::try_dequeue_task(
+    const std::uint32_t worker_index,
+    task& task)
+{
+    //
+    // Own queue first to preserve the affinity of the tasks,
+    // then steal from the rest of the workers in round-robin order.
+    //
+    for (std::uint32_t offset = 0u; offset < number_threads_; ++offset)
+    {
+        const std::uint32_t queue_index = (worker_index + offset) % number_threads_;
+        if (worker_queues_[queue_index]->tasks_.try_dequeue(task))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace pandora::common.
@@ -0,0 +1,150 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Common
+// 'work_stealing_thread_pool.hh'
+// Author: jcjuarez
+// Description:
+//      Thread pool with per-worker task queues and
+//      work stealing between idle workers.
+// ****************************************************
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+
+namespace pandora::common
+{
+
+class work_stealing_thread_pool
+{
+public:
+
+    //
+    // Unit of work to be executed by the thread pool.
+    //
+    using task = std::move_only_function<void()>;
+
+    //
+    // Constructor.
+    // Spawns the worker threads right away.
+    //
+    work_stealing_thread_pool(
+        const std::uint32_t number_threads,
+        const char* threads_name);
+
+    //
+    // Destructor.
+    // Waits for all pending tasks to be executed.
+    //
+    ~work_stealing_thread_pool();
+
+    //
+    // Posts a task into the thread pool. The affinity hint selects the
+    // worker queue the task lands on; idle workers can still steal it.
+    // Returns false without executing the task once the thread pool is joined.
+    // Tasks posted by other tasks while joining are still executed.
+    // This is a lock-free operation.
+    //
+    bool
+    post(
+        task&& task,
+        const std::uint32_t affinity_hint);
+
+    //
+    // Waits for all pending tasks to be executed and for
+    // the worker threads to finish execution in a blocking manner.
+    // Posting tasks from outside of the thread pool must not race with this call.
+    //
+    void
+    join();
+
+    //
+    // Gets the number of worker threads.
+    //
+    std::uint32_t
+    get_num_threads() const;
+
+    //
+    // Checks whether tasks are posted but not yet claimed by any worker.
+    // The result is approximate, as tasks may be posted or claimed concurrently.
+    //
+    bool
+    has_pending_tasks() const;
+
+private:
+
+    //
+    // Worker thread entry point.
+    //
+    void
+    run_worker(
+        const std::uint32_t worker_index);
+
+    //
+    // Tries to dequeue a task, first from the queue owned by the worker
+    // and then by stealing from the rest of the queues in round-robin order.
+    //
+    bool
+    try_dequeue_task(
+        const std::uint32_t worker_index,
+        task& task);
+
+    //
+    // Task queue owned by a single worker.
+    // Aligned to avoid false sharing between neighbouring queues.
+    //
+    struct alignas(64) worker_queue
+    {
+        moodycamel::ConcurrentQueue<task> tasks_;
+    };
+
+    //
+    // Interval on which idle workers check for stop requests.
+    //
+    static constexpr std::int64_t k_stop_check_interval_us = 100'000;
+
+    //
+    // Number of worker threads.
+    //
+    const std::uint32_t number_threads_;
+
+    //
+    // Per-worker task queues.
+    //
+    std::vector<std::unique_ptr<worker_queue>> worker_queues_;
+
+    //
+    // Semaphore counting the tasks posted but not yet claimed by any worker.
+    // A worker that acquires it is guaranteed to find a task in some queue.
+    //
+    moodycamel::LightweightSemaphore pending_tasks_semaphore_;
+
+    //
+    // Flag for signaling the workers to exit once all pending tasks are drained.
+    //
+    std::atomic<bool> stop_requested_;
+
+    //
+    // Flag for rejecting the tasks posted once the worker threads finished execution.
+    //
+    std::atomic<bool> joined_;
+
+    //
+    // Worker threads.
+    //
+    std::vector<std::jthread> workers_;
+};
+
+} // namespace pandora::common.
@@ -0,0 +1,123 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Logger
+// 'log_levels.cc'
+// Author: jcjuarez
+// Description:
+//      Compile-time and per-subsystem runtime
+//      log levels for gating log lines.
+// ****************************************************
+
+#include "log_levels.hh"
+
+namespace pandora
+{
+namespace logger
+{
+
+//
+// All subsystems log at the info level until configured otherwise.
+//
+std::array<std::atomic<std::uint8_t>, k_number_log_subsystems> log_levels::subsystem_levels_ = {
+    static_cast<std::uint8_t>(log_level::info),
+    static_cast<std::uint8_t>(log_level::info),
+    static_cast<std::uint8_t>(log_level::info),
+    static_cast<std::uint8_t>(log_level::info),
+    static_cast<std::uint8_t>(log_level::info),
+    static_cast<std::uint8_t>(log_level::info),
+    static_cast<std::uint8_t>(log_level::info)};
+
+std::optional<log_subsystem>
+get_log_subsystem_from_name(
+    std::string_view name)
+{
+    for (std::size_t index = 0u; index < k_log_subsystem_names.size(); ++index)
+    {
+        if (name == k_log_subsystem_names[index])
+        {
+            return static_cast<log_subsystem>(index);
+        }
+    }
+
+    return std::nullopt;
+}
+
+std::optional<spdlog::level::level_enum>
+get_log_level_from_name(
+    std::string_view name)
+{
+    if (name == "trace")
+    {
+        return log_level::trace;
+    }
+
+    if (name == "debug")
+    {
+        return log_level::debug;
+    }
+
+    if (name == "info")
+    {
+        return log_level::info;
+    }
+
+    if (name == "warn")
+    {
+        return log_level::warn;
+    }
+
+    if (name == "error")
+    {
+        return log_level::error;
+    }
+
+    if (name == "critical")
+    {
+        return log_level::critical;
+    }
+
+    if (name == "off")
+    {
+        return log_level::off;
+    }
+
+    return std::nullopt;
+}
+
+void
+log_levels::set_level(
+    const log_subsystem subsystem,
+    const spdlog::level::level_enum level)
+{
+    subsystem_levels_[static_cast<std::size_t>(subsystem)].store(
+        static_cast<std::uint8_t>(level),
+        std::memory_order_relaxed);
+}
+
+void
+log_levels::set_level(
+    const spdlog::level::level_enum level)
+{
+    for (std::atomic<std::uint8_t>& subsystem_level : subsystem_levels_)
+    {
+        subsystem_level.store(
+            static_cast<std::uint8_t>(level),
+            std::memory_order_relaxed);
+    }
+}
+
+spdlog::level::level_enum
+log_levels::get_level(
+    const log_subsystem subsystem)
+{
+    return static_cast<spdlog::level::level_enum>(
+        subsystem_levels_[static_cast<std::size_t>(subsystem)].load(std::memory_order_relaxed));
+}
+
+} // namespace logger.
+} // namespace pandora.
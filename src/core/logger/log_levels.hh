@@ -0,0 +1,238 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Logger
+// 'log_levels.hh'
+// Author: jcjuarez
+// Description:
+//      Compile-time and per-subsystem runtime
+//      log levels for gating log lines.
+// ****************************************************
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <spdlog/common.h>
+
+//
+// Minimum log level compiled into the system, as one of the SPDLOG_LEVEL_* values.
+// Log lines below it are discarded at compile time and never evaluate their arguments.
+//
+#ifndef PANDORA_MIN_LOG_LEVEL
+#define PANDORA_MIN_LOG_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+
+namespace pandora
+{
+namespace logger
+{
+
+//
+// Log levels by the names used in log lines.
+//
+namespace log_level
+{
+inline constexpr spdlog::level::level_enum trace = spdlog::level::trace;
+inline constexpr spdlog::level::level_enum debug = spdlog::level::debug;
+inline constexpr spdlog::level::level_enum info = spdlog::level::info;
+inline constexpr spdlog::level::level_enum warn = spdlog::level::warn;
+inline constexpr spdlog::level::level_enum error = spdlog::level::err;
+inline constexpr spdlog::level::level_enum critical = spdlog::level::critical;
+inline constexpr spdlog::level::level_enum off = spdlog::level::off;
+} // namespace log_level.
+
+//
+// Subsystems whose log levels can be adjusted independently.
+//
+enum class log_subsystem : std::uint8_t
+{
+    //
+    // Startup, configuration and shared utilities.
+    //
+    general = 0,
+
+    //
+    // Server, endpoints and request handlers.
+    //
+    network = 1,
+
+    //
+    // Object and container management services.
+    //
+    management = 2,
+
+    //
+    // IO dispatchers, executors and the storage engine.
+    //
+    io = 3,
+
+    //
+    // Frontline cache.
+    //
+    cache = 4,
+
+    //
+    // Container index.
+    //
+    index = 5,
+
+    //
+    // Garbage collector.
+    //
+    gc = 6
+};
+
+//
+// Number of log subsystems.
+//
+inline constexpr std::size_t k_number_log_subsystems = 7u;
+
+//
+// Names of the log subsystems, indexed by subsystem.
+//
+inline constexpr std::array<std::string_view, k_number_log_subsystems> k_log_subsystem_names = {
+    "general",
+    "network",
+    "management",
+    "io",
+    "cache",
+    "index",
+    "gc"};
+
+//
+// Gets the log subsystem of a source file from its path.
+// Only the part of the path under 'src/core/' is matched, so the
+// directory the repository is checked out in never affects the result.
+// Evaluated at compile time for every log line.
+//
+constexpr
+log_subsystem
+get_log_subsystem_from_path(
+    std::string_view source_file_path)
+{
+    constexpr std::string_view k_core_source_directory = "src/core/";
+    const std::size_t core_source_directory_offset = source_file_path.rfind(k_core_source_directory);
+
+    if (core_source_directory_offset == std::string_view::npos ||
+        (core_source_directory_offset > 0u && source_file_path[core_source_directory_offset - 1u] != '/'))
+    {
+        return log_subsystem::general;
+    }
+
+    const std::string_view core_source_file_path =
+        source_file_path.substr(core_source_directory_offset + k_core_source_directory.size());
+
+    if (core_source_file_path.starts_with("network/"))
+    {
+        return log_subsystem::network;
+    }
+
+    if (core_source_file_path.starts_with("storage/management/"))
+    {
+        return log_subsystem::management;
+    }
+
+    if (core_source_file_path.starts_with("storage/io/"))
+    {
+        return log_subsystem::io;
+    }
+
+    if (core_source_file_path.starts_with("storage/cache/"))
+    {
+        return log_subsystem::cache;
+    }
+
+    if (core_source_file_path.starts_with("storage/index/"))
+    {
+        return log_subsystem::index;
+    }
+
+    if (core_source_file_path.starts_with("storage/gc/"))
+    {
+        return log_subsystem::gc;
+    }
+
+    return log_subsystem::general;
+}
+
+//
+// Gets the log subsystem from its name.
+// Returns an empty optional if the name is not recognized.
+//
+std::optional<log_subsystem>
+get_log_subsystem_from_name(
+    std::string_view name);
+
+//
+// Gets the log level from its name, such as 'info' or 'warn'.
+// Returns an empty optional if the name is not recognized.
+//
+std::optional<spdlog::level::level_enum>
+get_log_level_from_name(
+    std::string_view name);
+
+//
+// Runtime log levels of every subsystem.
+// Levels can be changed at any time, and take effect on the next log line.
+//
+class log_levels
+{
+public:
+
+    //
+    // Determines whether log lines of the given level are enabled for a subsystem.
+    // A single relaxed load, so it is cheap enough to run before evaluating any log arguments.
+    //
+    static
+    bool
+    is_enabled(
+        const log_subsystem subsystem,
+        const spdlog::level::level_enum level)
+    {
+        return static_cast<std::uint8_t>(level) >=
+            subsystem_levels_[static_cast<std::size_t>(subsystem)].load(std::memory_order_relaxed);
+    }
+
+    //
+    // Sets the log level of a subsystem.
+    //
+    static
+    void
+    set_level(
+        const log_subsystem subsystem,
+        const spdlog::level::level_enum level);
+
+    //
+    // Sets the log level of all subsystems.
+    //
+    static
+    void
+    set_level(
+        const spdlog::level::level_enum level);
+
+    //
+    // Gets the log level of a subsystem.
+    //
+    static
+    spdlog::level::level_enum
+    get_level(
+        const log_subsystem subsystem);
+
+private:
+
+    //
+    // Current log level of every subsystem, indexed by subsystem.
+    //
+    static std::array<std::atomic<std::uint8_t>, k_number_log_subsystems> subsystem_levels_;
+};
+
+} // namespace logger.
+} // namespace pandora.
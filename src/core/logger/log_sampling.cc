@@ -0,0 +1,94 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Logger
+// 'log_sampling.cc'
+// Author: jcjuarez
+// Description:
+//      Sampling and rate limiting of log lines
+//      emitted at high frequency call sites.
+// ****************************************************
+
+#include <chrono>
+#include <algorithm>
+#include "log_sampling.hh"
+
+namespace pandora
+{
+namespace logger
+{
+
+//
+// Number of log lines suppressed across all call sites.
+//
+static std::atomic<std::uint64_t> number_suppressed_log_lines{0u};
+
+log_sampler::log_sampler(
+    const std::uint32_t sample_rate)
+    : sample_rate_{std::max<std::uint64_t>(sample_rate, 1u)},
+      number_log_lines_{0u}
+{}
+
+bool
+log_sampler::is_admitted()
+{
+    return number_log_lines_.fetch_add(1u, std::memory_order_relaxed) % sample_rate_ == 0u;
+}
+
+log_rate_limiter::log_rate_limiter(
+    const std::uint32_t max_log_lines_per_second)
+    : refill_interval_ns_{1'000'000'000u / std::max<std::uint64_t>(max_log_lines_per_second, 1u)},
+      bucket_full_time_ns_{0u}
+{}
+
+bool
+log_rate_limiter::is_admitted()
+{
+    constexpr std::uint64_t k_bucket_capacity_ns = 1'000'000'000u;
+    const std::uint64_t now_ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    std::uint64_t bucket_full_time_ns = bucket_full_time_ns_.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        //
+        // Taking a token pushes the time the bucket is full again by one refill interval.
+        // A token is only available if that time stays within a whole capacity from now.
+        //
+        const std::uint64_t next_bucket_full_time_ns =
+            std::max(bucket_full_time_ns, now_ns) + refill_interval_ns_;
+
+        if (next_bucket_full_time_ns - now_ns > k_bucket_capacity_ns)
+        {
+            return false;
+        }
+
+        if (bucket_full_time_ns_.compare_exchange_weak(
+                bucket_full_time_ns,
+                next_bucket_full_time_ns,
+                std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+}
+
+void
+record_suppressed_log_line()
+{
+    number_suppressed_log_lines.fetch_add(1u, std::memory_order_relaxed);
+}
+
+std::uint64_t
+get_number_suppressed_log_lines()
+{
+    return number_suppressed_log_lines.load(std::memory_order_relaxed);
+}
+
+} // namespace logger.
+} // namespace pandora.
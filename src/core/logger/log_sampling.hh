@@ -0,0 +1,107 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Logger
+// 'log_sampling.hh'
+// Author: jcjuarez
+// Description:
+//      Sampling and rate limiting of log lines
+//      emitted at high frequency call sites.
+// ****************************************************
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace pandora
+{
+namespace logger
+{
+
+//
+// Admits one out of every N log lines of a call site.
+//
+class log_sampler
+{
+public:
+
+    //
+    // Constructor. A sample rate of zero is treated as one.
+    //
+    log_sampler(
+        const std::uint32_t sample_rate);
+
+    //
+    // Determines whether the current log line is admitted.
+    // This is a lock-free operation.
+    //
+    bool
+    is_admitted();
+
+private:
+
+    //
+    // Number of log lines per admitted log line.
+    //
+    const std::uint64_t sample_rate_;
+
+    //
+    // Number of log lines seen by the call site.
+    //
+    std::atomic<std::uint64_t> number_log_lines_;
+};
+
+//
+// Admits log lines of a call site up to a rate, following a token bucket
+// which holds one second worth of log lines and refills continuously.
+//
+class log_rate_limiter
+{
+public:
+
+    //
+    // Constructor. A rate of zero is treated as one.
+    //
+    log_rate_limiter(
+        const std::uint32_t max_log_lines_per_second);
+
+    //
+    // Determines whether the current log line is admitted.
+    // This is a lock-free operation.
+    //
+    bool
+    is_admitted();
+
+private:
+
+    //
+    // Time it takes for the bucket to refill one token.
+    //
+    const std::uint64_t refill_interval_ns_;
+
+    //
+    // Time at which the bucket would be full again if no more log lines were admitted.
+    // Storing it instead of the tokens themselves keeps the bucket state in a single atomic.
+    //
+    std::atomic<std::uint64_t> bucket_full_time_ns_;
+};
+
+//
+// Counts a log line suppressed by sampling or rate limiting.
+//
+void
+record_suppressed_log_line();
+
+//
+// Gets the number of log lines suppressed by sampling or rate limiting since startup.
+//
+std::uint64_t
+get_number_suppressed_log_lines();
+
+} // namespace logger.
+} // namespace pandora.
@@ -15,6 +15,9 @@
 
 #pragma once
 
+#include <unordered_map>
+#include "log_levels.hh"
+
 namespace pandora
 {
 namespace logger
@@ -36,7 +39,8 @@ struct logger_configuration
           max_number_files_for_session_{100u},
           flush_frequency_ms_{1'000u},
           log_file_prefix_{"pandora_db.log"},
-          logging_session_directory_prefix_{"pandora-logs"}
+          logging_session_directory_prefix_{"pandora-logs"},
+          log_level_{log_level::info}
     {
         //
         // Set the logs path with the default home directory path.
@@ -93,6 +97,16 @@ struct logger_configuration
     // Session log directory prefix.
     //
     std::string logging_session_directory_prefix_;
+
+    //
+    // Log level for all subsystems without a dedicated log level.
+    //
+    spdlog::level::level_enum log_level_;
+
+    //
+    // Dedicated log levels for specific subsystems.
+    //
+    std::unordered_map<log_subsystem, spdlog::level::level_enum> subsystem_log_levels_;
 };
 
 } // namespace logger.
@@ -13,6 +13,7 @@
 // ****************************************************
 
 #include "logging.hh"
+#include <charconv>
 #include <filesystem>
 
 namespace pandora
@@ -20,13 +21,87 @@ namespace pandora
 namespace logger
 {
 
-thread_local std::string context::request_id;
+std::uint32_t context::session_tag{0u};
+std::atomic<std::uint32_t> context::next_thread_index{1u};
+thread_local request_id context::current_request_id{0u, 0u};
+thread_local std::array<char, context::k_max_formatted_request_id_size> context::formatted_request_id;
+thread_local std::size_t context::formatted_request_id_size{0u};
+
+void
+context::set_session_id(
+    const boost::uuids::uuid session_id)
+{
+    session_tag =
+        (static_cast<std::uint32_t>(session_id.data[0]) << 24u) |
+        (static_cast<std::uint32_t>(session_id.data[1]) << 16u) |
+        (static_cast<std::uint32_t>(session_id.data[2]) << 8u) |
+        static_cast<std::uint32_t>(session_id.data[3]);
+}
+
+void
+context::begin_request()
+{
+    //
+    // Threads take their index upon their first request only,
+    // after which starting a request is a plain increment.
+    //
+    if (current_request_id.thread_index_ == 0u)
+    {
+        current_request_id.thread_index_ = next_thread_index.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    ++current_request_id.sequence_number_;
+    formatted_request_id_size = 0u;
+}
+
+request_id
+context::get_request_id()
+{
+    return current_request_id;
+}
+
+std::string_view
+context::get_formatted_request_id()
+{
+    if (current_request_id.sequence_number_ == 0u)
+    {
+        return {};
+    }
+
+    if (formatted_request_id_size == 0u)
+    {
+        char* const begin = formatted_request_id.data();
+        char* const end = begin + formatted_request_id.size();
+        char* position = begin;
+
+        //
+        // The session tag is zero-padded, so all IDs of a session share a fixed-width prefix.
+        //
+        constexpr char k_hex_digits[] = "0123456789abcdef";
+        for (std::uint32_t shift = 32u; shift > 0u; shift -= 4u)
+        {
+            *position++ = k_hex_digits[(session_tag >> (shift - 4u)) & 0xfu];
+        }
+
+        *position++ = '-';
+        position = std::to_chars(position, end, current_request_id.thread_index_, 16).ptr;
+        *position++ = '-';
+        position = std::to_chars(position, end, current_request_id.sequence_number_, 16).ptr;
+        formatted_request_id_size = static_cast<std::size_t>(position - begin);
+    }
+
+    return std::string_view{
+        formatted_request_id.data(),
+        formatted_request_id_size};
+}
 
 void
 init_logger(
     const boost::uuids::uuid session_id,
     const logger_configuration& logger_config)
 {
+    context::set_session_id(session_id);
+
     spdlog::init_thread_pool(
         logger_config.queue_size_bytes_,
         1u /* thread_count */);
@@ -45,6 +120,20 @@ init_logger(
         logger_config.max_number_files_for_session_);
 
     spdlog::set_default_logger(logger);
+
+    //
+    // Log lines are gated by the subsystem log levels before reaching the logger,
+    // so the logger itself lets every level through.
+    //
+    spdlog::set_level(spdlog::level::trace);
+    log_levels::set_level(logger_config.log_level_);
+
+    for (const auto& [subsystem, level] : logger_config.subsystem_log_levels_)
+    {
+        log_levels::set_level(
+            subsystem,
+            level);
+    }
     spdlog::flush_on(spdlog::level::critical);
     spdlog::flush_every(std::chrono::milliseconds(logger_config.flush_frequency_ms_));
 
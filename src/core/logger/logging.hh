@@ -14,9 +14,15 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <string>
+#include <cstdint>
+#include <string_view>
 #include <spdlog/async.h>
 #include <spdlog/spdlog.h>
+#include "log_levels.hh"
+#include "log_sampling.hh"
 #include "logger_configuration.hh"
 #include "../common/uuid_utilities.hh"
 #include <spdlog/sinks/rotating_file_sink.h>
@@ -40,9 +46,90 @@ init_logger(
 std::string
 generate_log_directory_time_prefix();
 
+//
+// Correlation ID for a request, unique within a session.
+// Made of the index of the thread which received the request and a per-thread
+// sequence number, so it is generated without any synchronization.
+//
+struct request_id
+{
+    //
+    // Index of the thread which received the request. Starts at one.
+    //
+    std::uint32_t thread_index_;
+
+    //
+    // Sequence number of the request within its thread. Zero if there is no request.
+    //
+    std::uint64_t sequence_number_;
+};
+
 struct context
 {
-    static thread_local std::string request_id;
+    //
+    // Sets the session ID whose tag prefixes all formatted request IDs.
+    // Must be called before any request is started.
+    //
+    static
+    void
+    set_session_id(
+        const boost::uuids::uuid session_id);
+
+    //
+    // Starts a new request on the calling thread, which gets a new request ID.
+    // The request ID is not formatted until a log line needs it.
+    //
+    static
+    void
+    begin_request();
+
+    //
+    // Gets the ID of the current request on the calling thread.
+    //
+    static
+    request_id
+    get_request_id();
+
+    //
+    // Gets the ID of the current request on the calling thread in its printable form,
+    // such as '5f0e3a1c-3-1a'. It is formatted at most once per request.
+    // Returns an empty view if there is no current request.
+    //
+    static
+    std::string_view
+    get_formatted_request_id();
+
+private:
+
+    //
+    // Maximum length of a formatted request ID.
+    //
+    static constexpr std::size_t k_max_formatted_request_id_size = 40u;
+
+    //
+    // Tag of the session, taken from the leading bytes of its ID.
+    //
+    static std::uint32_t session_tag;
+
+    //
+    // Next thread index to hand out to a thread starting its first request.
+    //
+    static std::atomic<std::uint32_t> next_thread_index;
+
+    //
+    // ID of the current request on each thread.
+    //
+    static thread_local request_id current_request_id;
+
+    //
+    // Printable form of the current request ID on each thread, once formatted.
+    //
+    static thread_local std::array<char, k_max_formatted_request_id_size> formatted_request_id;
+
+    //
+    // Length of the printable form of the current request ID. Zero until formatted.
+    //
+    static thread_local std::size_t formatted_request_id_size;
 };
 
 } // namespace logger.
@@ -50,17 +137,58 @@ struct context
 
 //
 // Global scope access.
+// Log lines below the compile-time minimum level are discarded entirely, and the
+// runtime level of the subsystem of the source file is checked before evaluating any arguments.
+// Enabled log lines are only emitted if admitted, and counted as suppressed otherwise.
+//
+#define TRACE_LOG_IF_ADMITTED(level, admission, fmt, ...)                                           \
+do                                                                                                  \
+{                                                                                                   \
+    constexpr auto trace_log_level = pandora::logger::log_level::level;                            \
+    if constexpr (static_cast<int>(trace_log_level) >= PANDORA_MIN_LOG_LEVEL)                       \
+    {                                                                                               \
+        constexpr auto trace_log_subsystem = pandora::logger::get_log_subsystem_from_path(__FILE__); \
+        if (pandora::logger::log_levels::is_enabled(trace_log_subsystem, trace_log_level))          \
+        {                                                                                           \
+            if (!(admission))                                                                       \
+            {                                                                                       \
+                pandora::logger::record_suppressed_log_line();                                      \
+                break;                                                                              \
+            }                                                                                       \
+            const auto ctx = pandora::logger::context::get_formatted_request_id();                 \
+            if (ctx.empty())                                                                        \
+            {                                                                                       \
+                spdlog::level(fmt, ##__VA_ARGS__);                                                  \
+            }                                                                                       \
+            else                                                                                    \
+            {                                                                                       \
+                spdlog::level("[{}] " fmt, ctx, ##__VA_ARGS__);                                     \
+            }                                                                                       \
+        }                                                                                           \
+    }                                                                                               \
+} while (0)
+
+#define TRACE_LOG(level, fmt, ...)                                                                  \
+    TRACE_LOG_IF_ADMITTED(level, true, fmt, ##__VA_ARGS__)
+
+//
+// Emits one out of every sample_rate log lines of the call site.
+// Meant for per-object log lines on hot paths, which still leave a representative trace.
+//
+#define TRACE_LOG_SAMPLED(level, sample_rate, fmt, ...)                                             \
+do                                                                                                  \
+{                                                                                                   \
+    static pandora::logger::log_sampler trace_log_sampler{sample_rate};                             \
+    TRACE_LOG_IF_ADMITTED(level, trace_log_sampler.is_admitted(), fmt, ##__VA_ARGS__);             \
+} while (0)
+
+//
+// Emits up to max_log_lines_per_second log lines of the call site per second.
+// Meant for log lines which may burst, such as per-object failures.
 //
-#define TRACE_LOG(level, fmt, ...)                                   \
-do                                                                   \
-{                                                                    \
-    const auto& ctx = pandora::logger::context::request_id;          \
-    if (ctx.empty())                                                 \
-    {                                                                \
-        spdlog::level(fmt, ##__VA_ARGS__);                           \
-    }                                                                \
-    else                                                             \
-    {                                                                \
-        spdlog::level("[{}] " fmt, ctx, ##__VA_ARGS__);              \
-    }                                                                \
+#define TRACE_LOG_RATE_LIMITED(level, max_log_lines_per_second, fmt, ...)                           \
+do                                                                                                  \
+{                                                                                                   \
+    static pandora::logger::log_rate_limiter trace_log_rate_limiter{max_log_lines_per_second};      \
+    TRACE_LOG_IF_ADMITTED(level, trace_log_rate_limiter.is_admitted(), fmt, ##__VA_ARGS__);        \
 } while (0)
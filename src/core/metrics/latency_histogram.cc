@@ -0,0 +1,113 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Metrics
+// 'latency_histogram.cc'
+// Author: jcjuarez
+// Description:
+//      Log-linear latency histogram sharded across
+//      threads, with HDR-style bucket boundaries.
+// ****************************************************
+
+#include <bit>
+#include <limits>
+#include "latency_histogram.hh"
+
+namespace pandora::metrics
+{
+
+latency_histogram::latency_histogram()
+    : shards_{}
+{}
+
+void
+latency_histogram::record(
+    const std::uint64_t latency_ns)
+{
+    histogram_shard& shard = shards_[get_metrics_shard_index()];
+    shard.bucket_counts_[get_bucket_index(latency_ns)].fetch_add(1u, std::memory_order_relaxed);
+    shard.sum_ns_.fetch_add(latency_ns, std::memory_order_relaxed);
+}
+
+void
+latency_histogram::record_since(
+    const std::chrono::steady_clock::time_point start_time)
+{
+    record(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start_time).count()));
+}
+
+latency_histogram_snapshot
+latency_histogram::get_snapshot() const
+{
+    latency_histogram_snapshot snapshot{};
+
+    for (const histogram_shard& shard : shards_)
+    {
+        for (std::size_t bucket_index = 0u; bucket_index < k_number_buckets; ++bucket_index)
+        {
+            const std::uint64_t bucket_count = shard.bucket_counts_[bucket_index].load(std::memory_order_relaxed);
+            snapshot.bucket_counts_[bucket_index] += bucket_count;
+            snapshot.count_ += bucket_count;
+        }
+
+        snapshot.sum_ns_ += shard.sum_ns_.load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+std::size_t
+latency_histogram::get_bucket_index(
+    const std::uint64_t latency_ns)
+{
+    //
+    // Buckets are upper-inclusive, so index by the latency minus one. Past the first bucket,
+    // every power of two is split into linear sub-buckets indexed by the bits after the leading one.
+    //
+    const std::uint64_t value = latency_ns == 0u ? 0u : latency_ns - 1u;
+
+    if (value < (std::uint64_t{1u} << k_min_exponent))
+    {
+        return 0u;
+    }
+
+    const std::uint32_t exponent = static_cast<std::uint32_t>(std::bit_width(value)) - 1u;
+
+    if (exponent >= k_max_exponent)
+    {
+        return k_number_buckets - 1u;
+    }
+
+    const std::uint64_t sub_bucket_index =
+        (value >> (exponent - k_sub_bucket_bits)) & ((std::uint64_t{1u} << k_sub_bucket_bits) - 1u);
+
+    return 1u + ((exponent - k_min_exponent) << k_sub_bucket_bits) + sub_bucket_index;
+}
+
+std::uint64_t
+latency_histogram::get_bucket_upper_bound_ns(
+    const std::size_t bucket_index)
+{
+    if (bucket_index == 0u)
+    {
+        return std::uint64_t{1u} << k_min_exponent;
+    }
+
+    if (bucket_index >= k_number_buckets - 1u)
+    {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+
+    const std::uint32_t exponent =
+        k_min_exponent + static_cast<std::uint32_t>((bucket_index - 1u) >> k_sub_bucket_bits);
+    const std::uint64_t sub_bucket_index = (bucket_index - 1u) & ((std::uint64_t{1u} << k_sub_bucket_bits) - 1u);
+
+    return ((std::uint64_t{1u} << k_sub_bucket_bits) + sub_bucket_index + 1u) << (exponent - k_sub_bucket_bits);
+}
+
+} // namespace pandora::metrics.
@@ -0,0 +1,145 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Metrics
+// 'latency_histogram.hh'
+// Author: jcjuarez
+// Description:
+//      Log-linear latency histogram sharded across
+//      threads, with HDR-style bucket boundaries.
+// ****************************************************
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include "sharded_counter.hh"
+
+namespace pandora::metrics
+{
+
+//
+// Point in time copy of a latency histogram, summed across all shards.
+//
+struct latency_histogram_snapshot;
+
+class latency_histogram
+{
+public:
+
+    //
+    // Number of linear sub-buckets per power of two, as a number of bits.
+    // Four sub-buckets bound the relative error of a bucket to 25%.
+    //
+    static constexpr std::uint32_t k_sub_bucket_bits = 2u;
+
+    //
+    // Power of two of the upper bound of the first bucket, which holds all latencies up to ~1us.
+    //
+    static constexpr std::uint32_t k_min_exponent = 10u;
+
+    //
+    // Power of two from which latencies fall in the overflow bucket, which is ~17s.
+    //
+    static constexpr std::uint32_t k_max_exponent = 34u;
+
+    //
+    // Number of buckets, including the first and the overflow buckets.
+    //
+    static constexpr std::size_t k_number_buckets =
+        ((k_max_exponent - k_min_exponent) << k_sub_bucket_bits) + 2u;
+
+    //
+    // Constructor.
+    //
+    latency_histogram();
+
+    //
+    // Records a latency in nanoseconds on the shard of the calling thread.
+    // This is a lock-free operation.
+    //
+    void
+    record(
+        const std::uint64_t latency_ns);
+
+    //
+    // Records the latency elapsed since the given start time.
+    //
+    void
+    record_since(
+        const std::chrono::steady_clock::time_point start_time);
+
+    //
+    // Gets a copy of the histogram summed across all shards.
+    // Concurrent records may be partially reflected, which is tolerable for monitoring.
+    //
+    latency_histogram_snapshot
+    get_snapshot() const;
+
+    //
+    // Gets the bucket index for a latency in nanoseconds.
+    // Every bucket holds the latencies above the upper bound of the previous bucket up to its own.
+    //
+    static
+    std::size_t
+    get_bucket_index(
+        const std::uint64_t latency_ns);
+
+    //
+    // Gets the inclusive upper bound in nanoseconds of a bucket.
+    // The overflow bucket has no upper bound, and returns the maximum value.
+    //
+    static
+    std::uint64_t
+    get_bucket_upper_bound_ns(
+        const std::size_t bucket_index);
+
+private:
+
+    //
+    // Histogram shard, aligned to a cache line to avoid false sharing between threads.
+    //
+    struct alignas(64) histogram_shard
+    {
+        //
+        // Number of latencies recorded in every bucket.
+        //
+        std::array<std::atomic<std::uint64_t>, k_number_buckets> bucket_counts_;
+
+        //
+        // Sum of all recorded latencies in nanoseconds.
+        //
+        std::atomic<std::uint64_t> sum_ns_;
+    };
+
+    //
+    // Histogram shards, indexed by the metrics shard index of the threads.
+    //
+    std::array<histogram_shard, k_number_metrics_shards> shards_;
+};
+
+struct latency_histogram_snapshot
+{
+    //
+    // Number of latencies recorded in every bucket.
+    //
+    std::array<std::uint64_t, latency_histogram::k_number_buckets> bucket_counts_;
+
+    //
+    // Sum of all recorded latencies in nanoseconds.
+    //
+    std::uint64_t sum_ns_;
+
+    //
+    // Number of recorded latencies.
+    //
+    std::uint64_t count_;
+};
+
+} // namespace pandora::metrics.
@@ -0,0 +1,361 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Metrics
+// 'metrics_registry.cc'
+// Author: jcjuarez
+// Description:
+//      Process-wide registry of the latency and
+//      operation metrics of the data store.
+// ****************************************************
+
+#include <format>
+#include <string_view>
+#include "prometheus_text.hh"
+#include "metrics_registry.hh"
+
+namespace pandora::metrics
+{
+
+//
+// Labels of every object operation series, indexed by series.
+//
+static constexpr std::array<std::string_view, 6u> k_object_operation_series_labels = {
+    "operation=\"insert\",cache=\"none\"",
+    "operation=\"remove\",cache=\"none\"",
+    "operation=\"get\",cache=\"hit\"",
+    "operation=\"get\",cache=\"miss\"",
+    "operation=\"get\",cache=\"coalesced\"",
+    "operation=\"get\",cache=\"negative\""};
+
+//
+// Label values of the IO queues and the storage engine calls, indexed by their enums.
+//
+static constexpr std::array<std::string_view, 2u> k_io_queue_names = {"write", "read"};
+static constexpr std::array<std::string_view, 2u> k_storage_engine_call_names = {"commit_write_batch", "multi_get"};
+
+std::array<latency_histogram, metrics_registry::k_number_object_operation_series> metrics_registry::object_operation_latencies_;
+std::array<sharded_counter, metrics_registry::k_number_object_operation_series> metrics_registry::object_operation_failures_;
+std::vector<std::unique_ptr<latency_histogram>> metrics_registry::io_queue_waits_;
+std::vector<std::unique_ptr<latency_histogram>> metrics_registry::storage_engine_calls_;
+std::vector<std::unique_ptr<sharded_counter>> metrics_registry::expired_io_tasks_;
+std::vector<std::unique_ptr<metrics_registry::io_queue_depth>> metrics_registry::write_io_queue_depths_;
+std::vector<std::unique_ptr<sharded_counter>> metrics_registry::write_io_queue_rejections_;
+std::uint16_t metrics_registry::number_collocations_ = 0u;
+
+void
+metrics_registry::init(
+    const std::uint16_t number_collocations)
+{
+    io_queue_waits_.clear();
+    storage_engine_calls_.clear();
+    expired_io_tasks_.clear();
+    write_io_queue_depths_.clear();
+    write_io_queue_rejections_.clear();
+
+    for (std::size_t index = 0u; index < k_io_queue_names.size() * number_collocations; ++index)
+    {
+        io_queue_waits_.push_back(std::make_unique<latency_histogram>());
+        expired_io_tasks_.push_back(std::make_unique<sharded_counter>());
+    }
+
+    for (std::size_t index = 0u; index < k_storage_engine_call_names.size() * number_collocations; ++index)
+    {
+        storage_engine_calls_.push_back(std::make_unique<latency_histogram>());
+    }
+
+    for (std::uint16_t collocation_index = 0u; collocation_index < number_collocations; ++collocation_index)
+    {
+        write_io_queue_depths_.push_back(std::make_unique<io_queue_depth>());
+        write_io_queue_rejections_.push_back(std::make_unique<sharded_counter>());
+    }
+
+    number_collocations_ = number_collocations;
+}
+
+void
+metrics_registry::record_object_operation(
+    const schemas::object_request_optype optype,
+    const cache_outcome outcome,
+    const status::status_code status,
+    const std::chrono::steady_clock::time_point start_time)
+{
+    const std::size_t series_index = get_object_operation_series_index(
+        optype,
+        outcome);
+
+    if (series_index >= k_number_object_operation_series)
+    {
+        return;
+    }
+
+    object_operation_latencies_[series_index].record_since(start_time);
+
+    if (status::failed(status))
+    {
+        object_operation_failures_[series_index].increment();
+    }
+}
+
+void
+metrics_registry::record_io_queue_wait(
+    const io_queue queue,
+    const std::uint16_t collocation_index,
+    const std::chrono::steady_clock::time_point enqueue_time)
+{
+    if (collocation_index >= number_collocations_)
+    {
+        return;
+    }
+
+    io_queue_waits_[static_cast<std::size_t>(queue) * number_collocations_ + collocation_index]->record_since(
+        enqueue_time);
+}
+
+void
+metrics_registry::record_storage_engine_call(
+    const storage_engine_call engine_call,
+    const std::uint16_t collocation_index,
+    const std::chrono::steady_clock::time_point start_time)
+{
+    if (collocation_index >= number_collocations_)
+    {
+        return;
+    }
+
+    storage_engine_calls_[static_cast<std::size_t>(engine_call) * number_collocations_ + collocation_index]->record_since(
+        start_time);
+}
+
+void
+metrics_registry::record_expired_io_tasks(
+    const io_queue queue,
+    const std::uint16_t collocation_index,
+    const std::uint64_t number_tasks)
+{
+    if (collocation_index >= number_collocations_)
+    {
+        return;
+    }
+
+    expired_io_tasks_[static_cast<std::size_t>(queue) * number_collocations_ + collocation_index]->increment(
+        number_tasks);
+}
+
+void
+metrics_registry::record_write_io_queue_depth(
+    const std::uint16_t collocation_index,
+    const std::uint64_t number_tasks,
+    const std::uint64_t size_bytes)
+{
+    if (collocation_index >= number_collocations_)
+    {
+        return;
+    }
+
+    write_io_queue_depths_[collocation_index]->number_tasks_.store(number_tasks, std::memory_order_relaxed);
+    write_io_queue_depths_[collocation_index]->size_bytes_.store(size_bytes, std::memory_order_relaxed);
+}
+
+void
+metrics_registry::record_write_io_queue_rejection(
+    const std::uint16_t collocation_index,
+    const std::uint64_t number_tasks)
+{
+    if (collocation_index >= number_collocations_)
+    {
+        return;
+    }
+
+    write_io_queue_rejections_[collocation_index]->increment(number_tasks);
+}
+
+void
+metrics_registry::append_prometheus_exposition(
+    std::string& exposition)
+{
+    append_prometheus_metric_header(
+        exposition,
+        "pandora_object_operation_duration_seconds",
+        "histogram",
+        "Latency of object operations, from the reception of their request until their response, for every cache outcome.");
+
+    for (std::size_t series_index = 0u; series_index < k_number_object_operation_series; ++series_index)
+    {
+        append_prometheus_histogram(
+            exposition,
+            "pandora_object_operation_duration_seconds",
+            k_object_operation_series_labels[series_index],
+            object_operation_latencies_[series_index].get_snapshot());
+    }
+
+    append_prometheus_metric_header(
+        exposition,
+        "pandora_object_operation_failures_total",
+        "counter",
+        "Number of object operations completed with a failure status.");
+
+    for (std::size_t series_index = 0u; series_index < k_number_object_operation_series; ++series_index)
+    {
+        append_prometheus_sample(
+            exposition,
+            "pandora_object_operation_failures_total",
+            k_object_operation_series_labels[series_index],
+            object_operation_failures_[series_index].get_value());
+    }
+
+    append_prometheus_metric_header(
+        exposition,
+        "pandora_io_queue_wait_duration_seconds",
+        "histogram",
+        "Time object operations waited in the IO queues of a collocation before being executed.");
+
+    for (std::size_t index = 0u; index < io_queue_waits_.size(); ++index)
+    {
+        append_prometheus_histogram(
+            exposition,
+            "pandora_io_queue_wait_duration_seconds",
+            std::format(
+                "queue=\"{}\",collocation=\"{}\"",
+                k_io_queue_names[index / number_collocations_],
+                index % number_collocations_),
+            io_queue_waits_[index]->get_snapshot());
+    }
+
+    append_prometheus_metric_header(
+        exposition,
+        "pandora_io_tasks_expired_total",
+        "counter",
+        "Number of object operations dropped by the IO dispatchers of a collocation as their deadline had passed.");
+
+    for (std::size_t index = 0u; index < expired_io_tasks_.size(); ++index)
+    {
+        append_prometheus_sample(
+            exposition,
+            "pandora_io_tasks_expired_total",
+            std::format(
+                "queue=\"{}\",collocation=\"{}\"",
+                k_io_queue_names[index / number_collocations_],
+                index % number_collocations_),
+            expired_io_tasks_[index]->get_value());
+    }
+
+    append_prometheus_metric_header(
+        exposition,
+        "pandora_storage_engine_call_duration_seconds",
+        "histogram",
+        "Time taken by the storage engine calls issued by the IO dispatchers of a collocation.");
+
+    for (std::size_t index = 0u; index < storage_engine_calls_.size(); ++index)
+    {
+        append_prometheus_histogram(
+            exposition,
+            "pandora_storage_engine_call_duration_seconds",
+            std::format(
+                "call=\"{}\",collocation=\"{}\"",
+                k_storage_engine_call_names[index / number_collocations_],
+                index % number_collocations_),
+            storage_engine_calls_[index]->get_snapshot());
+    }
+
+    append_prometheus_metric_header(
+        exposition,
+        "pandora_write_io_queue_depth_tasks",
+        "gauge",
+        "Number of admitted write IO tasks of a collocation not yet completed, as of the last write batch.");
+
+    for (std::uint16_t collocation_index = 0u; collocation_index < write_io_queue_depths_.size(); ++collocation_index)
+    {
+        append_prometheus_sample(
+            exposition,
+            "pandora_write_io_queue_depth_tasks",
+            std::format("collocation=\"{}\"", collocation_index),
+            write_io_queue_depths_[collocation_index]->number_tasks_.load(std::memory_order_relaxed));
+    }
+
+    append_prometheus_metric_header(
+        exposition,
+        "pandora_write_io_queue_depth_bytes",
+        "gauge",
+        "Number of bytes held by the admitted write IO tasks of a collocation, as of the last write batch.");
+
+    for (std::uint16_t collocation_index = 0u; collocation_index < write_io_queue_depths_.size(); ++collocation_index)
+    {
+        append_prometheus_sample(
+            exposition,
+            "pandora_write_io_queue_depth_bytes",
+            std::format("collocation=\"{}\"", collocation_index),
+            write_io_queue_depths_[collocation_index]->size_bytes_.load(std::memory_order_relaxed));
+    }
+
+    append_prometheus_metric_header(
+        exposition,
+        "pandora_write_io_queue_rejections_total",
+        "counter",
+        "Number of write operations rejected as the write IO queue of a collocation was at capacity.");
+
+    for (std::uint16_t collocation_index = 0u; collocation_index < write_io_queue_rejections_.size(); ++collocation_index)
+    {
+        append_prometheus_sample(
+            exposition,
+            "pandora_write_io_queue_rejections_total",
+            std::format("collocation=\"{}\"", collocation_index),
+            write_io_queue_rejections_[collocation_index]->get_value());
+    }
+}
+
+std::size_t
+metrics_registry::get_object_operation_series_index(
+    const schemas::object_request_optype optype,
+    const cache_outcome outcome)
+{
+    switch (optype)
+    {
+        case schemas::object_request_optype::insert:
+        {
+            return 0u;
+        }
+
+        case schemas::object_request_optype::remove:
+        {
+            return 1u;
+        }
+
+        case schemas::object_request_optype::get:
+        {
+            switch (outcome)
+            {
+                case cache_outcome::hit:
+                {
+                    return 2u;
+                }
+
+                case cache_outcome::coalesced:
+                {
+                    return 4u;
+                }
+
+                case cache_outcome::negative:
+                {
+                    return 5u;
+                }
+
+                default:
+                {
+                    return 3u;
+                }
+            }
+        }
+
+        default:
+        {
+            return k_number_object_operation_series;
+        }
+    }
+}
+
+} // namespace pandora::metrics.
@@ -0,0 +1,254 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Metrics
+// 'metrics_registry.hh'
+// Author: jcjuarez
+// Description:
+//      Process-wide registry of the latency and
+//      operation metrics of the data store.
+// ****************************************************
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "sharded_counter.hh"
+#include "latency_histogram.hh"
+#include "../status/status.hh"
+#include "../schemas/request-optypes/object_request_optype.hh"
+
+namespace pandora::metrics
+{
+
+//
+// How the frontline cache took part in an object operation.
+//
+enum class cache_outcome : std::uint8_t
+{
+    //
+    // The operation does not look up the cache, such as writes.
+    //
+    none = 0,
+
+    //
+    // The operation was served from the cache.
+    //
+    hit = 1,
+
+    //
+    // The operation was served from the storage engine.
+    //
+    miss = 2,
+
+    //
+    // The operation missed the cache and was served by the
+    // storage engine read of a concurrent miss of the same object.
+    //
+    coalesced = 3,
+
+    //
+    // The operation was answered from a negative entry of the cache,
+    // which records the object as recently found absent in the storage engine.
+    //
+    negative = 4
+};
+
+//
+// IO queues in which object operations wait before being executed.
+//
+enum class io_queue : std::uint8_t
+{
+    //
+    // Write IO tasks queue of the write IO dispatcher of a collocation.
+    //
+    write = 0,
+
+    //
+    // Pending read IO tasks queue of the read IO dispatcher of a collocation.
+    //
+    read = 1
+};
+
+//
+// Storage engine calls issued by the IO dispatchers.
+//
+enum class storage_engine_call : std::uint8_t
+{
+    //
+    // Commit of a group of write IO tasks as a single write batch.
+    //
+    commit_write_batch = 0,
+
+    //
+    // Multi-get of a group of read IO tasks.
+    //
+    multi_get = 1
+};
+
+//
+// Registry of the metrics recorded across the data store.
+// Recording is lock-free, and the metrics are exposed in the Prometheus text format.
+//
+class metrics_registry
+{
+public:
+
+    //
+    // Allocates the per-collocation metrics.
+    // Must be called before any IO dispatcher is started.
+    // Per-collocation metrics are not recorded until then.
+    //
+    static
+    void
+    init(
+        const std::uint16_t number_collocations);
+
+    //
+    // Records the completion of an object operation, with its latency measured from the start time.
+    // The start time is the reception of its request, so every cache outcome is comparable.
+    //
+    static
+    void
+    record_object_operation(
+        const schemas::object_request_optype optype,
+        const cache_outcome outcome,
+        const status::status_code status,
+        const std::chrono::steady_clock::time_point start_time);
+
+    //
+    // Records the time an object operation waited in an IO queue of a collocation.
+    //
+    static
+    void
+    record_io_queue_wait(
+        const io_queue queue,
+        const std::uint16_t collocation_index,
+        const std::chrono::steady_clock::time_point enqueue_time);
+
+    //
+    // Records the time a storage engine call of a collocation took.
+    //
+    static
+    void
+    record_storage_engine_call(
+        const storage_engine_call engine_call,
+        const std::uint16_t collocation_index,
+        const std::chrono::steady_clock::time_point start_time);
+
+    //
+    // Records the IO tasks of a collocation dropped at dequeue time as their deadline had passed.
+    //
+    static
+    void
+    record_expired_io_tasks(
+        const io_queue queue,
+        const std::uint16_t collocation_index,
+        const std::uint64_t number_tasks);
+
+    //
+    // Records the number of tasks and bytes held by the write IO queue of a collocation.
+    // Only called by the write IO dispatcher thread of the collocation.
+    //
+    static
+    void
+    record_write_io_queue_depth(
+        const std::uint16_t collocation_index,
+        const std::uint64_t number_tasks,
+        const std::uint64_t size_bytes);
+
+    //
+    // Records the rejection of write IO tasks as the write IO queue of a collocation was full.
+    //
+    static
+    void
+    record_write_io_queue_rejection(
+        const std::uint16_t collocation_index,
+        const std::uint64_t number_tasks);
+
+    //
+    // Appends all registered metrics to the exposition in the Prometheus text format.
+    //
+    static
+    void
+    append_prometheus_exposition(
+        std::string& exposition);
+
+private:
+
+    //
+    // Number of object operation series, as {Optype, CacheOutcome} pairs.
+    // Inserts and removals bypass the cache, and gets either hit, miss, coalesce
+    // or are answered from a negative entry.
+    //
+    static constexpr std::size_t k_number_object_operation_series = 6u;
+
+    //
+    // Gets the object operation series index for an {Optype, CacheOutcome} pair.
+    //
+    static
+    std::size_t
+    get_object_operation_series_index(
+        const schemas::object_request_optype optype,
+        const cache_outcome outcome);
+
+    //
+    // Latency of the object operations, indexed by series.
+    //
+    static std::array<latency_histogram, k_number_object_operation_series> object_operation_latencies_;
+
+    //
+    // Number of failed object operations, indexed by series.
+    //
+    static std::array<sharded_counter, k_number_object_operation_series> object_operation_failures_;
+
+    //
+    // Time waited in the IO queues, indexed by IO queue and then by collocation.
+    //
+    static std::vector<std::unique_ptr<latency_histogram>> io_queue_waits_;
+
+    //
+    // Time taken by the storage engine calls, indexed by call and then by collocation.
+    //
+    static std::vector<std::unique_ptr<latency_histogram>> storage_engine_calls_;
+
+    //
+    // Number of IO tasks dropped as expired, indexed by IO queue and then by collocation.
+    //
+    static std::vector<std::unique_ptr<sharded_counter>> expired_io_tasks_;
+
+    //
+    // Last sampled depth of an IO queue.
+    //
+    struct io_queue_depth
+    {
+        std::atomic<std::uint64_t> number_tasks_{0u};
+        std::atomic<std::uint64_t> size_bytes_{0u};
+    };
+
+    //
+    // Depth of the write IO queues, indexed by collocation.
+    //
+    static std::vector<std::unique_ptr<io_queue_depth>> write_io_queue_depths_;
+
+    //
+    // Number of rejected write IO tasks, indexed by collocation.
+    //
+    static std::vector<std::unique_ptr<sharded_counter>> write_io_queue_rejections_;
+
+    //
+    // Number of collocations with allocated metrics.
+    //
+    static std::uint16_t number_collocations_;
+};
+
+} // namespace pandora::metrics.
@@ -0,0 +1,121 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Metrics
+// 'prometheus_text.cc'
+// Author: jcjuarez
+// Description:
+//      Writers for the Prometheus text exposition format.
+// ****************************************************
+
+#include <format>
+#include <iterator>
+#include "prometheus_text.hh"
+
+namespace pandora::metrics
+{
+
+void
+append_prometheus_metric_header(
+    std::string& exposition,
+    std::string_view metric_name,
+    std::string_view metric_type,
+    std::string_view metric_help)
+{
+    std::format_to(
+        std::back_inserter(exposition),
+        "# HELP {} {}\n# TYPE {} {}\n",
+        metric_name,
+        metric_help,
+        metric_name,
+        metric_type);
+}
+
+void
+append_prometheus_sample(
+    std::string& exposition,
+    std::string_view metric_name,
+    std::string_view labels,
+    const std::uint64_t value)
+{
+    if (labels.empty())
+    {
+        std::format_to(std::back_inserter(exposition), "{} {}\n", metric_name, value);
+
+        return;
+    }
+
+    std::format_to(std::back_inserter(exposition), "{}{{{}}} {}\n", metric_name, labels, value);
+}
+
+void
+append_prometheus_sample(
+    std::string& exposition,
+    std::string_view metric_name,
+    std::string_view labels,
+    const double value)
+{
+    if (labels.empty())
+    {
+        std::format_to(std::back_inserter(exposition), "{} {}\n", metric_name, value);
+
+        return;
+    }
+
+    std::format_to(std::back_inserter(exposition), "{}{{{}}} {}\n", metric_name, labels, value);
+}
+
+void
+append_prometheus_histogram(
+    std::string& exposition,
+    std::string_view metric_name,
+    std::string_view labels,
+    const latency_histogram_snapshot& snapshot)
+{
+    constexpr double k_nanoseconds_per_second = 1'000'000'000.0;
+    std::string_view labels_separator = labels.empty() ? "" : ",";
+    std::uint64_t cumulative_count = 0u;
+
+    //
+    // Prometheus buckets are cumulative, and the overflow bucket is the '+Inf' one.
+    //
+    for (std::size_t bucket_index = 0u; bucket_index < latency_histogram::k_number_buckets - 1u; ++bucket_index)
+    {
+        cumulative_count += snapshot.bucket_counts_[bucket_index];
+
+        std::format_to(
+            std::back_inserter(exposition),
+            "{}_bucket{{{}{}le=\"{}\"}} {}\n",
+            metric_name,
+            labels,
+            labels_separator,
+            static_cast<double>(latency_histogram::get_bucket_upper_bound_ns(bucket_index)) / k_nanoseconds_per_second,
+            cumulative_count);
+    }
+
+    std::format_to(
+        std::back_inserter(exposition),
+        "{}_bucket{{{}{}le=\"+Inf\"}} {}\n",
+        metric_name,
+        labels,
+        labels_separator,
+        snapshot.count_);
+
+    append_prometheus_sample(
+        exposition,
+        std::string{metric_name} + "_sum",
+        labels,
+        static_cast<double>(snapshot.sum_ns_) / k_nanoseconds_per_second);
+
+    append_prometheus_sample(
+        exposition,
+        std::string{metric_name} + "_count",
+        labels,
+        snapshot.count_);
+}
+
+} // namespace pandora::metrics.
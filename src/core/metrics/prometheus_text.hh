@@ -0,0 +1,66 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Metrics
+// 'prometheus_text.hh'
+// Author: jcjuarez
+// Description:
+//      Writers for the Prometheus text exposition format.
+// ****************************************************
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <string_view>
+#include "latency_histogram.hh"
+
+namespace pandora::metrics
+{
+
+//
+// Appends the help and type lines which precede the samples of a metric.
+//
+void
+append_prometheus_metric_header(
+    std::string& exposition,
+    std::string_view metric_name,
+    std::string_view metric_type,
+    std::string_view metric_help);
+
+//
+// Appends a counter or gauge sample. The labels are given already
+// formatted without braces, such as 'operation="get"', and may be empty.
+//
+void
+append_prometheus_sample(
+    std::string& exposition,
+    std::string_view metric_name,
+    std::string_view labels,
+    const std::uint64_t value);
+
+//
+// Appends a gauge sample with a fractional value.
+//
+void
+append_prometheus_sample(
+    std::string& exposition,
+    std::string_view metric_name,
+    std::string_view labels,
+    const double value);
+
+//
+// Appends the cumulative bucket, sum and count samples of a latency histogram in seconds.
+//
+void
+append_prometheus_histogram(
+    std::string& exposition,
+    std::string_view metric_name,
+    std::string_view labels,
+    const latency_histogram_snapshot& snapshot);
+
+} // namespace pandora::metrics.
@@ -0,0 +1,55 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Metrics
+// 'sharded_counter.cc'
+// Author: jcjuarez
+// Description:
+//      Monotonic counter sharded across threads
+//      so that concurrent increments do not contend.
+// ****************************************************
+
+#include "sharded_counter.hh"
+
+namespace pandora::metrics
+{
+
+std::size_t
+get_metrics_shard_index()
+{
+    static std::atomic<std::size_t> next_metrics_shard_index{0u};
+    thread_local const std::size_t metrics_shard_index =
+        next_metrics_shard_index.fetch_add(1u, std::memory_order_relaxed) % k_number_metrics_shards;
+
+    return metrics_shard_index;
+}
+
+sharded_counter::sharded_counter()
+    : shards_{}
+{}
+
+void
+sharded_counter::increment(
+    const std::uint64_t value)
+{
+    shards_[get_metrics_shard_index()].value_.fetch_add(value, std::memory_order_relaxed);
+}
+
+std::uint64_t
+sharded_counter::get_value() const
+{
+    std::uint64_t value = 0u;
+
+    for (const counter_shard& shard : shards_)
+    {
+        value += shard.value_.load(std::memory_order_relaxed);
+    }
+
+    return value;
+}
+
+} // namespace pandora::metrics.
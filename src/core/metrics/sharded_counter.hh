@@ -0,0 +1,77 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Metrics
+// 'sharded_counter.hh'
+// Author: jcjuarez
+// Description:
+//      Monotonic counter sharded across threads
+//      so that concurrent increments do not contend.
+// ****************************************************
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace pandora::metrics
+{
+
+//
+// Number of shards for every sharded metric.
+// Threads are spread over the shards, so a shard is rarely written by two threads at once.
+//
+inline constexpr std::size_t k_number_metrics_shards = 16u;
+
+//
+// Gets the metrics shard index of the calling thread.
+// Assigned round-robin on the first call of every thread.
+//
+std::size_t
+get_metrics_shard_index();
+
+class sharded_counter
+{
+public:
+
+    //
+    // Constructor.
+    //
+    sharded_counter();
+
+    //
+    // Increments the counter on the shard of the calling thread.
+    // This is a lock-free operation.
+    //
+    void
+    increment(
+        const std::uint64_t value = 1u);
+
+    //
+    // Gets the counter value summed across all shards.
+    //
+    std::uint64_t
+    get_value() const;
+
+private:
+
+    //
+    // Counter shard, aligned to a cache line to avoid false sharing between threads.
+    //
+    struct alignas(64) counter_shard
+    {
+        std::atomic<std::uint64_t> value_;
+    };
+
+    //
+    // Counter shards, indexed by the metrics shard index of the threads.
+    //
+    std::array<counter_shard, k_number_metrics_shards> shards_;
+};
+
+} // namespace pandora::metrics.
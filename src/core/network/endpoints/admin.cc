@@ -0,0 +1,229 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Network
+// 'admin.cc'
+// Author: jcjuarez
+// Description:
+//     Administration service endpoint for
+//     adjusting the system at runtime.
+// ****************************************************
+
+#include <format>
+#include <iterator>
+#include "admin.hh"
+#include "../server/server.hh"
+#include "../../logger/log_levels.hh"
+#include "../../common/response_utilities.hh"
+#include "../../schemas/request-interfaces/log_level_request.hh"
+#include "../../storage/management/engine_statistics_service.hh"
+
+namespace pandora
+{
+namespace network
+{
+namespace endpoints
+{
+
+admin::admin(
+    std::unique_ptr<storage::engine_statistics_service> engine_statistics_service)
+    : engine_statistics_service_{std::move(engine_statistics_service)}
+{}
+
+void
+admin::set_log_level(
+    const http_request& request,
+    server_response_callback&& response_callback)
+{
+    const schemas::log_level_request log_level_request{request};
+    const std::optional<spdlog::level::level_enum> log_level =
+        logger::get_log_level_from_name(log_level_request.get_log_level_name());
+    std::optional<logger::log_subsystem> log_subsystem = std::nullopt;
+
+    if (!log_level_request.get_log_subsystem_name().empty())
+    {
+        log_subsystem = logger::get_log_subsystem_from_name(log_level_request.get_log_subsystem_name());
+    }
+
+    if (!log_level.has_value() ||
+        (!log_level_request.get_log_subsystem_name().empty() && !log_subsystem.has_value()))
+    {
+        //
+        // Given log subsystem or log level is invalid.
+        // Not logging the parameters as to avoid potential
+        // large-buffer attacks in case the parameters are too big.
+        //
+        TRACE_LOG(error, "Invalid log level change request. "
+            "LogSubsystemSizeInBytes={}, "
+            "LogLevelSizeInBytes={}, "
+            "Status={:#x}.",
+            log_level_request.get_log_subsystem_name().size(),
+            log_level_request.get_log_level_name().size(),
+            status::invalid_log_level);
+
+        network::server::send_response(
+            response_callback,
+            status::invalid_log_level);
+
+        return;
+    }
+
+    if (log_subsystem.has_value())
+    {
+        logger::log_levels::set_level(
+            log_subsystem.value(),
+            log_level.value());
+    }
+    else
+    {
+        logger::log_levels::set_level(log_level.value());
+    }
+
+    //
+    // Traced as a warning so the change is visible under the usual levels.
+    //
+    TRACE_LOG(warn, "Log level changed. "
+        "LogSubsystem={}, "
+        "LogLevel={}.",
+        log_subsystem.has_value() ? log_level_request.get_log_subsystem_name() : std::string{"all"},
+        log_level_request.get_log_level_name());
+
+    network::server::send_response(
+        response_callback,
+        status::success);
+}
+
+void
+admin::get_engine_statistics(
+    const http_request& request,
+    server_response_callback&& response_callback)
+{
+    const std::vector<storage::data_partition_statistics> partitions_statistics =
+        engine_statistics_service_->get_engine_statistics();
+
+    std::string response_body;
+    response_body += "{\"internal_status_code\":\"";
+    response_body += status::success.get_internal_status_code_string();
+    response_body += "\",\"partitions\":[";
+
+    for (std::size_t index = 0u; index < partitions_statistics.size(); ++index)
+    {
+        if (index > 0u)
+        {
+            response_body += ',';
+        }
+
+        std::format_to(
+            std::back_inserter(response_body),
+            "{{\"collocation_index\":{},\"is_metadata_partition\":{},",
+            partitions_statistics[index].collocation_index_,
+            partitions_statistics[index].is_metadata_partition_);
+
+        append_engine_statistics(
+            response_body,
+            partitions_statistics[index].engine_statistics_);
+
+        response_body += '}';
+    }
+
+    response_body += "]}";
+
+    TRACE_LOG(info, "Storage engine statistics collected. "
+        "NumberDataPartitions={}, "
+        "ResponseSizeBytes={}.",
+        partitions_statistics.size(),
+        response_body.size());
+
+    network::server::send_json_response(
+        response_callback,
+        status::success,
+        std::move(response_body));
+}
+
+void
+admin::append_engine_statistics(
+    std::string& response_body,
+    const storage::storage_engine_statistics& engine_statistics)
+{
+    //
+    // Engine property values are strings as reported by the storage engine,
+    // while tickers and histograms are numeric.
+    //
+    const auto append_properties =
+        [&response_body](const std::vector<std::pair<std::string, std::string>>& properties)
+        {
+            response_body += '{';
+            for (std::size_t index = 0u; index < properties.size(); ++index)
+            {
+                if (index > 0u)
+                {
+                    response_body += ',';
+                }
+
+                common::response_utilities::append_json_string(response_body, properties[index].first);
+                response_body += ':';
+                common::response_utilities::append_json_string(response_body, properties[index].second);
+            }
+            response_body += '}';
+        };
+
+    response_body += "\"properties\":";
+    append_properties(engine_statistics.properties_);
+
+    response_body += ",\"tickers\":{";
+    for (std::size_t index = 0u; index < engine_statistics.tickers_.size(); ++index)
+    {
+        if (index > 0u)
+        {
+            response_body += ',';
+        }
+
+        common::response_utilities::append_json_string(response_body, engine_statistics.tickers_[index].first);
+        std::format_to(std::back_inserter(response_body), ":{}", engine_statistics.tickers_[index].second);
+    }
+
+    response_body += "},\"histograms\":{";
+    for (std::size_t index = 0u; index < engine_statistics.histograms_.size(); ++index)
+    {
+        const storage::storage_engine_histogram_statistics& histogram = engine_statistics.histograms_[index];
+        if (index > 0u)
+        {
+            response_body += ',';
+        }
+
+        common::response_utilities::append_json_string(response_body, histogram.name_);
+        std::format_to(
+            std::back_inserter(response_body),
+            ":{{\"count\":{},\"median\":{},\"percentile_95\":{},\"percentile_99\":{},\"max\":{}}}",
+            histogram.count_,
+            histogram.median_,
+            histogram.percentile_95_,
+            histogram.percentile_99_,
+            histogram.max_);
+    }
+
+    response_body += "},\"containers\":[";
+    for (std::size_t index = 0u; index < engine_statistics.containers_.size(); ++index)
+    {
+        if (index > 0u)
+        {
+            response_body += ',';
+        }
+
+        response_body += "{\"container_name\":";
+        common::response_utilities::append_json_string(response_body, engine_statistics.containers_[index].container_name_);
+        response_body += ",\"properties\":";
+        append_properties(engine_statistics.containers_[index].properties_);
+        response_body += '}';
+    }
+
+    response_body += ']';
+}
+
+} // namespace endpoints.
+} // namespace network.
+} // namespace pandora.
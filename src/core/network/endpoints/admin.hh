@@ -0,0 +1,91 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Network
+// 'admin.hh'
+// Author: jcjuarez
+// Description:
+//     Administration service endpoint for
+//     adjusting the system at runtime.
+// ****************************************************
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include "../../common/aliases.hh"
+#include <drogon/HttpController.h>
+
+namespace pandora
+{
+
+namespace storage
+{
+
+class engine_statistics_service;
+struct storage_engine_statistics;
+
+} // namespace storage.
+
+namespace network
+{
+namespace endpoints
+{
+
+class admin : public drogon::HttpController<admin, false>
+{
+public:
+
+    //
+    // Endpoint constructor.
+    //
+    admin(
+        std::unique_ptr<storage::engine_statistics_service> engine_statistics_service);
+
+    METHOD_LIST_BEGIN
+        METHOD_ADD(admin::set_log_level, "/log_level", drogon::Put, "pandora::network::logging_context_filter");
+        METHOD_ADD(admin::get_engine_statistics, "/engine_statistics", drogon::Get, "pandora::network::logging_context_filter");
+    METHOD_LIST_END
+
+    //
+    // Changes the log level of a subsystem, or of all
+    // subsystems if none is given, without a restart.
+    //
+    void
+    set_log_level(
+        const http_request& request,
+        server_response_callback&& response_callback);
+
+    //
+    // Replies with the statistics and engine properties of the storage engine
+    // instances of every data partition, and of every object container within them.
+    //
+    void
+    get_engine_statistics(
+        const http_request& request,
+        server_response_callback&& response_callback);
+
+    //
+    // Appends the statistics of a storage engine instance as the fields of a JSON object.
+    //
+    static
+    void
+    append_engine_statistics(
+        std::string& response_body,
+        const storage::storage_engine_statistics& engine_statistics);
+
+private:
+
+    //
+    // Engine statistics service handle.
+    //
+    std::unique_ptr<storage::engine_statistics_service> engine_statistics_service_;
+};
+
+} // namespace endpoints.
+} // namespace network.
+} // namespace pandora.
@@ -0,0 +1,140 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Network
+// 'metrics.cc'
+// Author: jcjuarez
+// Description:
+//     Metrics service endpoint for scraping
+//     the system metrics by Prometheus.
+// ****************************************************
+
+#include <format>
+#include "metrics.hh"
+#include "../../logger/log_sampling.hh"
+#include "../../metrics/prometheus_text.hh"
+#include "../../metrics/metrics_registry.hh"
+#include "../../storage/cache/frontline_cache.hh"
+
+namespace pandora
+{
+namespace network
+{
+namespace endpoints
+{
+
+metrics::metrics(
+    const storage::frontline_cache& frontline_cache)
+    : frontline_cache_{frontline_cache}
+{}
+
+void
+metrics::get_metrics(
+    const http_request& request,
+    server_response_callback&& response_callback)
+{
+    std::string exposition;
+    pandora::metrics::metrics_registry::append_prometheus_exposition(exposition);
+    append_frontline_cache_metrics(exposition);
+
+    pandora::metrics::append_prometheus_metric_header(
+        exposition,
+        "pandora_suppressed_log_lines_total",
+        "counter",
+        "Number of log lines suppressed by sampling or rate limiting.");
+
+    pandora::metrics::append_prometheus_sample(
+        exposition,
+        "pandora_suppressed_log_lines_total",
+        "",
+        logger::get_number_suppressed_log_lines());
+
+    auto response = drogon::HttpResponse::newHttpResponse();
+    response->setStatusCode(drogon::k200OK);
+    response->setContentTypeString("text/plain; version=0.0.4; charset=utf-8");
+    response->setBody(std::move(exposition));
+    response_callback(response);
+}
+
+void
+metrics::append_frontline_cache_metrics(
+    std::string& exposition) const
+{
+    const std::vector<storage::cache_statistics> shard_statistics = frontline_cache_.get_shard_statistics();
+
+    pandora::metrics::append_prometheus_metric_header(
+        exposition,
+        "pandora_cache_hits_total",
+        "counter",
+        "Number of gets served from a frontline cache shard.");
+
+    for (std::size_t shard_index = 0u; shard_index < shard_statistics.size(); ++shard_index)
+    {
+        pandora::metrics::append_prometheus_sample(
+            exposition,
+            "pandora_cache_hits_total",
+            std::format("shard=\"{}\"", shard_index),
+            shard_statistics[shard_index].hits_);
+    }
+
+    pandora::metrics::append_prometheus_metric_header(
+        exposition,
+        "pandora_cache_misses_total",
+        "counter",
+        "Number of gets not found in a frontline cache shard.");
+
+    for (std::size_t shard_index = 0u; shard_index < shard_statistics.size(); ++shard_index)
+    {
+        pandora::metrics::append_prometheus_sample(
+            exposition,
+            "pandora_cache_misses_total",
+            std::format("shard=\"{}\"", shard_index),
+            shard_statistics[shard_index].misses_);
+    }
+
+    pandora::metrics::append_prometheus_metric_header(
+        exposition,
+        "pandora_cache_negative_hits_total",
+        "counter",
+        "Number of gets of absent objects served from the negative entries of a frontline cache shard.");
+
+    for (std::size_t shard_index = 0u; shard_index < shard_statistics.size(); ++shard_index)
+    {
+        pandora::metrics::append_prometheus_sample(
+            exposition,
+            "pandora_cache_negative_hits_total",
+            std::format("shard=\"{}\"", shard_index),
+            shard_statistics[shard_index].negative_hits_);
+    }
+
+    //
+    // The ratio is over the lifetime of the process. Recent ratios
+    // are better derived from the rate of the hit and miss counters.
+    //
+    pandora::metrics::append_prometheus_metric_header(
+        exposition,
+        "pandora_cache_hit_ratio",
+        "gauge",
+        "Fraction of gets served from a frontline cache shard since startup.");
+
+    for (std::size_t shard_index = 0u; shard_index < shard_statistics.size(); ++shard_index)
+    {
+        const std::uint64_t number_lookups = shard_statistics[shard_index].hits_ + shard_statistics[shard_index].misses_;
+
+        pandora::metrics::append_prometheus_sample(
+            exposition,
+            "pandora_cache_hit_ratio",
+            std::format("shard=\"{}\"", shard_index),
+            number_lookups == 0u ?
+                0.0 :
+                static_cast<double>(shard_statistics[shard_index].hits_) / static_cast<double>(number_lookups));
+    }
+}
+
+} // namespace endpoints.
+} // namespace network.
+} // namespace pandora.
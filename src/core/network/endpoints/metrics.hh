@@ -0,0 +1,79 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Network
+// 'metrics.hh'
+// Author: jcjuarez
+// Description:
+//     Metrics service endpoint for scraping
+//     the system metrics by Prometheus.
+// ****************************************************
+
+#pragma once
+
+#include <string>
+#include "../../common/aliases.hh"
+#include <drogon/HttpController.h>
+
+namespace pandora
+{
+
+namespace storage
+{
+
+class frontline_cache;
+
+} // namespace storage.
+
+namespace network
+{
+namespace endpoints
+{
+
+class metrics : public drogon::HttpController<metrics, false>
+{
+public:
+
+    //
+    // Endpoint constructor.
+    //
+    metrics(
+        const storage::frontline_cache& frontline_cache);
+
+    //
+    // Mounted at the conventional absolute path expected by Prometheus scrapers.
+    //
+    METHOD_LIST_BEGIN
+        ADD_METHOD_TO(metrics::get_metrics, "/metrics", drogon::Get, "pandora::network::logging_context_filter");
+    METHOD_LIST_END
+
+    //
+    // Replies with all system metrics in the Prometheus text exposition format.
+    //
+    void
+    get_metrics(
+        const http_request& request,
+        server_response_callback&& response_callback);
+
+private:
+
+    //
+    // Appends the per-shard access counters and hit ratio of the frontline cache.
+    //
+    void
+    append_frontline_cache_metrics(
+        std::string& exposition) const;
+
+    //
+    // Frontline cache handle.
+    //
+    const storage::frontline_cache& frontline_cache_;
+};
+
+} // namespace endpoints.
+} // namespace network.
+} // namespace pandora.
@@ -17,6 +17,8 @@
 #include "../server/request-handlers/object/get_object_request_handler.hh"
 #include "../server/request-handlers/object/insert_object_request_handler.hh"
 #include "../server/request-handlers/object/remove_object_request_handler.hh"
+#include "../server/request-handlers/object/scan_objects_request_handler.hh"
+#include "../server/request-handlers/object/object_batch_request_handler.hh"
 
 namespace pandora
 {
@@ -28,10 +30,14 @@ namespace endpoints
 objects::objects(
     std::unique_ptr<insert_object_request_handler> insert_object_request_handler,
     std::unique_ptr<get_object_request_handler> get_object_request_handler,
-    std::unique_ptr<remove_object_request_handler> remove_object_request_handler)
+    std::unique_ptr<remove_object_request_handler> remove_object_request_handler,
+    std::unique_ptr<scan_objects_request_handler> scan_objects_request_handler,
+    std::unique_ptr<object_batch_request_handler> object_batch_request_handler)
     : insert_object_request_handler_{std::move(insert_object_request_handler)},
       get_object_request_handler_{std::move(get_object_request_handler)},
-      remove_object_request_handler_{std::move(remove_object_request_handler)}
+      remove_object_request_handler_{std::move(remove_object_request_handler)},
+      scan_objects_request_handler_{std::move(scan_objects_request_handler)},
+      object_batch_request_handler_{std::move(object_batch_request_handler)}
 {}
 
 void
@@ -64,6 +70,46 @@ objects::remove_object(
         std::move(response_callback));
 }
 
+void
+objects::scan_objects(
+    const http_request& request,
+    server_response_callback&& response_callback)
+{
+    scan_objects_request_handler_->run(
+        request,
+        std::move(response_callback));
+}
+
+void
+objects::insert_objects(
+    const http_request& request,
+    server_response_callback&& response_callback)
+{
+    object_batch_request_handler_->run(
+        request,
+        std::move(response_callback));
+}
+
+void
+objects::get_objects(
+    const http_request& request,
+    server_response_callback&& response_callback)
+{
+    object_batch_request_handler_->run(
+        request,
+        std::move(response_callback));
+}
+
+void
+objects::remove_objects(
+    const http_request& request,
+    server_response_callback&& response_callback)
+{
+    object_batch_request_handler_->run(
+        request,
+        std::move(response_callback));
+}
+
 } // namespace endpoints.
 } // namespace network.
 } // namespace pandora.
\ No newline at end of file
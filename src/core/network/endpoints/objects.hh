@@ -26,6 +26,8 @@ namespace network
 class insert_object_request_handler;
 class get_object_request_handler;
 class remove_object_request_handler;
+class scan_objects_request_handler;
+class object_batch_request_handler;
 
 namespace endpoints
 {
@@ -40,12 +42,18 @@ public:
     objects(
         std::unique_ptr<insert_object_request_handler> insert_object_request_handler,
         std::unique_ptr<get_object_request_handler> get_object_request_handler,
-        std::unique_ptr<remove_object_request_handler> remove_object_request_handler);
+        std::unique_ptr<remove_object_request_handler> remove_object_request_handler,
+        std::unique_ptr<scan_objects_request_handler> scan_objects_request_handler,
+        std::unique_ptr<object_batch_request_handler> object_batch_request_handler);
 
     METHOD_LIST_BEGIN
     METHOD_ADD(objects::insert_object, "", drogon::Post, "pandora::network::logging_context_filter");
     METHOD_ADD(objects::get_object, "", drogon::Get, "pandora::network::logging_context_filter");
     METHOD_ADD(objects::remove_object, "", drogon::Delete, "pandora::network::logging_context_filter");
+    METHOD_ADD(objects::scan_objects, "/scan", drogon::Get, "pandora::network::logging_context_filter");
+    METHOD_ADD(objects::insert_objects, "/batch", drogon::Post, "pandora::network::logging_context_filter");
+    METHOD_ADD(objects::get_objects, "/batch", drogon::Get, "pandora::network::logging_context_filter");
+    METHOD_ADD(objects::remove_objects, "/batch", drogon::Delete, "pandora::network::logging_context_filter");
     METHOD_LIST_END
 
     //
@@ -72,6 +80,38 @@ public:
         const http_request& request,
         server_response_callback&& response_callback);
 
+    //
+    // Streams a page of the objects of an object container in key order.
+    //
+    void
+    scan_objects(
+        const http_request& request,
+        server_response_callback&& response_callback);
+
+    //
+    // Inserts a batch of objects into an object container.
+    //
+    void
+    insert_objects(
+        const http_request& request,
+        server_response_callback&& response_callback);
+
+    //
+    // Retrieves a batch of objects from an object container.
+    //
+    void
+    get_objects(
+        const http_request& request,
+        server_response_callback&& response_callback);
+
+    //
+    // Removes a batch of objects from an object container.
+    //
+    void
+    remove_objects(
+        const http_request& request,
+        server_response_callback&& response_callback);
+
 private:
 
     //
@@ -88,6 +128,16 @@ private:
     // Object removal request handler.
     //
     std::unique_ptr<remove_object_request_handler> remove_object_request_handler_;
+
+    //
+    // Object container scan request handler.
+    //
+    std::unique_ptr<scan_objects_request_handler> scan_objects_request_handler_;
+
+    //
+    // Object batch request handler, shared by all batch optypes.
+    //
+    std::unique_ptr<object_batch_request_handler> object_batch_request_handler_;
 };
 
 } // namespace endpoints.
@@ -15,7 +15,6 @@
 
 #include "../../logger/logging.hh"
 #include "logging_context_filter.hh"
-#include "../../common/uuid_utilities.hh"
 
 namespace pandora
 {
@@ -29,10 +28,10 @@ logging_context_filter::doFilter(
     drogon::FilterChainCallback&& filter_chain_callback)
 {
     //
-    // Apply request logging context.
+    // Apply request logging context. The request ID
+    // is only formatted if a log line is emitted for it.
     //
-    logger::context::request_id.clear();
-    logger::context::request_id = common::uuid_to_string(common::generate_uuid());
+    logger::context::begin_request();
 
     //
     // Execute endpoint.
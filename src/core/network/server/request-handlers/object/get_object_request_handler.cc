@@ -13,8 +13,10 @@
 //      object retrieval requests.
 // ****************************************************
 
+#include <chrono>
 #include "../../server.hh"
 #include "get_object_request_handler.hh"
+#include "../../../../metrics/metrics_registry.hh"
 #include "../../../../storage/management/object_management_service.hh"
 
 namespace pandora
@@ -33,7 +35,7 @@ get_object_request_handler::execute_operation(
     std::shared_ptr<storage::container> container,
     server_response_callback&& response_callback)
 {
-    TRACE_LOG(info, "Read object request received. "
+    TRACE_LOG_SAMPLED(info, k_object_operation_log_sample_rate, "Read object request received. "
         "Optype={}, "
         "ObjectId={}, "
         "ObjectContainerName={}.",
@@ -46,13 +48,13 @@ get_object_request_handler::execute_operation(
     // check the frontline cache. If present, this avoids
     // context-switch overhead and calling the storage engine backend.
     //
-    std::optional<storage::byte_stream> object_data = object_management_service_.get_object_from_frontline_cache(
+    storage::shared_byte_stream object_data = object_management_service_.get_object_from_frontline_cache(
         object_request.get_object_id(),
         object_request.get_container_name());
 
-    if (object_data.has_value())
+    if (object_data != nullptr)
     {
-        TRACE_LOG(info, "Frontline cache has the requested object for get object operation. Completing request. "
+        TRACE_LOG_SAMPLED(info, k_object_operation_log_sample_rate, "Frontline cache has the requested object for get object operation. Completing request. "
             "Optype={}, "
             "ObjectId={}, "
             "ObjectContainerName={}.",
@@ -60,12 +62,51 @@ get_object_request_handler::execute_operation(
             object_request.get_object_id(),
             object_request.get_container_name());
 
-        network::response_fields response_fields;
-        response_fields.emplace(schemas::object_request::object_data_key_tag, &(object_data.value()));
-        network::server::send_response(
+        //
+        // The response references the cached buffer directly. The held
+        // reference keeps it alive even if the entry gets evicted meanwhile.
+        //
+        network::server::send_object_response(
             response_callback,
             status::success,
-            &response_fields);
+            object_request.is_binary_transport(),
+            *object_data);
+
+        metrics::metrics_registry::record_object_operation(
+            schemas::object_request_optype::get,
+            metrics::cache_outcome::hit,
+            status::success,
+            object_request.get_reception_time());
+
+        return;
+    }
+
+    //
+    // Misses on objects recently found absent in the storage engine
+    // are answered from the frontline cache negative entries as well.
+    //
+    if (object_management_service_.is_object_absent_in_frontline_cache(
+            object_request.get_object_id(),
+            object_request.get_container_name()))
+    {
+        TRACE_LOG_SAMPLED(info, k_object_operation_log_sample_rate, "Frontline cache knows the requested object is absent for get object operation. Completing request. "
+            "Optype={}, "
+            "ObjectId={}, "
+            "ObjectContainerName={}.",
+            static_cast<std::uint8_t>(object_request.get_optype()),
+            object_request.get_object_id(),
+            object_request.get_container_name());
+
+        network::server::send_object_response(
+            response_callback,
+            status::object_not_found,
+            object_request.is_binary_transport());
+
+        metrics::metrics_registry::record_object_operation(
+            schemas::object_request_optype::get,
+            metrics::cache_outcome::negative,
+            status::object_not_found,
+            object_request.get_reception_time());
 
         return;
     }
@@ -83,7 +124,7 @@ get_object_request_handler::execute_operation(
 
     if (status::failed(status))
     {
-        TRACE_LOG(error, "Failed to enqueue object get request operation. "
+        TRACE_LOG_RATE_LIMITED(error, k_object_failure_max_log_lines_per_second, "Failed to enqueue object get request operation. "
             "Optype={}, "
             "ObjectId={}, "
             "ObjectContainerName={}, "
@@ -93,9 +134,10 @@ get_object_request_handler::execute_operation(
             object_request.get_container_name(),
             status);
 
-        network::server::send_response(
+        network::server::send_object_response(
             response_callback,
-            status);
+            status,
+            object_request.is_binary_transport());
     }
 }
 
@@ -0,0 +1,104 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Network
+// 'object_batch_request_handler.cc'
+// Author: jcjuarez
+// Description:
+//      Manages the top-level orchestration for
+//      object batch requests.
+// ****************************************************
+
+#include "../../server.hh"
+#include "object_batch_request_handler.hh"
+#include "../../../../storage/models/container.hh"
+#include "../../../../storage/management/object_management_service.hh"
+#include "../../../../schemas/request-interfaces/object_batch_request.hh"
+
+namespace pandora
+{
+namespace network
+{
+
+object_batch_request_handler::object_batch_request_handler(
+    storage::object_management_service& object_management_service)
+    : object_management_service_{object_management_service}
+{}
+
+void
+object_batch_request_handler::run(
+    const http_request& request,
+    server_response_callback&& response_callback)
+{
+    schemas::object_batch_request object_batch_request{request};
+
+    status::status_code status = object_management_service_.validate_object_batch_request(
+        object_batch_request);
+
+    if (status::failed(status))
+    {
+        //
+        // Request validation failed. Do not log the request parameters
+        // here as to avoid logging potentially malformed parameters.
+        // The required logging should be taken care of by the management service.
+        //
+        network::server::send_response(
+            response_callback,
+            status);
+
+        return;
+    }
+
+    std::shared_ptr<storage::container> container =
+        object_management_service_.get_container_reference(object_batch_request.get_container_name());
+
+    //
+    // If the object container is in deleted state, fail the whole batch.
+    //
+    const bool is_container_deleted =
+        container != nullptr ? container->is_deleted() : false;
+
+    if (container == nullptr ||
+        is_container_deleted)
+    {
+        TRACE_LOG(error, "Object container provided for object batch operation "
+            "does not exist or is in deletion process. "
+            "Optype={}, "
+            "ObjectContainerName={}, "
+            "IsDeleted={}.",
+            static_cast<std::uint8_t>(object_batch_request.get_optype()),
+            object_batch_request.get_container_name(),
+            is_container_deleted);
+
+        network::server::send_response(
+            response_callback,
+            status::container_not_exists);
+
+        return;
+    }
+
+    TRACE_LOG(info, "Object batch request received. "
+        "Optype={}, "
+        "ObjectContainerName={}, "
+        "NumberObjects={}.",
+        static_cast<std::uint8_t>(object_batch_request.get_optype()),
+        object_batch_request.get_container_name(),
+        object_batch_request.get_object_requests().size());
+
+    //
+    // At this point, it is guaranteed that ref-counted reference
+    // to the object container is held. The response will be provided
+    // asynchronously over the callback once all objects complete.
+    //
+    object_management_service_.orchestrate_concurrent_batch_request(
+        std::move(object_batch_request),
+        std::move(container),
+        std::move(response_callback));
+}
+
+} // namespace network.
+} // namespace pandora.
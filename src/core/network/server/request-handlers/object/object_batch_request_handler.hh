@@ -0,0 +1,59 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Network
+// 'object_batch_request_handler.hh'
+// Author: jcjuarez
+// Description:
+//      Manages the top-level orchestration for
+//      object batch requests.
+// ****************************************************
+
+#pragma once
+
+#include "../../../../common/aliases.hh"
+
+namespace pandora
+{
+
+namespace storage
+{
+class object_management_service;
+}
+
+namespace network
+{
+
+class object_batch_request_handler
+{
+public:
+
+    //
+    // Constructor.
+    //
+    object_batch_request_handler(
+        storage::object_management_service& object_management_service);
+
+    //
+    // Handles the insertion, retrieval or removal for a batch of objects,
+    // depending on the HTTP method of the request.
+    //
+    void
+    run(
+        const http_request& request,
+        server_response_callback&& response_callback);
+
+private:
+
+    //
+    // Handle for the object management service.
+    //
+    storage::object_management_service& object_management_service_;
+};
+
+} // namespace network.
+} // namespace pandora.
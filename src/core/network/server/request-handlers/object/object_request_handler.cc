@@ -45,9 +45,10 @@ object_request_handler::run(
         // here as to avoid logging potentially malformed parameters.
         // The required logging should be taken care of by the management service.
         //
-        network::server::send_response(
+        network::server::send_object_response(
             response_callback,
-            status);
+            status,
+            object_request.is_binary_transport());
 
         return;
     }
@@ -75,9 +76,10 @@ object_request_handler::run(
             object_request.get_container_name(),
             is_container_deleted);
 
-        network::server::send_response(
+        network::server::send_object_response(
             response_callback,
-            status::container_not_exists);
+            status::container_not_exists,
+            object_request.is_binary_transport());
 
         return;
     }
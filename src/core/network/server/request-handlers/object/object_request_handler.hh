@@ -65,6 +65,16 @@ protected:
     // Handle for the object management service.
     //
     storage::object_management_service& object_management_service_;
+
+    //
+    // Number of successful per-object operations per logged one.
+    //
+    static constexpr std::uint32_t k_object_operation_log_sample_rate = 1'000u;
+
+    //
+    // Maximum number of failed per-object operations logged per second.
+    //
+    static constexpr std::uint32_t k_object_failure_max_log_lines_per_second = 100u;
 };
 
 } // namespace network.
@@ -33,7 +33,7 @@ remove_object_request_handler::execute_operation(
     std::shared_ptr<storage::container> container,
     server_response_callback&& response_callback)
 {
-    TRACE_LOG(info, "Remove object request received. "
+    TRACE_LOG_SAMPLED(info, k_object_operation_log_sample_rate, "Remove object request received. "
         "Optype={}, "
         "ObjectId={}, "
         "ObjectContainerName={}.",
@@ -54,7 +54,7 @@ remove_object_request_handler::execute_operation(
 
     if (status::failed(status))
     {
-        TRACE_LOG(error, "Failed to enqueue object remove request operation. "
+        TRACE_LOG_RATE_LIMITED(error, k_object_failure_max_log_lines_per_second, "Failed to enqueue object remove request operation. "
             "Optype={}, "
             "ObjectId={}, "
             "ObjectContainerName={}, "
@@ -64,9 +64,10 @@ remove_object_request_handler::execute_operation(
             object_request.get_container_name(),
             status);
 
-        network::server::send_response(
+        network::server::send_object_response(
             response_callback,
-            status);
+            status,
+            object_request.is_binary_transport());
     }
 }
 
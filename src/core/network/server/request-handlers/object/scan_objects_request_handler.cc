@@ -0,0 +1,114 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Network
+// 'scan_objects_request_handler.cc'
+// Author: jcjuarez
+// Description:
+//      Manages the top-level orchestration for
+//      object container scan requests.
+// ****************************************************
+
+#include "../../server.hh"
+#include "scan_objects_request_handler.hh"
+#include "../../../../storage/models/container.hh"
+#include "../../../../storage/management/object_management_service.hh"
+#include "../../../../schemas/request-interfaces/container_scan_request.hh"
+
+namespace pandora
+{
+namespace network
+{
+
+scan_objects_request_handler::scan_objects_request_handler(
+    storage::object_management_service& object_management_service)
+    : object_management_service_{object_management_service}
+{}
+
+void
+scan_objects_request_handler::run(
+    const http_request& request,
+    server_response_callback&& response_callback)
+{
+    schemas::container_scan_request container_scan_request{request};
+    std::string start_after_object_id;
+
+    status::status_code status = object_management_service_.validate_container_scan_request(
+        container_scan_request,
+        start_after_object_id);
+
+    if (status::failed(status))
+    {
+        //
+        // Request validation failed. Do not log the request parameters
+        // here as to avoid logging potentially malformed parameters.
+        // The required logging should be taken care of by the management service.
+        //
+        network::server::send_response(
+            response_callback,
+            status);
+
+        return;
+    }
+
+    std::shared_ptr<storage::container> container =
+        object_management_service_.get_container_reference(container_scan_request.get_container_name());
+
+    //
+    // If the object container is in deleted state, fail the operation.
+    //
+    const bool is_container_deleted =
+        container != nullptr ? container->is_deleted() : false;
+
+    if (container == nullptr ||
+        is_container_deleted)
+    {
+        TRACE_LOG(error, "Object container provided for container scan "
+            "does not exist or is in deletion process. "
+            "ObjectContainerName={}, "
+            "IsDeleted={}.",
+            container_scan_request.get_container_name(),
+            is_container_deleted);
+
+        network::server::send_response(
+            response_callback,
+            status::container_not_exists);
+
+        return;
+    }
+
+    TRACE_LOG(info, "Container scan request received. "
+        "ObjectContainerName={}, "
+        "MaxNumberObjects={}, "
+        "IsFirstPage={}.",
+        container_scan_request.get_container_name(),
+        container_scan_request.get_max_number_objects(),
+        start_after_object_id.empty());
+
+    //
+    // The response headers are sent right away and the page body is streamed as
+    // it is read, so the outcome of the page is carried by the status at its end.
+    //
+    const std::uint32_t max_number_objects = container_scan_request.get_max_number_objects();
+    drogon::HttpResponsePtr response = drogon::HttpResponse::newAsyncStreamResponse(
+        [this,
+         start_after_object_id = std::move(start_after_object_id),
+         max_number_objects,
+         container = std::move(container)](server_response_stream response_stream) mutable
+        {
+            object_management_service_.orchestrate_concurrent_container_scan(
+                std::move(start_after_object_id),
+                max_number_objects,
+                std::move(container),
+                std::move(response_stream));
+        });
+    response->setContentTypeCode(drogon::CT_APPLICATION_JSON);
+    response_callback(response);
+}
+
+} // namespace network.
+} // namespace pandora.
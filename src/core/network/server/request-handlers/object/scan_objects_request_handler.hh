@@ -0,0 +1,60 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Network
+// 'scan_objects_request_handler.hh'
+// Author: jcjuarez
+// Description:
+//      Manages the top-level orchestration for
+//      object container scan requests.
+// ****************************************************
+
+#pragma once
+
+#include "../../../../common/aliases.hh"
+
+namespace pandora
+{
+
+namespace storage
+{
+class object_management_service;
+}
+
+namespace network
+{
+
+class scan_objects_request_handler
+{
+public:
+
+    //
+    // Constructor.
+    //
+    scan_objects_request_handler(
+        storage::object_management_service& object_management_service);
+
+    //
+    // Handles a page of an object container scan.
+    // Validation failures are answered with a regular response, while valid
+    // requests are answered with a response stream fed by the read IO thread pool.
+    //
+    void
+    run(
+        const http_request& request,
+        server_response_callback&& response_callback);
+
+private:
+
+    //
+    // Handle for the object management service.
+    //
+    storage::object_management_service& object_management_service_;
+};
+
+} // namespace network.
+} // namespace pandora.
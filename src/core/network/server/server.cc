@@ -15,14 +15,20 @@
 
 #include "server.hh"
 #include "../endpoints/ping.hh"
+#include "../endpoints/admin.hh"
+#include "../endpoints/metrics.hh"
 #include "../endpoints/objects.hh"
 #include "logging_context_filter.hh"
 #include "../endpoints/containers.hh"
 #include "../../common/response_utilities.hh"
 #include "../../storage/cache/frontline_cache.hh"
+#include "../../storage/management/engine_statistics_service.hh"
+#include "../../schemas/request-interfaces/object_request.hh"
 #include "request-handlers/object/get_object_request_handler.hh"
 #include "request-handlers/object/insert_object_request_handler.hh"
 #include "request-handlers/object/remove_object_request_handler.hh"
+#include "request-handlers/object/scan_objects_request_handler.hh"
+#include "request-handlers/object/object_batch_request_handler.hh"
 #include "request-handlers/container/create_container_request_handler.hh"
 #include "request-handlers/container/remove_container_request_handler.hh"
 
@@ -37,7 +43,11 @@ server::server(
     std::unique_ptr<remove_container_request_handler> remove_container_request_handler,
     std::unique_ptr<insert_object_request_handler> insert_object_request_handler,
     std::unique_ptr<get_object_request_handler> get_object_request_handler,
-    std::unique_ptr<remove_object_request_handler> remove_object_request_handler)
+    std::unique_ptr<remove_object_request_handler> remove_object_request_handler,
+    std::unique_ptr<scan_objects_request_handler> scan_objects_request_handler,
+    std::unique_ptr<object_batch_request_handler> object_batch_request_handler,
+    std::unique_ptr<storage::engine_statistics_service> engine_statistics_service,
+    const storage::frontline_cache& frontline_cache)
     : http_server_{drogon::app()},
       server_config_{server_config}
 {
@@ -58,7 +68,11 @@ server::server(
         std::move(remove_container_request_handler),
         std::move(insert_object_request_handler),
         std::move(get_object_request_handler),
-        std::move(remove_object_request_handler));
+        std::move(remove_object_request_handler),
+        std::move(scan_objects_request_handler),
+        std::move(object_batch_request_handler),
+        std::move(engine_statistics_service),
+        frontline_cache);
 }
 
 void
@@ -91,7 +105,11 @@ server::register_endpoints(
     std::unique_ptr<remove_container_request_handler> remove_container_request_handler,
     std::unique_ptr<insert_object_request_handler> insert_object_request_handler,
     std::unique_ptr<get_object_request_handler> get_object_request_handler,
-    std::unique_ptr<remove_object_request_handler> remove_object_request_handler)
+    std::unique_ptr<remove_object_request_handler> remove_object_request_handler,
+    std::unique_ptr<scan_objects_request_handler> scan_objects_request_handler,
+    std::unique_ptr<object_batch_request_handler> object_batch_request_handler,
+    std::unique_ptr<storage::engine_statistics_service> engine_statistics_service,
+    const storage::frontline_cache& frontline_cache)
 {
     //
     // Container endpoint along its request handlers.
@@ -106,25 +124,123 @@ server::register_endpoints(
     http_server_.registerController(std::make_shared<endpoints::objects>(
         std::move(insert_object_request_handler),
         std::move(get_object_request_handler),
-        std::move(remove_object_request_handler)));
+        std::move(remove_object_request_handler),
+        std::move(scan_objects_request_handler),
+        std::move(object_batch_request_handler)));
 
     //
     // Ping endpoint for liveliness probes.
     //
     http_server_.registerController(std::make_shared<endpoints::ping>());
+
+    //
+    // Administration endpoint for runtime adjustments and diagnostics.
+    //
+    http_server_.registerController(std::make_shared<endpoints::admin>(
+        std::move(engine_statistics_service)));
+
+    //
+    // Metrics endpoint for Prometheus scrapes.
+    //
+    http_server_.registerController(std::make_shared<endpoints::metrics>(
+        frontline_cache));
 }
 
 void
 server::send_response(
+    const server_response_callback& response_callback,
+    const status::status_code& status)
+{
+    send_json_response(
+        response_callback,
+        status,
+        common::response_utilities::generate_server_json_response(status));
+}
+
+void
+server::send_json_response(
+    const server_response_callback& response_callback,
+    const status::status_code& status,
+    std::string&& response_body)
+{
+    auto response = drogon::HttpResponse::newHttpResponse();
+    response->setStatusCode(static_cast<drogon::HttpStatusCode>(status.get_http_status_code()));
+    add_retry_after_header(response, status);
+    response->setBody(std::move(response_body));
+    response_callback(response);
+}
+
+void
+server::send_object_response(
     const server_response_callback& response_callback,
     const status::status_code& status,
-    response_fields* response_fields)
+    const bool is_binary_transport,
+    std::optional<std::string_view> object_data)
 {
+    if (!is_binary_transport)
+    {
+        if (!object_data.has_value())
+        {
+            send_response(
+                response_callback,
+                status);
+
+            return;
+        }
+
+        //
+        // Object data stored over the binary transport may not be valid UTF-8.
+        // It is never altered to fit in JSON, so the client is pointed to the binary transport instead.
+        //
+        if (!common::response_utilities::is_json_representable(*object_data))
+        {
+            send_response(
+                response_callback,
+                status::object_data_not_json_representable);
+
+            return;
+        }
+
+        //
+        // The object data is escaped straight from its source buffer,
+        // which may be a pinned storage engine block, into the response body.
+        //
+        send_json_response(
+            response_callback,
+            status,
+            common::response_utilities::generate_server_json_response(
+                status,
+                {{schemas::object_request::object_data_key_tag, *object_data}}));
+
+        return;
+    }
+
     auto response = drogon::HttpResponse::newHttpResponse();
     response->setStatusCode(static_cast<drogon::HttpStatusCode>(status.get_http_status_code()));
-    response->setBody(common::response_utilities::generate_server_json_response(status.get_internal_status_code(), response_fields));
+    response->addHeader(internal_status_code_header_tag, std::string{status.get_internal_status_code_string()});
+    add_retry_after_header(response, status);
+    response->setContentTypeCode(drogon::CT_APPLICATION_OCTET_STREAM);
+
+    if (object_data.has_value())
+    {
+        response->setBody(
+            object_data->data(),
+            object_data->size());
+    }
+
     response_callback(response);
 }
 
+void
+server::add_retry_after_header(
+    const drogon::HttpResponsePtr& response,
+    const status::status_code& status)
+{
+    if (status == status::write_io_queue_full)
+    {
+        response->addHeader(retry_after_header_tag, std::to_string(k_retry_after_seconds));
+    }
+}
+
 } // namespace network.
 } // namespace pandora.
\ No newline at end of file
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <optional>
+#include <string_view>
 #include <unordered_map>
 #include <drogon/drogon.h>
 #include "../../status/status.hh"
@@ -23,6 +25,15 @@
 
 namespace pandora
 {
+
+namespace storage
+{
+
+class frontline_cache;
+class engine_statistics_service;
+
+} // namespace storage.
+
 namespace network
 {
 
@@ -31,6 +42,8 @@ class remove_container_request_handler;
 class insert_object_request_handler;
 class get_object_request_handler;
 class remove_object_request_handler;
+class scan_objects_request_handler;
+class object_batch_request_handler;
 
 //
 // Main HTTP server wrapper.
@@ -50,7 +63,11 @@ public:
         std::unique_ptr<remove_container_request_handler> remove_container_request_handler,
         std::unique_ptr<insert_object_request_handler> insert_object_request_handler,
         std::unique_ptr<get_object_request_handler> get_object_request_handler,
-        std::unique_ptr<remove_object_request_handler> remove_object_request_handler);
+        std::unique_ptr<remove_object_request_handler> remove_object_request_handler,
+        std::unique_ptr<scan_objects_request_handler> scan_objects_request_handler,
+        std::unique_ptr<object_batch_request_handler> object_batch_request_handler,
+        std::unique_ptr<storage::engine_statistics_service> engine_statistics_service,
+        const storage::frontline_cache& frontline_cache);
 
     //
     // Starts the HTTP server for processing storage requests.
@@ -76,7 +93,11 @@ public:
         std::unique_ptr<remove_container_request_handler> remove_container_request_handler,
         std::unique_ptr<insert_object_request_handler> insert_object_request_handler,
         std::unique_ptr<get_object_request_handler> get_object_request_handler,
-        std::unique_ptr<remove_object_request_handler> remove_object_request_handler);
+        std::unique_ptr<remove_object_request_handler> remove_object_request_handler,
+        std::unique_ptr<scan_objects_request_handler> scan_objects_request_handler,
+        std::unique_ptr<object_batch_request_handler> object_batch_request_handler,
+        std::unique_ptr<storage::engine_statistics_service> engine_statistics_service,
+        const storage::frontline_cache& frontline_cache);
 
     //
     // Sends back a response to a client over a provided response_callback.
@@ -84,12 +105,62 @@ public:
     static
     void
     send_response(
+        const server_response_callback& response_callback,
+        const status::status_code& status);
+
+    //
+    // Sends back a response with an already serialized JSON body to a client
+    // over a provided response_callback. The body must carry the internal status code.
+    //
+    static
+    void
+    send_json_response(
+        const server_response_callback& response_callback,
+        const status::status_code& status,
+        std::string&& response_body);
+
+    //
+    // Sends back the response for a single object operation to a client over a provided
+    // response_callback. The object data is only given for successful get operations.
+    // In the binary transport, the raw object data is the body and the internal status code
+    // goes into a header, so no JSON document is built; the JSON transport is used otherwise.
+    // The object data is copied into the response, so it only needs to outlive this call.
+    //
+    static
+    void
+    send_object_response(
         const server_response_callback& response_callback,
         const status::status_code& status,
-        response_fields* response_fields = nullptr);
+        const bool is_binary_transport,
+        std::optional<std::string_view> object_data = std::nullopt);
+
+    //
+    // Response header carrying the internal status code in the binary transport.
+    //
+    static constexpr const char* internal_status_code_header_tag = "x-pandora-internal-status-code";
+
+    //
+    // Response header hinting clients when to retry an operation rejected under overload.
+    //
+    static constexpr const char* retry_after_header_tag = "Retry-After";
 
 private:
 
+    //
+    // Adds the retry hint to responses whose status signals a transient overload.
+    //
+    static
+    void
+    add_retry_after_header(
+        const drogon::HttpResponsePtr& response,
+        const status::status_code& status);
+
+    //
+    // Seconds clients are told to wait before retrying an operation rejected under overload.
+    // Write IO queues drain within milliseconds, so the smallest hint the header allows is used.
+    //
+    static constexpr std::uint32_t k_retry_after_seconds = 1u;
+
     //
     // Reference to the underlying HTTP server.
     //
@@ -0,0 +1,78 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Schemas
+// 'container_scan_request.cc'
+// Author: jcjuarez
+// Description:
+//      Request interface for scanning the
+//      objects of an object container.
+// ****************************************************
+
+#include <charconv>
+#include "container_scan_request.hh"
+
+namespace pandora
+{
+namespace schemas
+{
+
+container_scan_request::container_scan_request(
+    const drogon::HttpRequestPtr& request)
+    : max_number_objects_{0u}
+{
+    const auto json = request->getJsonObject();
+
+    if (json)
+    {
+        //
+        // Parse the JSON into the system interface.
+        //
+        container_name_ = (*json)[container_name_key_tag].asString();
+        continuation_token_ = (*json)[continuation_token_key_tag].asString();
+
+        if ((*json)[max_number_objects_key_tag].isUInt())
+        {
+            max_number_objects_ = (*json)[max_number_objects_key_tag].asUInt();
+        }
+
+        return;
+    }
+
+    //
+    // Scans are usually paged through by following links, so also take the query parameters.
+    // A malformed maximum number of objects is treated as not specified.
+    //
+    container_name_ = request->getParameter(container_name_key_tag);
+    continuation_token_ = request->getParameter(continuation_token_key_tag);
+    const std::string& max_number_objects = request->getParameter(max_number_objects_key_tag);
+    std::from_chars(
+        max_number_objects.data(),
+        max_number_objects.data() + max_number_objects.size(),
+        max_number_objects_);
+}
+
+const std::string&
+container_scan_request::get_container_name() const
+{
+    return container_name_;
+}
+
+const std::string&
+container_scan_request::get_continuation_token() const
+{
+    return continuation_token_;
+}
+
+std::uint32_t
+container_scan_request::get_max_number_objects() const
+{
+    return max_number_objects_;
+}
+
+} // namespace schemas.
+} // namespace pandora.
@@ -0,0 +1,97 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Schemas
+// 'container_scan_request.hh'
+// Author: jcjuarez
+// Description:
+//      Request interface for scanning the
+//      objects of an object container.
+// ****************************************************
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <drogon/HttpController.h>
+
+namespace pandora
+{
+namespace schemas
+{
+
+//
+// Structure for holding the request
+// data for a container scan page.
+//
+class container_scan_request
+{
+public:
+
+    //
+    // Constructor for the request interface.
+    // The fields are taken from the JSON body if present, or from the query parameters otherwise.
+    //
+    container_scan_request(
+        const drogon::HttpRequestPtr& request);
+
+    //
+    // Gets the object container name.
+    // Returns an immutable reference to the container name.
+    //
+    const std::string&
+    get_container_name() const;
+
+    //
+    // Gets the opaque continuation token returned by the previous page.
+    // Empty for the first page of the scan.
+    //
+    const std::string&
+    get_continuation_token() const;
+
+    //
+    // Gets the maximum number of objects requested for the page.
+    // Zero if the client did not specify it.
+    //
+    std::uint32_t
+    get_max_number_objects() const;
+
+    //
+    // Expected object container name key tag in the client request.
+    //
+    static constexpr const char* container_name_key_tag = "container_name";
+
+    //
+    // Expected continuation token key tag in the client request and the response.
+    //
+    static constexpr const char* continuation_token_key_tag = "continuation_token";
+
+    //
+    // Expected maximum number of objects key tag in the client request.
+    //
+    static constexpr const char* max_number_objects_key_tag = "max_number_objects";
+
+private:
+
+    //
+    // Object container name.
+    //
+    std::string container_name_;
+
+    //
+    // Opaque continuation token.
+    //
+    std::string continuation_token_;
+
+    //
+    // Maximum number of objects requested for the page.
+    //
+    std::uint32_t max_number_objects_;
+};
+
+} // namespace schemas.
+} // namespace pandora.
@@ -0,0 +1,51 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Schemas
+// 'log_level_request.cc'
+// Author: jcjuarez
+// Description:
+//      Structure for defining a log level change
+//      from a network request.
+// ****************************************************
+
+#include "log_level_request.hh"
+
+namespace pandora
+{
+namespace schemas
+{
+
+log_level_request::log_level_request(
+    const drogon::HttpRequestPtr& request)
+{
+    const auto json = request->getJsonObject();
+
+    if (json)
+    {
+        //
+        // Parse the JSON into the system interface.
+        //
+        log_subsystem_name_ = (*json)[log_subsystem_key_tag].asString();
+        log_level_name_ = (*json)[log_level_key_tag].asString();
+    }
+}
+
+const std::string&
+log_level_request::get_log_subsystem_name() const
+{
+    return log_subsystem_name_;
+}
+
+const std::string&
+log_level_request::get_log_level_name() const
+{
+    return log_level_name_;
+}
+
+} // namespace schemas.
+} // namespace pandora.
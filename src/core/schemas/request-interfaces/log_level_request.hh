@@ -0,0 +1,77 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Schemas
+// 'log_level_request.hh'
+// Author: jcjuarez
+// Description:
+//      Structure for defining a log level change
+//      from a network request.
+// ****************************************************
+
+#pragma once
+
+#include <string>
+#include <drogon/HttpController.h>
+
+namespace pandora
+{
+namespace schemas
+{
+
+//
+// Structure for holding the request
+// data for a log level change.
+//
+class log_level_request
+{
+public:
+
+    //
+    // Constructor for the request interface.
+    //
+    log_level_request(
+        const drogon::HttpRequestPtr& request);
+
+    //
+    // Gets the name of the log subsystem to change.
+    // An empty name applies the change to all subsystems.
+    //
+    const std::string&
+    get_log_subsystem_name() const;
+
+    //
+    // Gets the name of the new log level.
+    //
+    const std::string&
+    get_log_level_name() const;
+
+    //
+    // Expected log subsystem key tag in the client request.
+    //
+    static constexpr const char* log_subsystem_key_tag = "log_subsystem";
+
+    //
+    // Expected log level key tag in the client request.
+    //
+    static constexpr const char* log_level_key_tag = "log_level";
+
+private:
+
+    //
+    // Name of the log subsystem to change.
+    //
+    std::string log_subsystem_name_;
+
+    //
+    // Name of the new log level.
+    //
+    std::string log_level_name_;
+};
+
+} // namespace schemas.
+} // namespace pandora.
@@ -0,0 +1,135 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Schemas
+// 'object_batch_request.cc'
+// Author: jcjuarez
+// Description:
+//      Structure for defining a batch of objects
+//      of the same container from a network request.
+// ****************************************************
+
+#include "object_batch_request.hh"
+
+namespace pandora
+{
+namespace schemas
+{
+
+object_batch_request::object_batch_request(
+    const drogon::HttpRequestPtr& request)
+    : optype_{object_request::get_optype_from_method(request->getMethod())}
+{
+    const auto reception_time = std::chrono::steady_clock::now();
+    const std::shared_ptr<Json::Value>& json = request->getJsonObject();
+
+    if (!json)
+    {
+        return;
+    }
+
+    container_name_ = (*json)[container_name_key_tag].asString();
+
+    const Json::Value& objects = (*json)[objects_key_tag];
+
+    if (!objects.isArray())
+    {
+        return;
+    }
+
+    //
+    // Parse every object into its own object request. Each one gets a copy
+    // of the container name, as the object requests are consumed independently.
+    //
+    object_requests_.reserve(objects.size());
+
+    //
+    // All objects of the batch share the deadline given by the client for the whole request,
+    // and are measured from the reception of the whole request.
+    //
+    const std::chrono::steady_clock::time_point deadline = object_request::get_deadline_from_request(request);
+
+    for (const Json::Value& object : objects)
+    {
+        if (!object.isObject())
+        {
+            //
+            // Keep the position of malformed entries, so they
+            // get failed individually by the object validations.
+            //
+            object_requests_.emplace_back(
+                std::string{},
+                storage::byte_stream{},
+                std::string{container_name_},
+                optype_,
+                deadline,
+                reception_time);
+
+            continue;
+        }
+
+        //
+        // String object data is referenced in place within the parsed document,
+        // which is kept alive by every object request borrowing from it.
+        //
+        const Json::Value& object_data_value = object[object_request::object_data_key_tag];
+        const char* object_data_begin = nullptr;
+        const char* object_data_end = nullptr;
+
+        if (object_data_value.isString() &&
+            object_data_value.getString(&object_data_begin, &object_data_end))
+        {
+            object_requests_.emplace_back(
+                object[object_request::object_id_key_tag].asString(),
+                std::string_view{
+                    object_data_begin,
+                    static_cast<std::size_t>(object_data_end - object_data_begin)},
+                json,
+                std::string{container_name_},
+                optype_,
+                deadline,
+                reception_time);
+
+            continue;
+        }
+
+        object_requests_.emplace_back(
+            object[object_request::object_id_key_tag].asString(),
+            object_data_value.asString(),
+            std::string{container_name_},
+            optype_,
+            deadline,
+            reception_time);
+    }
+}
+
+const std::string&
+object_batch_request::get_container_name() const
+{
+    return container_name_;
+}
+
+const std::vector<object_request>&
+object_batch_request::get_object_requests() const
+{
+    return object_requests_;
+}
+
+std::vector<object_request>&
+object_batch_request::get_object_requests_mutable()
+{
+    return object_requests_;
+}
+
+object_request_optype
+object_batch_request::get_optype() const
+{
+    return optype_;
+}
+
+} // namespace schemas.
+} // namespace pandora.
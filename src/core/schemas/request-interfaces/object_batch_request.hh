@@ -0,0 +1,98 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Schemas
+// 'object_batch_request.hh'
+// Author: jcjuarez
+// Description:
+//      Structure for defining a batch of objects
+//      of the same container from a network request.
+// ****************************************************
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <drogon/HttpController.h>
+#include "object_request.hh"
+
+namespace pandora
+{
+namespace schemas
+{
+
+//
+// Structure for holding the request data for a batch of
+// objects. All objects of a batch share the same optype and container.
+//
+class object_batch_request
+{
+public:
+
+    //
+    // Constructor for the request interface.
+    //
+    object_batch_request(
+        const drogon::HttpRequestPtr& request);
+
+    //
+    // Gets the object container name.
+    // Returns an immutable reference to the container name.
+    //
+    const std::string&
+    get_container_name() const;
+
+    //
+    // Gets the object requests of the batch.
+    // Returns an immutable reference to the object requests.
+    //
+    const std::vector<object_request>&
+    get_object_requests() const;
+
+    //
+    // Gets the object requests of the batch.
+    // Returns a mutable reference to the object requests.
+    //
+    std::vector<object_request>&
+    get_object_requests_mutable();
+
+    //
+    // Gets the object batch request optype.
+    //
+    object_request_optype
+    get_optype() const;
+
+    //
+    // Expected object container name key tag in the client request.
+    //
+    static constexpr const char* container_name_key_tag = "container_name";
+
+    //
+    // Expected objects list key tag in the client request and the response.
+    //
+    static constexpr const char* objects_key_tag = "objects";
+
+private:
+
+    //
+    // Object container name.
+    //
+    std::string container_name_;
+
+    //
+    // Object requests of the batch, in the order given by the client.
+    //
+    std::vector<object_request> object_requests_;
+
+    //
+    // Optype for all the object operations of the batch.
+    //
+    object_request_optype optype_;
+};
+
+} // namespace schemas.
+} // namespace pandora.
@@ -13,6 +13,7 @@
 //      from a network request.
 // ****************************************************
 
+#include <charconv>
 #include "object_request.hh"
 
 namespace pandora
@@ -23,62 +24,129 @@ namespace schemas
 object_request::object_request(
     const drogon::HttpRequestPtr& request)
     : object_{nullptr},
-      optype_{object_request_optype::invalid}
+      optype_{object_request_optype::invalid},
+      is_binary_transport_{is_binary_transport_request(request)},
+      deadline_{get_deadline_from_request(request)},
+      reception_time_{std::chrono::steady_clock::now()}
 {
-    const auto json = request->getJsonObject();
-
     std::string object_id{};
-    storage::byte_stream object_data{};
     std::string container_name{};
 
-    if (json)
+    //
+    // The object data is borrowed from the request wherever possible, with the owner
+    // of its buffer held as a keepalive, so it reaches the storage engine without copies.
+    //
+    std::string_view object_data{};
+    std::shared_ptr<const void> object_data_keepalive{nullptr};
+    storage::byte_stream owned_object_data{};
+
+    if (is_binary_transport_)
+    {
+        //
+        // The body is the raw object data, so no JSON document is built and
+        // the data needs no escaping. The rest of the parameters are out of band.
+        //
+        object_id = get_binary_transport_parameter(request, object_id_key_tag, object_id_header_tag);
+        container_name = get_binary_transport_parameter(request, container_name_key_tag, container_name_header_tag);
+        object_data = request->body();
+        object_data_keepalive = request;
+    }
+    else if (const std::shared_ptr<Json::Value>& json = request->getJsonObject())
     {
         //
         // Parse the JSON object and transfer
         // the object data into the system interface.
         //
         object_id = std::move((*json)[object_id_key_tag].asString());
-        object_data = std::move((*json)[object_data_key_tag].asString());
         container_name = std::move((*json)[container_name_key_tag].asString());
-    }
 
-    //
-    // Allocate the object with the fields from the request, if any.
-    //
-    object_ = std::make_unique<storage::object>(
-        std::move(object_id),
-        std::move(object_data),
-        std::move(container_name));
+        //
+        // String values are referenced in place within the parsed document.
+        // Any other value type gets converted into an owned byte stream.
+        //
+        const Json::Value& object_data_value = (*json)[object_data_key_tag];
+        const char* object_data_begin = nullptr;
+        const char* object_data_end = nullptr;
 
-    switch (request->getMethod())
-    {
-        case drogon::HttpMethod::Post:
+        if (object_data_value.isString() &&
+            object_data_value.getString(&object_data_begin, &object_data_end))
         {
-            optype_ = object_request_optype::insert;
-            break;
+            object_data = std::string_view{
+                object_data_begin,
+                static_cast<std::size_t>(object_data_end - object_data_begin)};
+            object_data_keepalive = json;
         }
-        case drogon::HttpMethod::Get:
+        else
         {
-            optype_ = object_request_optype::get;
-            break;
-        }
-        case drogon::HttpMethod::Delete:
-        {
-            optype_ = object_request_optype::remove;
-            break;
-        }
-        default:
-        {
-            optype_ = object_request_optype::invalid;
-            break;
+            owned_object_data = object_data_value.asString();
         }
     }
+
+    //
+    // Allocate the object with the fields from the request, if any.
+    //
+    if (object_data_keepalive != nullptr)
+    {
+        object_ = std::make_unique<storage::object>(
+            std::move(object_id),
+            object_data,
+            std::move(object_data_keepalive),
+            std::move(container_name));
+    }
+    else
+    {
+        object_ = std::make_unique<storage::object>(
+            std::move(object_id),
+            std::move(owned_object_data),
+            std::move(container_name));
+    }
+
+    optype_ = get_optype_from_method(request->getMethod());
 }
 
+object_request::object_request(
+    std::string&& object_id,
+    storage::byte_stream&& object_data,
+    std::string&& container_name,
+    const object_request_optype optype,
+    const std::chrono::steady_clock::time_point deadline,
+    const std::chrono::steady_clock::time_point reception_time)
+    : object_{std::make_unique<storage::object>(
+          std::move(object_id),
+          std::move(object_data),
+          std::move(container_name))},
+      optype_{optype},
+      is_binary_transport_{false},
+      deadline_{deadline},
+      reception_time_{reception_time}
+{}
+
+object_request::object_request(
+    std::string&& object_id,
+    std::string_view object_data,
+    std::shared_ptr<const void> object_data_keepalive,
+    std::string&& container_name,
+    const object_request_optype optype,
+    const std::chrono::steady_clock::time_point deadline,
+    const std::chrono::steady_clock::time_point reception_time)
+    : object_{std::make_unique<storage::object>(
+          std::move(object_id),
+          object_data,
+          std::move(object_data_keepalive),
+          std::move(container_name))},
+      optype_{optype},
+      is_binary_transport_{false},
+      deadline_{deadline},
+      reception_time_{reception_time}
+{}
+
 object_request::object_request(
     object_request&& other)
     : object_{std::move(other.object_)},
-      optype_{other.optype_}
+      optype_{other.optype_},
+      is_binary_transport_{other.is_binary_transport_},
+      deadline_{other.deadline_},
+      reception_time_{other.reception_time_}
 {}
 
 const std::string&
@@ -93,7 +161,7 @@ object_request::get_object_id() const
     return object_->get_object_id();
 }
 
-const storage::byte_stream&
+std::string_view
 object_request::get_object_data() const
 {
     return object_->get_object_data();
@@ -111,10 +179,10 @@ object_request::get_object_id_mutable()
     return object_->get_object_id();
 }
 
-storage::byte_stream&
-object_request::get_object_data_mutable()
+storage::byte_stream
+object_request::take_object_data()
 {
-    return object_->get_object_data();
+    return object_->take_object_data();
 }
 
 object_request_optype
@@ -123,5 +191,97 @@ object_request::get_optype() const
     return optype_;
 }
 
+bool
+object_request::is_binary_transport() const
+{
+    return is_binary_transport_;
+}
+
+std::chrono::steady_clock::time_point
+object_request::get_deadline() const
+{
+    return deadline_;
+}
+
+std::chrono::steady_clock::time_point
+object_request::get_reception_time() const
+{
+    return reception_time_;
+}
+
+object_request_optype
+object_request::get_optype_from_method(
+    const drogon::HttpMethod method)
+{
+    switch (method)
+    {
+        case drogon::HttpMethod::Post:
+        {
+            return object_request_optype::insert;
+        }
+        case drogon::HttpMethod::Get:
+        {
+            return object_request_optype::get;
+        }
+        case drogon::HttpMethod::Delete:
+        {
+            return object_request_optype::remove;
+        }
+        default:
+        {
+            return object_request_optype::invalid;
+        }
+    }
+}
+
+std::chrono::steady_clock::time_point
+object_request::get_deadline_from_request(
+    const drogon::HttpRequestPtr& request)
+{
+    const std::string& deadline_header = request->getHeader(deadline_header_tag);
+    const char* deadline_header_end = deadline_header.data() + deadline_header.size();
+    std::uint32_t deadline_ms = 0u;
+    const auto [parse_end, parse_error] = std::from_chars(
+        deadline_header.data(),
+        deadline_header_end,
+        deadline_ms);
+
+    if (parse_error != std::errc{} ||
+        parse_end != deadline_header_end ||
+        deadline_ms == 0u)
+    {
+        return std::chrono::steady_clock::time_point::max();
+    }
+
+    //
+    // The deadline is relative, so it does not depend on the clocks of client and server agreeing.
+    //
+    return std::chrono::steady_clock::now() + std::chrono::milliseconds(deadline_ms);
+}
+
+bool
+object_request::is_binary_transport_request(
+    const drogon::HttpRequestPtr& request)
+{
+    //
+    // Get requests carry no body, so their transport is chosen through the accepted media type.
+    //
+    return request->getContentType() == drogon::CT_APPLICATION_OCTET_STREAM ||
+           request->getHeader("accept").find(binary_transport_media_type) != std::string::npos;
+}
+
+std::string
+object_request::get_binary_transport_parameter(
+    const drogon::HttpRequestPtr& request,
+    const char* key_tag,
+    const char* header_tag)
+{
+    const std::string& parameter = request->getParameter(key_tag);
+
+    return parameter.empty() ?
+        request->getHeader(header_tag) :
+        parameter;
+}
+
 } // namespace schemas.
 } // namespace pandora.
\ No newline at end of file
@@ -15,7 +15,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <string>
+#include <memory>
+#include <string_view>
 #include <cstdint>
 #include <drogon/HttpController.h>
 #include "../../common/aliases.hh"
@@ -41,6 +44,30 @@ public:
     object_request(
         const drogon::HttpRequestPtr& request);
 
+    //
+    // Constructor for a single object of a batch request.
+    //
+    object_request(
+        std::string&& object_id,
+        storage::byte_stream&& object_data,
+        std::string&& container_name,
+        const object_request_optype optype,
+        const std::chrono::steady_clock::time_point deadline,
+        const std::chrono::steady_clock::time_point reception_time);
+
+    //
+    // Constructor for a single object of a batch request
+    // whose data is borrowed from a buffer held alive by the keepalive.
+    //
+    object_request(
+        std::string&& object_id,
+        std::string_view object_data,
+        std::shared_ptr<const void> object_data_keepalive,
+        std::string&& container_name,
+        const object_request_optype optype,
+        const std::chrono::steady_clock::time_point deadline,
+        const std::chrono::steady_clock::time_point reception_time);
+
     //
     // Move constructor for the request interface.
     //
@@ -63,9 +90,9 @@ public:
 
     //
     // Gets the object data.
-    // Returns an immutable reference to the byte stream.
+    // Returns a view over the byte stream, which may be borrowed from the request body.
     //
-    const storage::byte_stream&
+    std::string_view
     get_object_data() const;
 
     //
@@ -83,11 +110,11 @@ public:
     get_object_id_mutable();
 
     //
-    // Gets the object data.
-    // Returns a mutable reference to the byte stream.
+    // Takes the object data out of the request.
+    // Borrowed data is copied, as it only lives as long as the request.
     //
-    storage::byte_stream&
-    get_object_data_mutable();
+    storage::byte_stream
+    take_object_data();
 
     //
     // Gets the object request optype.
@@ -95,6 +122,43 @@ public:
     object_request_optype
     get_optype() const;
 
+    //
+    // Checks whether the request uses the binary transport, where the object
+    // data is the raw body and the rest of the parameters are out of band.
+    //
+    bool
+    is_binary_transport() const;
+
+    //
+    // Gets the time after which the client no longer waits for the outcome of the operation.
+    //
+    std::chrono::steady_clock::time_point
+    get_deadline() const;
+
+    //
+    // Gets the time at which the request was received, before being parsed.
+    // Latencies of object operations are measured from it, whatever their outcome.
+    //
+    std::chrono::steady_clock::time_point
+    get_reception_time() const;
+
+    //
+    // Gets the object request optype corresponding to an HTTP method.
+    //
+    static
+    object_request_optype
+    get_optype_from_method(
+        const drogon::HttpMethod method);
+
+    //
+    // Gets the deadline of a request from the deadline header, relative to the current time.
+    // Requests without a well-formed, non-zero deadline header never expire.
+    //
+    static
+    std::chrono::steady_clock::time_point
+    get_deadline_from_request(
+        const drogon::HttpRequestPtr& request);
+
     //
     // Expected object container name key tag in the client request.
     //
@@ -110,8 +174,49 @@ public:
     //
     static constexpr const char* object_data_key_tag = "object_data";
 
+    //
+    // Expected object container name header tag in binary transport requests.
+    // The container name can also be given as a query parameter.
+    //
+    static constexpr const char* container_name_header_tag = "x-pandora-container-name";
+
+    //
+    // Expected object ID header tag in binary transport requests.
+    // The object ID can also be given as a query parameter, which allows arbitrary bytes.
+    //
+    static constexpr const char* object_id_header_tag = "x-pandora-object-id";
+
+    //
+    // Media type of the binary transport for object requests and responses.
+    //
+    static constexpr const char* binary_transport_media_type = "application/octet-stream";
+
+    //
+    // Optional header tag with the number of milliseconds the client waits for the outcome
+    // of the operation. Operations still queued after that are dropped without being executed.
+    //
+    static constexpr const char* deadline_header_tag = "x-pandora-deadline-ms";
+
 private:
 
+    //
+    // Checks whether the client either sent a binary body or accepts a binary response.
+    //
+    static
+    bool
+    is_binary_transport_request(
+        const drogon::HttpRequestPtr& request);
+
+    //
+    // Gets a binary transport parameter from the query string, or from the headers otherwise.
+    //
+    static
+    std::string
+    get_binary_transport_parameter(
+        const drogon::HttpRequestPtr& request,
+        const char* key_tag,
+        const char* header_tag);
+
     //
     // Owning object data contents.
     //
@@ -121,6 +226,21 @@ private:
     // Optype for the object operation.
     //
     object_request_optype optype_;
+
+    //
+    // Whether the request uses the binary transport.
+    //
+    bool is_binary_transport_;
+
+    //
+    // Time after which the client no longer waits for the outcome of the operation.
+    //
+    std::chrono::steady_clock::time_point deadline_;
+
+    //
+    // Time at which the request was received.
+    //
+    std::chrono::steady_clock::time_point reception_time_;
 };
 
 } // namespace schemas.
@@ -12,6 +12,7 @@
 //      Arranges and composes all data collocations.
 // ****************************************************
 
+#include <algorithm>
 #include "collocation_builder.hh"
 #include "../storage/io/storage_engine.hh"
 #include "../storage/io/data_partition.hh"
@@ -24,6 +25,8 @@
 #include "../storage/io/threading_context_table.hh"
 #include "../storage/io/data_partition_provider.hh"
 #include "../storage/io/threading_context_provider.hh"
+#include "../storage/io/storage_engine_resources.hh"
+#include "../common/work_stealing_thread_pool.hh"
 
 namespace pandora
 {
@@ -41,22 +44,34 @@ collocation_builder::generate_collocation_topology(
     const storage_configuration& storage_configuration,
     cache_accessor& cache_accessor)
 {
+    //
+    // Storage engine resources shared by all data partitions, including the metadata partition.
+    // A single block cache, write buffer manager and set of background thread pools
+    // keep the engine memory and background work independent of the number of partitions.
+    // The metadata partition is opened against them as well.
+    //
+    auto storage_engine_resources = std::make_shared<const storage::storage_engine_resources>(
+        storage_configuration,
+        storage_configuration.number_collocations_ + 1u);
+
     //
     // The system should create the same number of topology subtypes.
     // This is crucial as to maintain IO requirements for the storage engine.
     //
+    const std::uint16_t number_collocations = storage_configuration.number_collocations_;
     auto metadata_partition = std::make_unique<storage::data_partition>(
         k_metadata_partition_prefix,
-        k_number_collocations, /* The index for the containers metadata corresponds to the Kth collocation. */
+        number_collocations, /* The index for the containers metadata corresponds to the Kth collocation. */
         storage_configuration,
-        std::make_unique<storage::storage_engine>());
+        std::make_unique<storage::storage_engine>(),
+        storage_engine_resources);
 
     //
     // Collocation resolver.
     // This routes all object keys to their respective data partitions or threading contexts.
     //
     auto collocation_resolver = std::make_unique<storage::collocation_resolver>(
-        k_number_collocations);
+        number_collocations);
 
     //
     // Populate data partitions and threading contexts tables.
@@ -71,32 +86,48 @@ collocation_builder::generate_collocation_topology(
     // Data partitions construction.
     //
     auto data_partitions_table = std::make_unique<data_partition_table>();
-    for (std::uint16_t collocation_index = 0u; collocation_index < k_number_collocations; ++collocation_index)
+    for (std::uint16_t collocation_index = 0u; collocation_index < number_collocations; ++collocation_index)
     {
         data_partitions_table->append_partition(
             k_structured_partition_prefix,
             collocation_index,
             storage_configuration,
-            std::make_unique<storage::storage_engine>());
-
-
+            std::make_unique<storage::storage_engine>(),
+            storage_engine_resources);
     }
     auto data_partitions_provider = std::make_unique<data_partition_provider>(
         std::move(data_partitions_table));
 
     //
     // Threading contexts construction.
+    // All read IO dispatchers share a single work-stealing thread pool, so a skewed
+    // read load on a few collocations can still use every read IO thread. The pool
+    // is capped to the number of logical cores given the storage engine reads are CPU-bound.
     //
-    auto threading_contexts_table = std::make_unique<threading_context_table>();
-    for (std::uint16_t collocation_index = 0u; collocation_index < k_number_collocations; ++collocation_index)
+    const std::uint32_t number_logical_cores = std::max(std::thread::hardware_concurrency(), 1u);
+    auto read_io_thread_pool = std::make_unique<common::work_stealing_thread_pool>(
+        std::min(storage_configuration.number_read_io_threads_, number_logical_cores),
+        "pandora_read");
+    auto threading_contexts_table = std::make_unique<threading_context_table>(
+        std::move(read_io_thread_pool));
+    for (std::uint16_t collocation_index = 0u; collocation_index < number_collocations; ++collocation_index)
     {
         auto read_io_task_executor = std::make_unique<read_io_executor>(
             *data_partitions_provider);
         auto read_io_task_dispatcher = std::make_unique<read_io_dispatcher>(
-            storage_configuration.number_read_io_threads_,
+            collocation_index,
+            storage_configuration.read_io_batch_max_number_tasks_,
+            storage_configuration.read_io_batch_max_wait_time_us_,
+            threading_contexts_table->get_read_io_thread_pool(),
             std::move(read_io_task_executor),
             cache_accessor);
         auto write_io_task_dispatcher = std::make_unique<write_io_dispatcher>(
+            collocation_index,
+            storage_configuration.write_io_batch_max_number_tasks_,
+            storage_configuration.write_io_batch_max_size_bytes_,
+            storage_configuration.write_io_batch_max_wait_time_us_,
+            storage_configuration.write_io_queue_max_number_tasks_,
+            storage_configuration.write_io_queue_max_size_bytes_,
             *data_partitions_provider,
             cache_accessor);
         threading_contexts_table->append_context(
@@ -111,15 +142,21 @@ collocation_builder::generate_collocation_topology(
         "NumCollocations={}, "
         "NumDataPartitions={}, "
         "NumThreadingContexts={}, "
-        "NumReadIoThreadsPerContext={}, "
-        "NumTotalReadIoThreads={}, "
+        "NumSharedReadIoThreads={}, "
+        "ReadIoBatchMaxNumberTasks={}, "
+        "ReadIoBatchMaxWaitTimeUs={}, "
+        "WriteIoQueueMaxNumberTasks={}, "
+        "WriteIoQueueMaxSizeInBytes={}, "
         "NumTotalWriteIoThreads={}, "
         "NumTotalIoThreads={}.",
-        k_number_collocations,
+        number_collocations,
         data_partitions_provider->get_num_data_partitions(),
         threading_contexts_provider->get_num_contexts(),
-        storage_configuration.number_read_io_threads_,
         threading_contexts_provider->get_num_read_io_threads(),
+        storage_configuration.read_io_batch_max_number_tasks_,
+        storage_configuration.read_io_batch_max_wait_time_us_,
+        storage_configuration.write_io_queue_max_number_tasks_,
+        storage_configuration.write_io_queue_max_size_bytes_,
         threading_contexts_provider->get_num_write_io_threads(),
         threading_contexts_provider->get_num_read_io_threads() + threading_contexts_provider->get_num_write_io_threads());
 
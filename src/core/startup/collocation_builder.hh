@@ -40,8 +40,9 @@ public:
     collocation_builder();
 
     //
-    // Generates and returns the list of data partitions
-    // and threading contexts to be used in the system within a fixed-topology set.
+    // Generates and returns the list of data partitions and threading contexts
+    // to be used in the system within a fixed-topology set. The number of collocations
+    // comes from the storage configurations and must match the persisted topology.
     // Returns:
     // 1. The data partition for the internal container metadata. This is considered as the last partition.
     // 2. The collocation resolver for routing object keys to their respective partition.
@@ -58,16 +59,6 @@ public:
         const storage_configuration& storage_configuration,
         cache_accessor& cache_accessor);
 
-    //
-    // Core invariant of the system.
-    // This should always remain the same.
-    // A change in this value upon system restart can cause serious
-    // data corruption and the inability to locate keys on data partitions.
-    //
-    static constexpr std::uint16_t k_number_collocations = 8u;
-
-private:
-
     //
     // Partition prefix to use for structured data partitions (SDPs).
     //
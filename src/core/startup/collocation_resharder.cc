@@ -0,0 +1,615 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Startup
+// 'collocation_resharder.cc'
+// Author: jcjuarez
+// Description:
+//      Offline redistribution of objects between
+//      data partitions for a new number of collocations.
+// ****************************************************
+
+#include <set>
+#include <optional>
+#include <filesystem>
+#include "collocation_builder.hh"
+#include "collocation_resharder.hh"
+#include "../storage/io/storage_engine.hh"
+#include "../storage/io/data_partition.hh"
+#include "../storage/io/collocation_resolver.hh"
+#include "../storage/io/collocation_topology.hh"
+#include "../storage/io/storage_engine_resources.hh"
+
+namespace pandora
+{
+namespace storage
+{
+
+collocation_resharder::collocation_resharder(
+    const storage_configuration& storage_configuration)
+    : storage_configuration_{storage_configuration}
+{}
+
+status::status_code
+collocation_resharder::reshard()
+{
+    const std::string& kv_store_path = storage_configuration_.kv_store_path_;
+    const std::uint16_t target_number_collocations = storage_configuration_.number_collocations_;
+
+    //
+    // Finish any previous resharding first, so its data partitions are the source of this one.
+    //
+    status::status_code status = recover_interrupted_resharding();
+
+    if (status::failed(status))
+    {
+        return status;
+    }
+
+    std::optional<std::uint16_t> source_number_collocations;
+    status = collocation_topology::read_number_collocations(
+        kv_store_path,
+        source_number_collocations);
+
+    if (status::failed(status))
+    {
+        return status;
+    }
+
+    if (!source_number_collocations.has_value())
+    {
+        TRACE_LOG(info, "No existing data store found for resharding. "
+            "Persisting the configured topology. "
+            "NumCollocations={}.",
+            target_number_collocations);
+
+        return collocation_topology::persist_number_collocations(
+            kv_store_path,
+            target_number_collocations);
+    }
+
+    if (source_number_collocations.value() == target_number_collocations)
+    {
+        TRACE_LOG(info, "The data store already has the configured number of collocations. "
+            "NumCollocations={}.",
+            target_number_collocations);
+
+        return status::success;
+    }
+
+    const std::string staging_path = kv_store_path + "/" + k_staging_directory_name;
+    const std::string backup_path = kv_store_path + "/" + k_backup_directory_name;
+
+    if (std::filesystem::exists(backup_path))
+    {
+        status = status::collocation_resharding_failed;
+        TRACE_LOG(critical, "A backup from a previous resharding is still present. "
+            "Remove it before resharding again. "
+            "BackupPath={}, "
+            "Status={:#x}.",
+            backup_path,
+            status);
+
+        return status;
+    }
+
+    //
+    // A staging directory can only be left behind by a resharding that
+    // failed before swapping the data partitions, so it is safe to discard it.
+    //
+    std::filesystem::remove_all(staging_path);
+
+    TRACE_LOG(info, "Starting the data store resharding. "
+        "SourceNumCollocations={}, "
+        "TargetNumCollocations={}, "
+        "StagingPath={}.",
+        source_number_collocations.value(),
+        target_number_collocations,
+        staging_path);
+
+    {
+        //
+        // Both the source and the target partitions are open at the same time.
+        //
+        auto storage_engine_resources = std::make_shared<const storage::storage_engine_resources>(
+            storage_configuration_,
+            source_number_collocations.value() + target_number_collocations);
+
+        std::vector<std::unique_ptr<data_partition>> source_partitions;
+        std::vector<references_mapping> source_partitions_references;
+        status = boot_partitions(
+            kv_store_path,
+            source_number_collocations.value(),
+            storage_engine_resources,
+            source_partitions,
+            source_partitions_references);
+
+        std::vector<std::unique_ptr<data_partition>> target_partitions;
+        std::vector<references_mapping> target_partitions_references;
+        if (status::succeeded(status))
+        {
+            status = boot_partitions(
+                staging_path,
+                target_number_collocations,
+                storage_engine_resources,
+                target_partitions,
+                target_partitions_references);
+        }
+
+        if (status::succeeded(status))
+        {
+            //
+            // Every object container must be present on every data partition,
+            // including the ones which hold no objects after the redistribution.
+            //
+            std::set<std::string> containers_names;
+            for (const references_mapping& partition_references : source_partitions_references)
+            {
+                for (const auto& reference_entry : partition_references)
+                {
+                    containers_names.insert(reference_entry.first);
+                }
+            }
+
+            status = create_containers(
+                std::vector<std::string>(containers_names.begin(), containers_names.end()),
+                target_partitions,
+                target_partitions_references);
+        }
+
+        if (status::succeeded(status))
+        {
+            const collocation_resolver target_collocation_resolver{target_number_collocations};
+            status = redistribute_objects(
+                source_partitions,
+                source_partitions_references,
+                target_partitions,
+                target_partitions_references,
+                target_collocation_resolver);
+        }
+
+        //
+        // The storage engines need to be closed before their directories can be moved.
+        //
+        close_partitions_references(
+            source_partitions,
+            source_partitions_references);
+        close_partitions_references(
+            target_partitions,
+            target_partitions_references);
+    }
+
+    if (status::failed(status))
+    {
+        TRACE_LOG(critical, "Failed to redistribute the objects for resharding. "
+            "The data store was left unchanged. "
+            "Status={:#x}.",
+            status);
+
+        return status;
+    }
+
+    status = complete_resharding(
+        source_number_collocations.value(),
+        target_number_collocations);
+
+    if (status::failed(status))
+    {
+        return status;
+    }
+
+    TRACE_LOG(info, "Data store resharding completed. "
+        "SourceNumCollocations={}, "
+        "TargetNumCollocations={}, "
+        "BackupPath={}.",
+        source_number_collocations.value(),
+        target_number_collocations,
+        backup_path);
+
+    return status::success;
+}
+
+status::status_code
+collocation_resharder::recover_interrupted_resharding()
+{
+    std::optional<resharding_intent> resharding_intent;
+    status::status_code status = collocation_topology::read_resharding_intent(
+        storage_configuration_.kv_store_path_,
+        resharding_intent);
+
+    if (status::failed(status) ||
+        !resharding_intent.has_value())
+    {
+        return status;
+    }
+
+    TRACE_LOG(warn, "Found a resharding interrupted while swapping the data partitions. "
+        "Rolling it forward. "
+        "SourceNumCollocations={}, "
+        "TargetNumCollocations={}.",
+        resharding_intent->source_number_collocations_,
+        resharding_intent->target_number_collocations_);
+
+    return complete_resharding(
+        resharding_intent->source_number_collocations_,
+        resharding_intent->target_number_collocations_);
+}
+
+status::status_code
+collocation_resharder::complete_resharding(
+    const std::uint16_t source_number_collocations,
+    const std::uint16_t target_number_collocations)
+{
+    const std::string& kv_store_path = storage_configuration_.kv_store_path_;
+
+    //
+    // The intent is persisted before the first rename and only removed after the new topology,
+    // so the data store never starts from a partially swapped set of data partitions.
+    //
+    status::status_code status = collocation_topology::persist_resharding_intent(
+        kv_store_path,
+        resharding_intent{source_number_collocations, target_number_collocations});
+
+    if (status::succeeded(status))
+    {
+        status = swap_partitions(
+            source_number_collocations,
+            target_number_collocations);
+    }
+
+    //
+    // Persisting the new topology is the last step of the swap, so the data store does not
+    // start with the new number of collocations unless all data partitions are in place.
+    //
+    if (status::succeeded(status))
+    {
+        status = collocation_topology::persist_number_collocations(
+            kv_store_path,
+            target_number_collocations);
+    }
+
+    if (status::succeeded(status))
+    {
+        status = collocation_topology::remove_resharding_intent(
+            kv_store_path);
+    }
+
+    if (status::succeeded(status))
+    {
+        std::error_code error_code;
+        std::filesystem::remove_all(
+            kv_store_path + "/" + k_staging_directory_name,
+            error_code);
+    }
+
+    return status;
+}
+
+status::status_code
+collocation_resharder::boot_partitions(
+    const std::string& kv_store_path,
+    const std::uint16_t number_collocations,
+    const std::shared_ptr<const storage_engine_resources>& storage_engine_resources,
+    std::vector<std::unique_ptr<data_partition>>& partitions,
+    std::vector<references_mapping>& partitions_references)
+{
+    storage_configuration partitions_configuration = storage_configuration_;
+    partitions_configuration.kv_store_path_ = kv_store_path;
+
+    for (std::uint16_t collocation_index = 0u; collocation_index < number_collocations; ++collocation_index)
+    {
+        auto partition = std::make_unique<data_partition>(
+            collocation_builder::k_structured_partition_prefix,
+            collocation_index,
+            partitions_configuration,
+            std::make_unique<storage_engine>(),
+            storage_engine_resources);
+
+        std::vector<std::string> containers_names;
+        status::status_code status = partition->fetch_containers_from_disk(
+            containers_names);
+
+        if (status::failed(status))
+        {
+            return status;
+        }
+
+        references_mapping partition_references;
+        status = partition->boot(
+            containers_names,
+            partition_references);
+
+        if (status::failed(status))
+        {
+            TRACE_LOG(critical, "Failed to boot data partition for resharding. "
+                "CollocationIndex={}, "
+                "KvStorePath={}, "
+                "Status={:#x}.",
+                collocation_index,
+                kv_store_path,
+                status);
+
+            return status;
+        }
+
+        partitions.emplace_back(std::move(partition));
+        partitions_references.emplace_back(std::move(partition_references));
+    }
+
+    return status::success;
+}
+
+status::status_code
+collocation_resharder::create_containers(
+    const std::vector<std::string>& containers_names,
+    std::vector<std::unique_ptr<data_partition>>& partitions,
+    std::vector<references_mapping>& partitions_references)
+{
+    for (std::size_t index = 0u; index < partitions.size(); ++index)
+    {
+        storage_engine_interface& engine = partitions[index]->get_storage_engine();
+        std::vector<storage_engine_reference*> created_references;
+
+        for (const std::string& container_name : containers_names)
+        {
+            if (partitions_references[index].contains(container_name))
+            {
+                continue;
+            }
+
+            storage_engine_reference* engine_reference = nullptr;
+            const status::status_code status = engine.create_container(
+                container_name.c_str(),
+                &engine_reference);
+
+            if (status::failed(status))
+            {
+                return status;
+            }
+
+            partitions_references[index].emplace(container_name, engine_reference);
+            created_references.push_back(engine_reference);
+        }
+
+        engine.register_approved_engine_references(
+            created_references);
+    }
+
+    return status::success;
+}
+
+status::status_code
+collocation_resharder::redistribute_objects(
+    std::vector<std::unique_ptr<data_partition>>& source_partitions,
+    std::vector<references_mapping>& source_partitions_references,
+    std::vector<std::unique_ptr<data_partition>>& target_partitions,
+    std::vector<references_mapping>& target_partitions_references,
+    const collocation_resolver& target_collocation_resolver)
+{
+    std::uint64_t number_objects_redistributed = 0u;
+
+    for (std::size_t source_index = 0u; source_index < source_partitions.size(); ++source_index)
+    {
+        for (const auto& [container_name, source_reference] : source_partitions_references[source_index])
+        {
+            //
+            // Objects are streamed from the source data partition, so the memory
+            // usage of the resharding is bounded by the pending write batches.
+            //
+            std::unique_ptr<storage_engine_iterator> object_iterator;
+            status::status_code status =
+                source_partitions[source_index]->get_storage_engine().create_object_iterator(
+                    source_reference,
+                    &object_iterator);
+
+            if (status::failed(status))
+            {
+                return status;
+            }
+
+            std::vector<storage_engine_write_batch> write_batches(target_partitions.size());
+
+            //
+            // Commits the staged objects of a target data partition.
+            //
+            auto commit_write_batch = [&](const std::size_t target_index) -> status::status_code
+            {
+                if (write_batches[target_index].Count() == 0u)
+                {
+                    return status::success;
+                }
+
+                const status::status_code commit_status =
+                    target_partitions[target_index]->get_storage_engine().commit_write_batch(
+                        &write_batches[target_index]);
+                write_batches[target_index].Clear();
+
+                return commit_status;
+            };
+
+            for (object_iterator->SeekToFirst(); object_iterator->Valid(); object_iterator->Next())
+            {
+                const std::string object_id = object_iterator->key().ToString();
+                const std::uint16_t target_index =
+                    target_collocation_resolver.get_collocation_index_for_key(object_id);
+
+                status = target_partitions[target_index]->get_storage_engine().stage_object_insertion(
+                    &write_batches[target_index],
+                    target_partitions_references[target_index].at(container_name),
+                    object_id.c_str(),
+                    object_iterator->value().ToString());
+
+                if (status::failed(status))
+                {
+                    return status;
+                }
+
+                if (write_batches[target_index].Count() >= k_write_batch_max_number_objects)
+                {
+                    status = commit_write_batch(target_index);
+
+                    if (status::failed(status))
+                    {
+                        return status;
+                    }
+                }
+
+                ++number_objects_redistributed;
+            }
+
+            if (!object_iterator->status().ok())
+            {
+                status = status::objects_retrieval_from_container_failed;
+                TRACE_LOG(critical, "Failed to iterate over the objects of a source data partition for resharding. "
+                    "SourceCollocationIndex={}, "
+                    "ContainerName={}, "
+                    "StorageEngineCode={}, "
+                    "StorageEngineSubCode={}, "
+                    "Status={:#x}.",
+                    source_index,
+                    container_name,
+                    static_cast<std::uint32_t>(object_iterator->status().code()),
+                    static_cast<std::uint32_t>(object_iterator->status().subcode()),
+                    status);
+
+                return status;
+            }
+
+            for (std::size_t target_index = 0u; target_index < target_partitions.size(); ++target_index)
+            {
+                status = commit_write_batch(target_index);
+
+                if (status::failed(status))
+                {
+                    return status;
+                }
+            }
+        }
+
+        TRACE_LOG(info, "Redistributed all objects of data partition for resharding. "
+            "SourceCollocationIndex={}, "
+            "NumObjectsRedistributed={}.",
+            source_index,
+            number_objects_redistributed);
+    }
+
+    return status::success;
+}
+
+void
+collocation_resharder::close_partitions_references(
+    std::vector<std::unique_ptr<data_partition>>& partitions,
+    std::vector<references_mapping>& partitions_references)
+{
+    for (std::size_t index = 0u; index < partitions_references.size(); ++index)
+    {
+        for (const auto& reference_entry : partitions_references[index])
+        {
+            partitions[index]->get_storage_engine().close_container_storage_engine_reference(
+                reference_entry.second);
+        }
+    }
+
+    partitions_references.clear();
+    partitions.clear();
+}
+
+status::status_code
+collocation_resharder::swap_partitions(
+    const std::uint16_t source_number_collocations,
+    const std::uint16_t target_number_collocations)
+{
+    const std::string& kv_store_path = storage_configuration_.kv_store_path_;
+    const std::string staging_path = kv_store_path + "/" + k_staging_directory_name;
+    const std::string backup_path = kv_store_path + "/" + k_backup_directory_name;
+    const std::string partition_prefix = std::string{collocation_builder::k_structured_partition_prefix} + "-";
+    const std::string metadata_partition_prefix = std::string{collocation_builder::k_metadata_partition_prefix} + "-";
+    std::error_code error_code;
+
+    std::filesystem::create_directories(backup_path, error_code);
+
+    //
+    // A source data partition already in the backup directory was moved before the interruption.
+    // The staged data partitions are only moved once all source ones are in the backup directory,
+    // so the one in its place can only be a target data partition.
+    //
+    for (std::uint16_t index = 0u; index < source_number_collocations && !error_code; ++index)
+    {
+        const std::string partition_name = partition_prefix + std::to_string(index);
+
+        if (!std::filesystem::exists(backup_path + "/" + partition_name, error_code) && !error_code)
+        {
+            std::filesystem::rename(
+                kv_store_path + "/" + partition_name,
+                backup_path + "/" + partition_name,
+                error_code);
+        }
+    }
+
+    //
+    // A staged data partition no longer in the staging directory was moved before the interruption.
+    //
+    for (std::uint16_t index = 0u; index < target_number_collocations && !error_code; ++index)
+    {
+        const std::string partition_name = partition_prefix + std::to_string(index);
+
+        if (std::filesystem::exists(staging_path + "/" + partition_name, error_code) && !error_code)
+        {
+            std::filesystem::rename(
+                staging_path + "/" + partition_name,
+                kv_store_path + "/" + partition_name,
+                error_code);
+        }
+        else if (!error_code &&
+                 !std::filesystem::exists(kv_store_path + "/" + partition_name, error_code) &&
+                 !error_code)
+        {
+            error_code = std::make_error_code(std::errc::no_such_file_or_directory);
+        }
+    }
+
+    //
+    // The metadata partition follows the last collocation index, so it is renamed for the new topology.
+    //
+    const std::string source_metadata_partition_path =
+        kv_store_path + "/" + metadata_partition_prefix + std::to_string(source_number_collocations);
+    const std::string target_metadata_partition_path =
+        kv_store_path + "/" + metadata_partition_prefix + std::to_string(target_number_collocations);
+
+    if (!error_code &&
+        !std::filesystem::exists(target_metadata_partition_path, error_code) &&
+        !error_code)
+    {
+        std::filesystem::rename(
+            source_metadata_partition_path,
+            target_metadata_partition_path,
+            error_code);
+    }
+
+    if (error_code)
+    {
+        status::status_code status = status::collocation_resharding_failed;
+        TRACE_LOG(critical, "Failed to swap the data partitions for resharding. The resharding intent "
+            "was kept, so the swap is retried on the next startup or resharding. The previous data "
+            "partitions are in the backup directory. "
+            "BackupPath={}, "
+            "StagingPath={}, "
+            "ErrorMessage={}, "
+            "Status={:#x}.",
+            backup_path,
+            staging_path,
+            error_code.message(),
+            status);
+
+        return status;
+    }
+
+    return status::success;
+}
+
+} // namespace storage.
+} // namespace pandora.
@@ -0,0 +1,155 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Startup
+// 'collocation_resharder.hh'
+// Author: jcjuarez
+// Description:
+//      Offline redistribution of objects between
+//      data partitions for a new number of collocations.
+// ****************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include "../status/status.hh"
+#include "../common/aliases.hh"
+#include "../storage/storage_configuration.hh"
+
+namespace pandora
+{
+namespace storage
+{
+
+class data_partition;
+class collocation_resolver;
+class storage_engine_resources;
+
+class collocation_resharder
+{
+public:
+
+    //
+    // Constructor.
+    // The target number of collocations is the one in the storage configurations.
+    //
+    collocation_resharder(
+        const storage_configuration& storage_configuration);
+
+    //
+    // Redistributes all objects from the persisted number of collocations to the configured one.
+    // Must only be run while the data store is stopped. The new data partitions are built in a
+    // staging directory and only swapped in once all objects were copied; the previous data
+    // partitions are kept in a backup directory to be removed by the operator.
+    //
+    status::status_code
+    reshard();
+
+    //
+    // Completes the swap of data partitions of a resharding interrupted by a crash, if any.
+    // The swap only starts once all objects were copied into the staged data partitions,
+    // so an interrupted swap is always rolled forward into the target number of collocations.
+    // Must be called before the data partitions are opened.
+    //
+    status::status_code
+    recover_interrupted_resharding();
+
+private:
+
+    //
+    // Mapping from object container names to their storage engine references in a data partition.
+    //
+    using references_mapping = std::unordered_map<std::string, storage_engine_reference*>;
+
+    //
+    // Boots the structured data partitions under the given core key-value store path.
+    //
+    status::status_code
+    boot_partitions(
+        const std::string& kv_store_path,
+        const std::uint16_t number_collocations,
+        const std::shared_ptr<const storage_engine_resources>& storage_engine_resources,
+        std::vector<std::unique_ptr<data_partition>>& partitions,
+        std::vector<references_mapping>& partitions_references);
+
+    //
+    // Creates the given object containers on all target data partitions.
+    //
+    status::status_code
+    create_containers(
+        const std::vector<std::string>& containers_names,
+        std::vector<std::unique_ptr<data_partition>>& partitions,
+        std::vector<references_mapping>& partitions_references);
+
+    //
+    // Copies all objects of the source data partitions into
+    // the target data partition their key is routed to.
+    //
+    status::status_code
+    redistribute_objects(
+        std::vector<std::unique_ptr<data_partition>>& source_partitions,
+        std::vector<references_mapping>& source_partitions_references,
+        std::vector<std::unique_ptr<data_partition>>& target_partitions,
+        std::vector<references_mapping>& target_partitions_references,
+        const collocation_resolver& target_collocation_resolver);
+
+    //
+    // Closes all storage engine references of the given data partitions.
+    // Must be called before the data partitions are destroyed.
+    //
+    static
+    void
+    close_partitions_references(
+        std::vector<std::unique_ptr<data_partition>>& partitions,
+        std::vector<references_mapping>& partitions_references);
+
+    //
+    // Moves the source data partitions into the backup directory, the staged
+    // data partitions into their place and renames the metadata partition.
+    // Every step is skipped if it was already done, so an interrupted swap can be run again.
+    //
+    status::status_code
+    swap_partitions(
+        const std::uint16_t source_number_collocations,
+        const std::uint16_t target_number_collocations);
+
+    //
+    // Configurations for the storage subsystem.
+    //
+    const storage_configuration storage_configuration_;
+
+    //
+    // Directory inside the core key-value store path for building the new data partitions.
+    //
+    static constexpr const char* k_staging_directory_name = "reshard-staging";
+
+    //
+    // Directory inside the core key-value store path for keeping the previous data partitions.
+    //
+    static constexpr const char* k_backup_directory_name = "reshard-backup";
+
+    //
+    // Swaps the data partitions under a resharding intent, persists the new topology and
+    // removes the intent. A crash at any point leaves the intent behind for the recovery.
+    //
+    status::status_code
+    complete_resharding(
+        const std::uint16_t source_number_collocations,
+        const std::uint16_t target_number_collocations);
+
+    //
+    // Maximum number of objects to be committed into a target data partition in a single write batch.
+    //
+    static constexpr std::size_t k_write_batch_max_number_objects = 1'024u;
+};
+
+} // namespace storage.
+} // namespace pandora.
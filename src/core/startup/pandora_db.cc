@@ -172,7 +172,8 @@ pandora_db::boot_structured_data_partitions()
     // |    ...     |     ...    |     ...    | ... |
     // ----------------------------------------------
     //
-    storage::container_registry container_registry;
+    storage::container_registry container_registry{
+        data_partition_provider_->get_num_data_partitions()};
 
     const std::span<storage::data_partition> data_partitions =
         data_partition_provider_->get_all_partitions();
@@ -16,8 +16,10 @@
 #include "pandora_db.hh"
 #include "system_init.hh"
 #include "collocation_builder.hh"
+#include "collocation_resharder.hh"
 #include "../network/server/server.hh"
 #include "../common/args_validations.hh"
+#include "../metrics/metrics_registry.hh"
 #include "../storage/io/data_partition.hh"
 #include "../storage/io/read_io_executor.hh"
 #include "../storage/cache/cache_accessor.hh"
@@ -28,15 +30,19 @@
 #include "../storage/io/write_io_dispatcher.hh"
 #include "../storage/io/data_partition_table.hh"
 #include "../storage/io/collocation_resolver.hh"
+#include "../storage/io/collocation_topology.hh"
 #include "../storage/io/data_partition_provider.hh"
 #include "../storage/io/threading_context_table.hh"
 #include "../storage/io/threading_context_provider.hh"
 #include "../storage/management/object_management_service.hh"
+#include "../storage/management/engine_statistics_service.hh"
 #include "../storage/management/container_management_service.hh"
 #include "../storage/management/container_operation_serializer.hh"
 #include "../network/server/request-handlers/object/get_object_request_handler.hh"
 #include "../network/server/request-handlers/object/insert_object_request_handler.hh"
 #include "../network/server/request-handlers/object/remove_object_request_handler.hh"
+#include "../network/server/request-handlers/object/scan_objects_request_handler.hh"
+#include "../network/server/request-handlers/object/object_batch_request_handler.hh"
 #include "../network/server/request-handlers/container/create_container_request_handler.hh"
 #include "../network/server/request-handlers/container/remove_container_request_handler.hh"
 
@@ -88,6 +94,40 @@ init_system(
     return status::succeeded(status) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
+exit_code
+init_resharding(
+    const std::vector<std::string>& args)
+{
+    status::status_code status = status::success;
+
+    try
+    {
+        const boost::uuids::uuid session_id = common::generate_uuid();
+        const auto system_config = generate_system_configs(args);
+
+        init_global_dependencies(
+            session_id,
+            system_config);
+
+        //
+        // The data store must be stopped, as the data partitions are opened exclusively.
+        //
+        storage::collocation_resharder collocation_resharder{
+            system_config.storage_configuration_};
+        status = collocation_resharder.reshard();
+    }
+    catch (const std::exception& exception)
+    {
+        status = status::fail;
+
+        TRACE_LOG(critical, "Exception thrown in the data store resharding path. Terminating the resharding. "
+            "Exception={}",
+            exception.what());
+    }
+
+    return status::succeeded(status) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 void
 init_global_dependencies(
     const boost::uuids::uuid session_id,
@@ -111,6 +151,46 @@ start_system(
     const boost::uuids::uuid session_id,
     const common::system_configuration& system_config)
 {
+    //
+    // A resharding interrupted while swapping the data partitions is completed
+    // first, so the persisted topology matches the data partitions on disk.
+    //
+    storage::collocation_resharder collocation_resharder{
+        system_config.storage_configuration_};
+    status::status_code status = collocation_resharder.recover_interrupted_resharding();
+
+    if (status::failed(status))
+    {
+        TRACE_LOG(critical, "Failed to recover an interrupted resharding during the system startup. "
+            "Status={:#x}.",
+            status);
+
+        return status;
+    }
+
+    //
+    // Keys are routed to data partitions by the number of collocations,
+    // so it has to match the topology the data store was created with.
+    //
+    status = storage::collocation_topology::validate_number_collocations(
+        system_config.storage_configuration_.kv_store_path_,
+        system_config.storage_configuration_.number_collocations_);
+
+    if (status::failed(status))
+    {
+        TRACE_LOG(critical, "Failed to validate the collocation topology during the system startup. "
+            "Status={:#x}.",
+            status);
+
+        return status;
+    }
+
+    //
+    // Allocate the per-collocation metrics before any IO dispatcher starts recording them.
+    //
+    metrics::metrics_registry::init(
+        system_config.storage_configuration_.number_collocations_);
+
     //
     // Construct all the dependencies for the system.
     //
@@ -121,6 +201,10 @@ start_system(
         system_config.storage_configuration_.number_frontline_cache_shards_,
         system_config.storage_configuration_.max_frontline_cache_shard_size_mib_ * 1'024 * 1'024,
         system_config.storage_configuration_.max_frontline_cache_shard_object_size_bytes,
+        system_config.storage_configuration_.frontline_cache_eviction_policy_,
+        system_config.storage_configuration_.frontline_cache_admission_enabled_,
+        system_config.storage_configuration_.frontline_cache_max_number_negative_entries_,
+        system_config.storage_configuration_.frontline_cache_negative_entry_ttl_ms_,
         *container_index);
 
     auto cache_accessor = std::make_unique<storage::cache_accessor>(
@@ -181,13 +265,28 @@ start_system(
     auto remove_object_request_handler = std::make_unique<network::remove_object_request_handler>(
         *object_management_service);
 
+    auto scan_objects_request_handler = std::make_unique<network::scan_objects_request_handler>(
+        *object_management_service);
+
+    auto object_batch_request_handler = std::make_unique<network::object_batch_request_handler>(
+        *object_management_service);
+
+    auto engine_statistics_service = std::make_unique<storage::engine_statistics_service>(
+        *metadata_partition,
+        *data_partition_provider,
+        *container_index);
+
     auto server = std::make_unique<network::server>(
         system_config.server_configuration_,
         std::move(create_container_request_handler),
         std::move(remove_container_request_handler),
         std::move(insert_object_request_handler),
         std::move(get_object_request_handler),
-        std::move(remove_object_request_handler));
+        std::move(remove_object_request_handler),
+        std::move(scan_objects_request_handler),
+        std::move(object_batch_request_handler),
+        std::move(engine_statistics_service),
+        *frontline_cache);
 
     auto container_loader = std::make_unique<storage::container_loader>(
         *metadata_partition,
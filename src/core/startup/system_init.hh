@@ -36,6 +36,14 @@ exit_code
 init_system(
     const std::vector<std::string>& args);
 
+//
+// Entry point for the offline resharding of the data store.
+// Redistributes the objects to the number of collocations in the configuration file.
+//
+exit_code
+init_resharding(
+    const std::vector<std::string>& args);
+
 //
 // Initializes all global dependencies.
 //
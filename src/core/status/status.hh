@@ -279,5 +279,83 @@ status_code_definition(
     0x80000026,
     static_cast<drogon::HttpStatusCode>(500));
 
+// Object rejected by the frontline cache admission filter.
+status_code_definition(
+    cache_admission_rejected,
+    0x80000027,
+    static_cast<drogon::HttpStatusCode>(500));
+
+// Frontline cache fill dropped since the object was modified after it was read.
+status_code_definition(
+    cache_fill_superseded,
+    0x80000028,
+    static_cast<drogon::HttpStatusCode>(500));
+
+// The configured number of collocations does not match the persisted topology of the data store.
+status_code_definition(
+    collocation_topology_mismatch,
+    0x80000029,
+    static_cast<drogon::HttpStatusCode>(500));
+
+// Failed to read or persist the collocation topology marker.
+status_code_definition(
+    collocation_topology_marker_failed,
+    0x8000002a,
+    static_cast<drogon::HttpStatusCode>(500));
+
+// Failed to redistribute the objects between data partitions.
+status_code_definition(
+    collocation_resharding_failed,
+    0x8000002b,
+    static_cast<drogon::HttpStatusCode>(500));
+
+// The provided continuation token for the container scan is malformed.
+status_code_definition(
+    invalid_continuation_token,
+    0x8000002c,
+    static_cast<drogon::HttpStatusCode>(400));
+
+// Object batch request contains no objects.
+status_code_definition(
+    object_batch_empty,
+    0x8000002d,
+    static_cast<drogon::HttpStatusCode>(400));
+
+// Object batch request exceeds the maximum number of objects.
+status_code_definition(
+    object_batch_size_exceeds_limit,
+    0x8000002e,
+    static_cast<drogon::HttpStatusCode>(413));
+
+// Invalid log level or log subsystem.
+status_code_definition(
+    invalid_log_level,
+    0x8000002f,
+    static_cast<drogon::HttpStatusCode>(400));
+
+// Write IO queue of the collocation is at capacity. The operation can be retried later.
+status_code_definition(
+    write_io_queue_full,
+    0x80000030,
+    static_cast<drogon::HttpStatusCode>(429));
+
+// Request deadline expired before the operation was executed, so it was dropped.
+status_code_definition(
+    deadline_exceeded,
+    0x80000031,
+    static_cast<drogon::HttpStatusCode>(504));
+
+// Object does not exist in the specified object container.
+status_code_definition(
+    object_not_found,
+    0x80000032,
+    static_cast<drogon::HttpStatusCode>(404));
+
+// Object data is not valid UTF-8, so it cannot be returned as JSON. Use the application/octet-stream transport.
+status_code_definition(
+    object_data_not_json_representable,
+    0x80000033,
+    static_cast<drogon::HttpStatusCode>(406));
+
 } // namespace status.
 } // namespace pandora.
\ No newline at end of file
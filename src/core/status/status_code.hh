@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string_view>
 
 namespace pandora::status
 {
@@ -32,8 +33,32 @@ struct status_code
         const char* name)
         : internal_status_code_{internal_status_code},
           http_status_code_{http_status_code},
-          name_{name}
-    {}
+          name_{name},
+          internal_status_code_string_{},
+          internal_status_code_string_size_{0u}
+    {
+        //
+        // Precompute the hexadecimal form of the internal status code sent in responses,
+        // so that it is built at compile time for every defined status code.
+        //
+        constexpr char k_hex_digits[] = "0123456789abcdef";
+        std::uint32_t number_digits = 1u;
+
+        while (number_digits < 8u &&
+               (internal_status_code_ >> (number_digits * 4u)) != 0u)
+        {
+            ++number_digits;
+        }
+
+        internal_status_code_string_[internal_status_code_string_size_++] = '0';
+        internal_status_code_string_[internal_status_code_string_size_++] = 'x';
+
+        for (std::uint32_t digit = number_digits; digit > 0u; --digit)
+        {
+            internal_status_code_string_[internal_status_code_string_size_++] =
+                k_hex_digits[(internal_status_code_ >> ((digit - 1u) * 4u)) & 0xfu];
+        }
+    }
 
     //
     // Cast operator for direct comparisons.
@@ -62,6 +87,17 @@ struct status_code
         return http_status_code_;
     }
 
+    //
+    // Gets the internal status code in hexadecimal form, such as '0x80000001'.
+    //
+    std::string_view
+    get_internal_status_code_string() const
+    {
+        return std::string_view{
+            internal_status_code_string_,
+            internal_status_code_string_size_};
+    }
+
 private:
 
     //
@@ -79,6 +115,16 @@ private:
     // Must be associated to a string literal with program-lifetime.
     //
     const char* name_;
+
+    //
+    // Precomputed hexadecimal form of the internal status code.
+    //
+    char internal_status_code_string_[10];
+
+    //
+    // Number of characters of the precomputed internal status code string.
+    //
+    std::uint8_t internal_status_code_string_size_;
 };
 
 } // namespace pandora::status.
\ No newline at end of file
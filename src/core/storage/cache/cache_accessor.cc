@@ -36,14 +36,169 @@ cache_accessor::insert_object_into_cache(
     //
     const std::string object_id = object_request.get_object_id();
     const std::string container_name = object_request.get_container_name();
+
+    //
+    // The object data of an insertion may be borrowed from the request buffer.
+    // Oversized objects are only invalidated, so that no copy is materialized for them.
+    //
+    if (!frontline_cache_.is_object_size_cacheable(
+            object_id,
+            container_name,
+            object_request.get_object_data().size()))
+    {
+        frontline_cache_.remove(
+            object_id,
+            container_name);
+
+        trace_cache_insertion_status(
+            object_request,
+            object_id,
+            container_name,
+            status::object_data_size_exceeds_cache_limit);
+
+        return;
+    }
+
     const status::status_code status = frontline_cache_.put(
         std::move(object_request.get_object_id_mutable()),
-        std::move(object_request.get_object_data_mutable()),
+        std::make_shared<const byte_stream>(object_request.take_object_data()),
         std::move(object_request.get_container_name_mutable()));
 
+    trace_cache_insertion_status(
+        object_request,
+        object_id,
+        container_name,
+        status);
+}
+
+void
+cache_accessor::fill_object_into_cache(
+    schemas::object_request& object_request,
+    std::string_view object_data,
+    const cache_fill_ticket& fill_ticket)
+{
+    //
+    // Create a copy of these parameters since
+    // they will be moved after the cache fill.
+    //
+    const std::string object_id = object_request.get_object_id();
+    const std::string container_name = object_request.get_container_name();
+
+    //
+    // Fills never invalidate, so an oversized object is dropped before materializing its copy.
+    //
+    if (!frontline_cache_.is_object_size_cacheable(
+            object_id,
+            container_name,
+            object_data.size()))
+    {
+        trace_cache_insertion_status(
+            object_request,
+            object_id,
+            container_name,
+            status::object_data_size_exceeds_cache_limit);
+
+        return;
+    }
+
+    const status::status_code status = frontline_cache_.fill(
+        std::move(object_request.get_object_id_mutable()),
+        std::make_shared<const byte_stream>(object_data),
+        std::move(object_request.get_container_name_mutable()),
+        fill_ticket);
+
+    trace_cache_insertion_status(
+        object_request,
+        object_id,
+        container_name,
+        status);
+}
+
+void
+cache_accessor::fill_negative_object_into_cache(
+    const schemas::object_request& object_request,
+    const cache_fill_ticket& fill_ticket)
+{
+    const status::status_code status = frontline_cache_.fill_negative(
+        object_request.get_object_id(),
+        object_request.get_container_name(),
+        fill_ticket);
+
+    //
+    // Only failed negative fills are traced, given misses on absent objects are expected to be frequent.
+    //
+    if (status::failed(status))
+    {
+        trace_cache_insertion_status(
+            object_request,
+            object_request.get_object_id(),
+            object_request.get_container_name(),
+            status);
+    }
+}
+
+cache_fill_ticket
+cache_accessor::get_cache_fill_ticket(
+    const schemas::object_request& object_request) const
+{
+    return frontline_cache_.get_fill_ticket(
+        object_request.get_object_id(),
+        object_request.get_container_name());
+}
+
+void
+cache_accessor::remove_object_from_cache(
+    schemas::object_request& object_request)
+{
+    frontline_cache_.remove(
+        object_request.get_object_id(),
+        object_request.get_container_name());
+
+    TRACE_LOG_SAMPLED(info, k_object_operation_log_sample_rate, "Frontline cache object removal succeeded on remove object operation. "
+        "Optype={}, "
+        "ObjectId={}, "
+        "ObjectContainerName={}.",
+        static_cast<std::uint8_t>(object_request.get_optype()),
+        object_request.get_object_id(),
+        object_request.get_container_name());
+}
+
+void
+cache_accessor::trace_cache_insertion_status(
+    const schemas::object_request& object_request,
+    const std::string& object_id,
+    const std::string& container_name,
+    const status::status_code status) const
+{
     if (status::succeeded(status))
     {
-        TRACE_LOG(info, "Frontline cache object insertion succeeded on insert object operation. "
+        TRACE_LOG_SAMPLED(info, k_object_operation_log_sample_rate, "Frontline cache object insertion succeeded. "
+            "Optype={}, "
+            "ObjectId={}, "
+            "ObjectContainerName={}.",
+            static_cast<std::uint8_t>(object_request.get_optype()),
+            object_id,
+            container_name);
+    }
+    else if (status == status::cache_admission_rejected)
+    {
+        //
+        // Expected outcome for objects which are not popular enough to be cached.
+        //
+        TRACE_LOG_RATE_LIMITED(info, k_object_failure_max_log_lines_per_second, "Frontline cache object insertion rejected by the admission filter. "
+            "Optype={}, "
+            "ObjectId={}, "
+            "ObjectContainerName={}.",
+            static_cast<std::uint8_t>(object_request.get_optype()),
+            object_id,
+            container_name);
+    }
+    else if (status == status::cache_fill_superseded)
+    {
+        //
+        // Expected outcome for reads which raced with a write or removal of the object.
+        //
+        TRACE_LOG_RATE_LIMITED(info, k_object_failure_max_log_lines_per_second, "Frontline cache object fill dropped as the object was modified during the read. "
             "Optype={}, "
             "ObjectId={}, "
             "ObjectContainerName={}.",
@@ -53,7 +208,7 @@ cache_accessor::insert_object_into_cache(
     }
     else
     {
-        TRACE_LOG(error, "Frontline cache object insertion failed on insert object operation. "
+        TRACE_LOG_RATE_LIMITED(error, k_object_failure_max_log_lines_per_second, "Frontline cache object insertion failed. "
             "Optype={}, "
             "ObjectId={}, "
             "ObjectContainerName={}, "
@@ -65,10 +220,5 @@ cache_accessor::insert_object_into_cache(
     }
 }
 
-void
-cache_accessor::remove_object_from_cache(
-    schemas::object_request& object_request)
-{}
-
 } // namespace storage.
 } // namespace pandora.
\ No newline at end of file
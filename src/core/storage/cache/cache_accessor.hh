@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <string_view>
 #include "../../status/status.hh"
 #include "../../common/aliases.hh"
 #include "../../schemas/request-interfaces/object_request.hh"
@@ -25,6 +26,7 @@ namespace storage
 {
 
 class frontline_cache;
+struct cache_fill_ticket;
 
 class cache_accessor
 {
@@ -38,13 +40,44 @@ public:
 
     //
     // Executes an insertion operation into the frontline cache.
+    // Must only be called post a write operation.
     //
     void
     insert_object_into_cache(
         schemas::object_request& object_request);
 
+    //
+    // Executes a fill operation into the frontline cache with an object
+    // read from the storage engine. The fill ticket must have been taken
+    // before the read, so a value superseded by a concurrent write or removal is dropped.
+    // The object data is only copied into the cache if it fits under the per-object limit.
+    //
+    void
+    fill_object_into_cache(
+        schemas::object_request& object_request,
+        std::string_view object_data,
+        const cache_fill_ticket& fill_ticket);
+
+    //
+    // Records the object of the request as absent after the storage engine did not find it.
+    // The fill ticket must have been taken before the read, so an absence observed before
+    // a concurrent write is dropped. No-op if negative caching is disabled.
+    //
+    void
+    fill_negative_object_into_cache(
+        const schemas::object_request& object_request,
+        const cache_fill_ticket& fill_ticket);
+
+    //
+    // Takes a fill ticket for the object of the request.
+    //
+    cache_fill_ticket
+    get_cache_fill_ticket(
+        const schemas::object_request& object_request) const;
+
     //
     // Executes a deletion operation from the frontline cache.
+    // Must only be called post a remove operation.
     //
     void
     remove_object_from_cache(
@@ -52,10 +85,30 @@ public:
 
 private:
 
+    //
+    // Traces the outcome of an insertion or fill operation into the frontline cache.
+    //
+    void
+    trace_cache_insertion_status(
+        const schemas::object_request& object_request,
+        const std::string& object_id,
+        const std::string& container_name,
+        const status::status_code status) const;
+
     //
     // Frontline cache handle.
     //
     frontline_cache& frontline_cache_;
+
+    //
+    // Number of successful per-object operations per logged one.
+    //
+    static constexpr std::uint32_t k_object_operation_log_sample_rate = 1'000u;
+
+    //
+    // Maximum number of failed per-object operations logged per second.
+    //
+    static constexpr std::uint32_t k_object_failure_max_log_lines_per_second = 100u;
 };
 
 } // namespace storage.
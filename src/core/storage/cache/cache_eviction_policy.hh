@@ -0,0 +1,64 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'cache_eviction_policy.hh'
+// Author: jcjuarez
+// Description:
+//      Eviction policies for the frontline cache.
+// ****************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace pandora::storage
+{
+
+//
+// Policy for choosing the eviction victim inside a cache shard.
+//
+enum class cache_eviction_policy : std::uint8_t
+{
+    //
+    // Least recently used. Hits reorder the recency list,
+    // so they take the shard lock in exclusive mode.
+    //
+    lru = 0,
+
+    //
+    // CLOCK second-chance. Hits only set a reference bit atomically,
+    // so they take the shard lock in shared mode and scale with readers.
+    //
+    clock = 1
+};
+
+//
+// Gets the eviction policy from its configuration name.
+// Returns an empty optional if the name is not recognized.
+//
+inline
+std::optional<cache_eviction_policy>
+get_cache_eviction_policy_from_name(
+    std::string_view name)
+{
+    if (name == "lru")
+    {
+        return cache_eviction_policy::lru;
+    }
+
+    if (name == "clock")
+    {
+        return cache_eviction_policy::clock;
+    }
+
+    return std::nullopt;
+}
+
+} // namespace pandora::storage.
@@ -13,74 +13,329 @@
 //      frontline cache.
 // ****************************************************
 
+#include <xxhash.h>
 #include "cache_shard.hh"
 
 namespace pandora::storage
 {
 
-using container_object_id_pair = std::pair<std::string, std::string>;
-
 cache_shard::cache_shard(
     const std::size_t max_cache_shard_size_bytes,
-    const std::size_t max_object_size_bytes)
-    : max_cache_shard_size_bytes_{max_cache_shard_size_bytes},
+    const std::size_t max_object_size_bytes,
+    const cache_eviction_policy eviction_policy,
+    const bool admission_enabled,
+    const std::size_t max_number_negative_entries,
+    const std::uint32_t negative_entry_ttl_ms)
+    : eviction_policy_{eviction_policy},
+      max_cache_shard_size_bytes_{max_cache_shard_size_bytes},
       max_object_size_bytes_{max_object_size_bytes},
-      current_cache_shard_size_bytes_{0u}
+      current_cache_shard_size_bytes_{0u},
+      hash_table_(k_initial_number_slots, hash_slot{0u, k_null_index}),
+      number_entries_{0u},
+      lru_head_index_{k_null_index},
+      lru_tail_index_{k_null_index},
+      clock_hand_index_{0u},
+      admission_enabled_{admission_enabled},
+      frequency_sketch_{max_cache_shard_size_bytes / k_expected_average_entry_size_bytes},
+      hits_{0u},
+      misses_{0u},
+      admissions_{0u},
+      rejections_{0u},
+      negative_hits_{0u},
+      max_number_negative_entries_{max_number_negative_entries},
+      negative_entry_ttl_{negative_entry_ttl_ms},
+      version_stripes_{std::make_unique<std::atomic<std::uint64_t>[]>(k_number_version_stripes)}
 {}
 
+std::uint64_t
+cache_shard::compute_key_hash(
+    const std::string& object_id,
+    const std::string& container_name)
+{
+    //
+    // Chain the container name hash as the seed for the object ID hash,
+    // so the key hash can be computed without concatenating both strings.
+    //
+    return XXH3_64bits_withSeed(
+        object_id.data(),
+        object_id.size(),
+        XXH3_64bits(container_name.data(), container_name.size()));
+}
+
 status::status_code
 cache_shard::put(
+    const std::uint64_t key_hash,
     std::string&& object_id,
-    byte_stream&& object_data,
+    shared_byte_stream object_data,
     std::string&& container_name)
 {
+    return insert(
+        key_hash,
+        std::move(object_id),
+        std::move(object_data),
+        std::move(container_name),
+        std::nullopt);
+}
+
+status::status_code
+cache_shard::fill(
+    const std::uint64_t key_hash,
+    std::string&& object_id,
+    shared_byte_stream object_data,
+    std::string&& container_name,
+    const std::uint64_t fill_version)
+{
+    return insert(
+        key_hash,
+        std::move(object_id),
+        std::move(object_data),
+        std::move(container_name),
+        fill_version);
+}
+
+void
+cache_shard::remove(
+    const std::uint64_t key_hash,
+    const std::string& object_id,
+    const std::string& container_name)
+{
+    std::unique_lock<std::shared_mutex> lock {lock_};
+
     //
-    // Before taking the lock, execute the sanity check
-    // to ensure the value does not exceed the limit size.
+    // Bump the version even if the object is not resident,
+    // so in-flight fills which read the object before its removal are dropped.
     //
-    const std::size_t object_data_size_bytes = object_data.size();
-    if (object_data_size_bytes > max_object_size_bytes_)
+    get_version_stripe(key_hash).fetch_add(1u, std::memory_order_release);
+    erase_negative_entry(key_hash);
+
+    const std::size_t slot_index = find_slot(
+        key_hash,
+        object_id,
+        container_name);
+
+    if (slot_index != k_null_index)
+    {
+        remove_entry(slot_index);
+    }
+}
+
+status::status_code
+cache_shard::fill_negative(
+    const std::uint64_t key_hash,
+    const std::string& object_id,
+    const std::string& container_name,
+    const std::uint64_t fill_version,
+    const std::chrono::steady_clock::time_point now)
+{
+    if (max_number_negative_entries_ == 0u)
     {
+        return status::success;
+    }
+
+    //
+    // Construct the key before taking the lock.
+    //
+    std::string key;
+    key.reserve(container_name.size() + object_id.size());
+    key.append(container_name);
+    key.append(object_id);
+    const std::chrono::steady_clock::time_point expiration_time = now + negative_entry_ttl_;
+
+    std::unique_lock<std::shared_mutex> lock {lock_};
+
+    //
+    // Writes and removals bump the version before invalidating the negative entry,
+    // so an absence observed before a concurrent write is never recorded after it.
+    //
+    if (get_version_stripe(key_hash).load(std::memory_order_relaxed) != fill_version)
+    {
+        return status::cache_fill_superseded;
+    }
+
+    //
+    // Evict the expired entries and, if the shard is at capacity, the oldest ones.
+    // Records whose entry was invalidated or refreshed since are only dropped.
+    //
+    while (!negative_entries_queue_.empty() &&
+           (negative_entries_queue_.size() >= max_number_negative_entries_ ||
+            negative_entries_queue_.front().second <= now))
+    {
+        const auto [oldest_key_hash, oldest_expiration_time] = negative_entries_queue_.front();
+        negative_entries_queue_.pop_front();
+
+        auto negative_entry_iterator = negative_entries_.find(oldest_key_hash);
+        if (negative_entry_iterator != negative_entries_.end() &&
+            negative_entry_iterator->second.expiration_time_ == oldest_expiration_time)
+        {
+            negative_entries_.erase(negative_entry_iterator);
+        }
+    }
+
+    negative_entries_.insert_or_assign(
+        key_hash,
+        negative_entry{
+            std::move(key),
+            static_cast<std::uint32_t>(container_name.size()),
+            expiration_time});
+    negative_entries_queue_.emplace_back(key_hash, expiration_time);
+
+    return status::success;
+}
+
+bool
+cache_shard::is_negative(
+    const std::uint64_t key_hash,
+    const std::string& object_id,
+    const std::string& container_name,
+    const std::chrono::steady_clock::time_point now)
+{
+    if (max_number_negative_entries_ == 0u)
+    {
+        return false;
+    }
+
+    std::shared_lock<std::shared_mutex> lock {lock_};
+
+    const auto negative_entry_iterator = negative_entries_.find(key_hash);
+
+    if (negative_entry_iterator == negative_entries_.end() ||
+        negative_entry_iterator->second.expiration_time_ <= now ||
+        !is_same_key(
+            negative_entry_iterator->second.key_,
+            negative_entry_iterator->second.container_name_size_,
+            object_id,
+            container_name))
+    {
+        return false;
+    }
+
+    negative_hits_.fetch_add(1u, std::memory_order_relaxed);
+
+    return true;
+}
+
+std::uint64_t
+cache_shard::get_version(
+    const std::uint64_t key_hash) const
+{
+    return get_version_stripe(key_hash).load(std::memory_order_acquire);
+}
+
+status::status_code
+cache_shard::insert(
+    const std::uint64_t key_hash,
+    std::string&& object_id,
+    shared_byte_stream object_data,
+    std::string&& container_name,
+    const std::optional<std::uint64_t> fill_version)
+{
+    //
+    // Before taking the lock, execute the sanity check to ensure the entry
+    // does not exceed the limit size, accounting for the key as the shard size does.
+    //
+    if ((container_name.size() + object_id.size() + object_data->size()) > max_object_size_bytes_)
+    {
+        //
+        // A write of an oversized value still has to invalidate the
+        // previous value of the object, otherwise it would be served stale.
+        //
+        if (!fill_version.has_value())
+        {
+            remove(
+                key_hash,
+                object_id,
+                container_name);
+        }
+
         return status::object_data_size_exceeds_cache_limit;
     }
 
     //
-    // Construct the key object before taking the lock.
+    // Construct the single copy of the key before taking the lock.
     // The parameters will be moved under the assumption of no further usage.
     //
-    container_object_id_pair object_id_pair = std::make_pair(
-        std::move(container_name),
-        std::move(object_id));
+    const std::uint32_t container_name_size = static_cast<std::uint32_t>(container_name.size());
+    std::string key = std::move(container_name);
+    key.append(object_id);
+    const std::size_t entry_size_bytes = key.size() + object_data->size();
 
-    std::lock_guard<std::mutex> lock {lock_};
+    std::unique_lock<std::shared_mutex> lock {lock_};
 
-    auto map_object_iterator = lru_cache_map_.find(object_id_pair);
-    if (map_object_iterator != lru_cache_map_.end())
+    //
+    // Writes bump the version of the object before installing the new value. Fills
+    // are only installed if no write or removal happened since the fill version was taken,
+    // given the value they carry could have been read before the modification.
+    //
+    std::atomic<std::uint64_t>& version_stripe = get_version_stripe(key_hash);
+    if (fill_version.has_value())
     {
-        if (lru_doubly_linked_list_.begin() == lru_cache_map_.at(object_id_pair))
+        if (version_stripe.load(std::memory_order_relaxed) != fill_version.value())
         {
-            //
-            // This means the object is already at the front of the list.
-            // Even though no position change is needed, the actual object data
-            // could be different from the one in the cache, so update the current value
-            // with the one provided.
-            //
-            lru_doubly_linked_list_.begin()->second = std::move(object_data);
-            return status::success;
+            return status::cache_fill_superseded;
         }
+    }
+    else
+    {
+        version_stripe.fetch_add(1u, std::memory_order_release);
+    }
 
+    //
+    // Both writes and fills prove the object exists.
+    //
+    erase_negative_entry(key_hash);
+
+    //
+    // If the object already exists, remove it instead of updating it in place.
+    // This is simpler given the cache does not know in advance how many
+    // bytes need to be removed in object terms in order to insert this new object.
+    //
+    const std::size_t existing_slot_index = find_slot(
+        key_hash,
+        object_id,
+        std::string_view{key}.substr(0u, container_name_size));
+
+    std::uint32_t victim_index = k_null_index;
+
+    if (existing_slot_index != k_null_index)
+    {
+        remove_entry(existing_slot_index);
+    }
+    else if (admission_enabled_ &&
+             (current_cache_shard_size_bytes_ + entry_size_bytes) > max_cache_shard_size_bytes_ &&
+             number_entries_ > 0u)
+    {
         //
-        // If the object exists and is not at the front, remove it from the cache instead of splicing it.
-        // This is more efficient given the cache does not know in advance how many
-        // bytes need to be removed in object terms in order to insert this new object.
+        // A new object which requires an eviction has to be estimated as more popular
+        // than the victim, so one-hit wonders from scans do not flush the working set.
+        // Updates of existing objects always proceed to keep the cache aligned with the writes.
+        // The victim is found once, given finding it under CLOCK moves the hand and clears reference bits,
+        // and it is the first entry evicted if the object is admitted.
         //
-        current_cache_shard_size_bytes_ -= map_object_iterator->second->second.size();
-        lru_doubly_linked_list_.erase(map_object_iterator->second);
-        lru_cache_map_.erase(map_object_iterator);
+        victim_index = find_victim();
+
+        if (frequency_sketch_.estimate_frequency(key_hash) <=
+            frequency_sketch_.estimate_frequency(entries_[victim_index].key_hash_))
+        {
+            //
+            // Keep the victim next in line for the CLOCK hand, as it was not evicted.
+            //
+            if (eviction_policy_ == cache_eviction_policy::clock)
+            {
+                clock_hand_index_ = victim_index;
+            }
+
+            rejections_.fetch_add(1u, std::memory_order_relaxed);
+            return status::cache_admission_rejected;
+        }
+    }
+
+    if (existing_slot_index == k_null_index)
+    {
+        admissions_.fetch_add(1u, std::memory_order_relaxed);
     }
 
-    while ((current_cache_shard_size_bytes_ + object_data_size_bytes) > max_cache_shard_size_bytes_ &&
-           !lru_doubly_linked_list_.empty())
+    while ((current_cache_shard_size_bytes_ + entry_size_bytes) > max_cache_shard_size_bytes_ &&
+           number_entries_ > 0u)
     {
         //
         // Evict as many old elements as needed to insert the new object.
@@ -88,52 +343,438 @@ cache_shard::put(
         // needed, thus it is ideal to keep the maximum size for objects in the size as small as possible,
         // or at least in a big differential ratio between the max object size over the max cache shard size.
         //
-        auto& oldest_object_in_list = lru_doubly_linked_list_.back();
-        current_cache_shard_size_bytes_ -= oldest_object_in_list.second.size();
-        lru_cache_map_.erase(oldest_object_in_list.first);
-        lru_doubly_linked_list_.pop_back();
+        evict_entry(victim_index);
+        victim_index = k_null_index;
     }
 
-    //
-    // The data can be moved in the first call.
-    //
-    lru_doubly_linked_list_.emplace_front(object_id_pair, std::move(object_data));
-    lru_cache_map_.emplace(object_id_pair, lru_doubly_linked_list_.begin());
-    current_cache_shard_size_bytes_ += object_data_size_bytes;
+    const std::uint32_t entry_index = allocate_entry();
+    cache_entry& entry = entries_[entry_index];
+    entry.key_hash_ = key_hash;
+    entry.key_ = std::move(key);
+    entry.container_name_size_ = container_name_size;
+    entry.object_data_ = std::move(object_data);
+    entry.clock_referenced_.value_.store(false, std::memory_order_relaxed);
+
+    insert_slot(key_hash, entry_index);
+    if (eviction_policy_ == cache_eviction_policy::lru)
+    {
+        lru_push_front(entry_index);
+    }
+    current_cache_shard_size_bytes_ += entry_size_bytes;
 
     return status::success;
 }
 
-std::optional<byte_stream>
+shared_byte_stream
 cache_shard::get(
+    const std::uint64_t key_hash,
     const std::string& object_id,
     const std::string& container_name)
+{
+    if (admission_enabled_)
+    {
+        frequency_sketch_.record_access(key_hash);
+    }
+
+    if (eviction_policy_ == cache_eviction_policy::clock)
+    {
+        std::shared_lock<std::shared_mutex> lock {lock_};
+
+        const std::size_t slot_index = find_slot(
+            key_hash,
+            object_id,
+            container_name);
+
+        if (slot_index == k_null_index)
+        {
+            misses_.fetch_add(1u, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        hits_.fetch_add(1u, std::memory_order_relaxed);
+
+        //
+        // A hit only marks the entry as referenced for the CLOCK hand. Check
+        // before storing to avoid bouncing the cache line between readers of hot keys.
+        //
+        const cache_entry& entry = entries_[hash_table_[slot_index].entry_index_];
+        if (!entry.clock_referenced_.value_.load(std::memory_order_relaxed))
+        {
+            entry.clock_referenced_.value_.store(true, std::memory_order_relaxed);
+        }
+
+        return entry.object_data_;
+    }
+
+    std::unique_lock<std::shared_mutex> lock {lock_};
+
+    const std::size_t slot_index = find_slot(
+        key_hash,
+        object_id,
+        container_name);
+
+    if (slot_index == k_null_index)
+    {
+        misses_.fetch_add(1u, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    hits_.fetch_add(1u, std::memory_order_relaxed);
+
+    //
+    // Relinking the intrusive list is constant time and
+    // does not allocate, given the entry stays in the slab.
+    //
+    const std::uint32_t entry_index = hash_table_[slot_index].entry_index_;
+    if (lru_head_index_ != entry_index)
+    {
+        lru_unlink(entry_index);
+        lru_push_front(entry_index);
+    }
+
+    //
+    // Only the reference count is touched under the lock; the data itself is never copied.
+    //
+    return entries_[entry_index].object_data_;
+}
+
+std::size_t
+cache_shard::get_size_bytes() const
+{
+    std::shared_lock<std::shared_mutex> lock {lock_};
+    return current_cache_shard_size_bytes_;
+}
+
+std::size_t
+cache_shard::get_number_entries() const
+{
+    std::shared_lock<std::shared_mutex> lock {lock_};
+    return number_entries_;
+}
+
+std::size_t
+cache_shard::get_number_negative_entries() const
+{
+    std::shared_lock<std::shared_mutex> lock {lock_};
+    return negative_entries_.size();
+}
+
+std::atomic<std::uint64_t>&
+cache_shard::get_version_stripe(
+    const std::uint64_t key_hash) const
 {
     //
-    // Construct the key object before taking the lock.
+    // Use the upper bits of the hash, given the lower ones index the hash
+    // table and the frontline cache routes to the shard with the upper 32 bits.
     //
-    container_object_id_pair object_id_pair = std::make_pair(
-        container_name,
-        object_id);
+    return version_stripes_[(key_hash >> 16u) & (k_number_version_stripes - 1u)];
+}
 
-    std::lock_guard<std::mutex> lock {lock_};
+cache_statistics
+cache_shard::get_statistics() const
+{
+    return cache_statistics{
+        hits_.load(std::memory_order_relaxed),
+        misses_.load(std::memory_order_relaxed),
+        admissions_.load(std::memory_order_relaxed),
+        rejections_.load(std::memory_order_relaxed),
+        negative_hits_.load(std::memory_order_relaxed)};
+}
+
+bool
+cache_shard::is_same_key(
+    std::string_view key,
+    const std::uint32_t container_name_size,
+    std::string_view object_id,
+    std::string_view container_name)
+{
+    return container_name_size == container_name.size() &&
+           key.size() == container_name.size() + object_id.size() &&
+           key.substr(0u, container_name_size) == container_name &&
+           key.substr(container_name_size) == object_id;
+}
 
-    auto map_object_iterator = lru_cache_map_.find(object_id_pair);
-    if (map_object_iterator == lru_cache_map_.end())
+void
+cache_shard::erase_negative_entry(
+    const std::uint64_t key_hash)
+{
+    //
+    // The queue record is left behind and skipped once it reaches the front.
+    //
+    if (!negative_entries_.empty())
     {
-        return std::nullopt;
+        negative_entries_.erase(key_hash);
     }
+}
+
+std::size_t
+cache_shard::find_slot(
+    const std::uint64_t key_hash,
+    std::string_view object_id,
+    std::string_view container_name) const
+{
+    const std::size_t slots_mask = hash_table_.size() - 1u;
+    std::size_t slot_index = key_hash & slots_mask;
 
     //
-    // For get operations, splicing the cache shard is more efficient
-    // as no elements need to be evicted given the size remains the same.
+    // The load factor guarantees at least one empty slot,
+    // so the probe sequence always terminates.
     //
-    lru_doubly_linked_list_.splice(
-        lru_doubly_linked_list_.begin(),
-        lru_doubly_linked_list_,
-        map_object_iterator->second);
+    while (hash_table_[slot_index].entry_index_ != k_null_index)
+    {
+        const hash_slot& slot = hash_table_[slot_index];
+
+        if (slot.key_hash_ == key_hash)
+        {
+            const cache_entry& entry = entries_[slot.entry_index_];
+
+            if (is_same_key(entry.key_, entry.container_name_size_, object_id, container_name))
+            {
+                return slot_index;
+            }
+        }
+
+        slot_index = (slot_index + 1u) & slots_mask;
+    }
+
+    return k_null_index;
+}
+
+std::size_t
+cache_shard::find_slot_by_entry(
+    const std::uint32_t entry_index) const
+{
+    const std::size_t slots_mask = hash_table_.size() - 1u;
+    std::size_t slot_index = entries_[entry_index].key_hash_ & slots_mask;
+
+    while (hash_table_[slot_index].entry_index_ != entry_index)
+    {
+        slot_index = (slot_index + 1u) & slots_mask;
+    }
+
+    return slot_index;
+}
+
+void
+cache_shard::insert_slot(
+    const std::uint64_t key_hash,
+    const std::uint32_t entry_index)
+{
+    //
+    // Keep the load factor at or below 3/4 to bound the probe sequences.
+    //
+    if ((number_entries_ + 1u) * 4u > hash_table_.size() * 3u)
+    {
+        grow_hash_table();
+    }
+
+    const std::size_t slots_mask = hash_table_.size() - 1u;
+    std::size_t slot_index = key_hash & slots_mask;
+
+    while (hash_table_[slot_index].entry_index_ != k_null_index)
+    {
+        slot_index = (slot_index + 1u) & slots_mask;
+    }
+
+    hash_table_[slot_index] = hash_slot{key_hash, entry_index};
+    ++number_entries_;
+}
+
+void
+cache_shard::erase_slot(
+    std::size_t slot_index)
+{
+    const std::size_t slots_mask = hash_table_.size() - 1u;
+    std::size_t next_slot_index = (slot_index + 1u) & slots_mask;
+
+    while (hash_table_[next_slot_index].entry_index_ != k_null_index)
+    {
+        //
+        // A subsequent slot can fill the hole only if its ideal position
+        // is not within the cyclic range (hole, next], otherwise it would
+        // become unreachable from its own ideal position.
+        //
+        const std::size_t ideal_slot_index = hash_table_[next_slot_index].key_hash_ & slots_mask;
+        if (((next_slot_index - ideal_slot_index) & slots_mask) >=
+            ((next_slot_index - slot_index) & slots_mask))
+        {
+            hash_table_[slot_index] = hash_table_[next_slot_index];
+            slot_index = next_slot_index;
+        }
+
+        next_slot_index = (next_slot_index + 1u) & slots_mask;
+    }
+
+    hash_table_[slot_index].entry_index_ = k_null_index;
+    --number_entries_;
+}
+
+void
+cache_shard::grow_hash_table()
+{
+    std::vector<hash_slot> previous_hash_table(hash_table_.size() * 2u, hash_slot{0u, k_null_index});
+    previous_hash_table.swap(hash_table_);
+
+    const std::size_t slots_mask = hash_table_.size() - 1u;
+    for (const hash_slot& slot : previous_hash_table)
+    {
+        if (slot.entry_index_ == k_null_index)
+        {
+            continue;
+        }
 
-    return std::make_optional<byte_stream>(map_object_iterator->second->second);
+        std::size_t slot_index = slot.key_hash_ & slots_mask;
+        while (hash_table_[slot_index].entry_index_ != k_null_index)
+        {
+            slot_index = (slot_index + 1u) & slots_mask;
+        }
+
+        hash_table_[slot_index] = slot;
+    }
+}
+
+void
+cache_shard::remove_entry(
+    const std::size_t slot_index)
+{
+    const std::uint32_t entry_index = hash_table_[slot_index].entry_index_;
+    current_cache_shard_size_bytes_ -= get_entry_size_bytes(entries_[entry_index]);
+    erase_slot(slot_index);
+    if (eviction_policy_ == cache_eviction_policy::lru)
+    {
+        lru_unlink(entry_index);
+    }
+    release_entry(entry_index);
+}
+
+void
+cache_shard::evict_entry(
+    const std::uint32_t victim_index)
+{
+    remove_entry(find_slot_by_entry(
+        victim_index != k_null_index ? victim_index : find_victim()));
+}
+
+std::uint32_t
+cache_shard::find_victim()
+{
+    return eviction_policy_ == cache_eviction_policy::lru ? lru_tail_index_ : find_clock_victim();
+}
+
+std::uint32_t
+cache_shard::find_clock_victim()
+{
+    //
+    // Entries referenced since the last pass get a second chance.
+    // The sweep ends within two passes over the slab, given the first
+    // pass clears every reference bit it goes through.
+    //
+    while (true)
+    {
+        if (clock_hand_index_ >= entries_.size())
+        {
+            clock_hand_index_ = 0u;
+        }
+
+        const std::uint32_t entry_index = clock_hand_index_++;
+        cache_entry& entry = entries_[entry_index];
+
+        //
+        // Released entries in the slab hold no data.
+        //
+        if (entry.object_data_ == nullptr)
+        {
+            continue;
+        }
+
+        if (entry.clock_referenced_.value_.load(std::memory_order_relaxed))
+        {
+            entry.clock_referenced_.value_.store(false, std::memory_order_relaxed);
+            continue;
+        }
+
+        return entry_index;
+    }
+}
+
+std::uint32_t
+cache_shard::allocate_entry()
+{
+    if (!free_entries_.empty())
+    {
+        const std::uint32_t entry_index = free_entries_.back();
+        free_entries_.pop_back();
+        return entry_index;
+    }
+
+    entries_.emplace_back();
+    return static_cast<std::uint32_t>(entries_.size() - 1u);
+}
+
+void
+cache_shard::release_entry(
+    const std::uint32_t entry_index)
+{
+    //
+    // Swap the key with an empty string instead of clearing it, so the memory
+    // is actually given back. The object data is only freed once the last reader drops it.
+    //
+    cache_entry& entry = entries_[entry_index];
+    std::string{}.swap(entry.key_);
+    entry.object_data_.reset();
+    free_entries_.emplace_back(entry_index);
+}
+
+void
+cache_shard::lru_push_front(
+    const std::uint32_t entry_index)
+{
+    cache_entry& entry = entries_[entry_index];
+    entry.lru_previous_index_ = k_null_index;
+    entry.lru_next_index_ = lru_head_index_;
+
+    if (lru_head_index_ != k_null_index)
+    {
+        entries_[lru_head_index_].lru_previous_index_ = entry_index;
+    }
+    else
+    {
+        lru_tail_index_ = entry_index;
+    }
+
+    lru_head_index_ = entry_index;
+}
+
+void
+cache_shard::lru_unlink(
+    const std::uint32_t entry_index)
+{
+    cache_entry& entry = entries_[entry_index];
+
+    if (entry.lru_previous_index_ != k_null_index)
+    {
+        entries_[entry.lru_previous_index_].lru_next_index_ = entry.lru_next_index_;
+    }
+    else
+    {
+        lru_head_index_ = entry.lru_next_index_;
+    }
+
+    if (entry.lru_next_index_ != k_null_index)
+    {
+        entries_[entry.lru_next_index_].lru_previous_index_ = entry.lru_previous_index_;
+    }
+    else
+    {
+        lru_tail_index_ = entry.lru_previous_index_;
+    }
+}
+
+std::size_t
+cache_shard::get_entry_size_bytes(
+    const cache_entry& entry)
+{
+    return entry.key_.size() + entry.object_data_->size();
 }
 
-} // namespace pandora::storage.
\ No newline at end of file
+} // namespace pandora::storage.
@@ -13,22 +13,60 @@
 //      cache.
 // ****************************************************
 
-// BUGBUG -> Implement removal of objects.
-
 #pragma once
 
-#include <map>
-#include <list>
 #include <mutex>
+#include <deque>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <shared_mutex>
 #include <string>
-#include <utility>
+#include <vector>
+#include <string_view>
+#include <memory>
+#include <cstdint>
 #include <optional>
+#include <absl/container/flat_hash_map.h>
 #include "../../status/status.hh"
 #include "../../common/aliases.hh"
+#include "frequency_sketch.hh"
+#include "cache_eviction_policy.hh"
 
 namespace pandora::storage
 {
 
+//
+// Access and admission counters of the frontline cache.
+//
+struct cache_statistics
+{
+    //
+    // Number of gets served from the cache.
+    //
+    std::uint64_t hits_;
+
+    //
+    // Number of gets not found in the cache.
+    //
+    std::uint64_t misses_;
+
+    //
+    // Number of new objects admitted into the cache.
+    //
+    std::uint64_t admissions_;
+
+    //
+    // Number of new objects rejected by the admission filter.
+    //
+    std::uint64_t rejections_;
+
+    //
+    // Number of gets of absent objects served from the negative entries.
+    //
+    std::uint64_t negative_hits_;
+};
+
 class cache_shard
 {
 public:
@@ -38,37 +76,403 @@ public:
     //
     cache_shard(
         const std::size_t max_cache_shard_size_bytes,
-        const std::size_t max_object_size_bytes);
+        const std::size_t max_object_size_bytes,
+        const cache_eviction_policy eviction_policy,
+        const bool admission_enabled,
+        const std::size_t max_number_negative_entries,
+        const std::uint32_t negative_entry_ttl_ms);
+
+    //
+    // Computes the 64-bit hash for a {ContainerName, ObjectId} key.
+    // Meant to be computed once by the caller, outside of the shard lock.
+    //
+    static
+    std::uint64_t
+    compute_key_hash(
+        const std::string& object_id,
+        const std::string& container_name);
 
     //
     // Inserts an object into the cache shard.
     // Note that the method takes the parameters are movable objects under the core
     // assumption that this must only be called post a write operation and that the references
     // being moved into this method will not be used post-call of this method.
+    // The object data is an immutable buffer which gets shared with the readers.
+    // If the admission filter is enabled and inserting a new object requires an eviction,
+    // the object is only admitted if it is estimated to be more popular than the victim.
+    // Bumps the version of the object, which supersedes any in-flight fill.
     //
     status::status_code
     put(
+        const std::uint64_t key_hash,
         std::string&& object_id,
-        byte_stream&& object_data,
+        shared_byte_stream object_data,
         std::string&& container_name);
 
+    //
+    // Inserts an object read from the storage engine into the cache shard.
+    // The fill is dropped if the object was written or removed since the fill
+    // version was taken, which must happen before reading from the storage engine.
+    //
+    status::status_code
+    fill(
+        const std::uint64_t key_hash,
+        std::string&& object_id,
+        shared_byte_stream object_data,
+        std::string&& container_name,
+        const std::uint64_t fill_version);
+
+    //
+    // Records an object found absent in the storage engine as a negative entry,
+    // so repeated gets of it are answered without a storage engine read until the entry expires.
+    // Dropped with cache_fill_superseded if the object was written or removed since the fill
+    // version was taken. Once the shard holds its maximum number of negative entries, the oldest is evicted.
+    // No-op if negative caching is disabled.
+    //
+    status::status_code
+    fill_negative(
+        const std::uint64_t key_hash,
+        const std::string& object_id,
+        const std::string& container_name,
+        const std::uint64_t fill_version,
+        const std::chrono::steady_clock::time_point now);
+
+    //
+    // Checks whether an object has an unexpired negative entry in the cache shard.
+    // Writes and removals of the object invalidate its negative entry.
+    //
+    bool
+    is_negative(
+        const std::uint64_t key_hash,
+        const std::string& object_id,
+        const std::string& container_name,
+        const std::chrono::steady_clock::time_point now);
+
+    //
+    // Removes an object from the cache shard if present.
+    // Bumps the version of the object, which supersedes any in-flight fill.
+    //
+    void
+    remove(
+        const std::uint64_t key_hash,
+        const std::string& object_id,
+        const std::string& container_name);
+
+    //
+    // Gets the current version of an object, to be used as the fill version
+    // for a later fill. Versions are striped, so objects may share a version.
+    //
+    std::uint64_t
+    get_version(
+        const std::uint64_t key_hash) const;
+
     //
     // Gets an object data if present in the cache.
+    // Returns a reference to the immutable cached buffer without copying it,
+    // which remains valid even if the entry gets evicted. Returns null if not present.
+    // Under the CLOCK policy, hits only take the shard lock in shared mode.
     //
-    std::optional<byte_stream>
+    shared_byte_stream
     get(
+        const std::uint64_t key_hash,
         const std::string& object_id,
         const std::string& container_name);
 
+    //
+    // Gets the current size of the cache shard in bytes.
+    // Accounts for both the keys and the object data of all entries.
+    //
+    std::size_t
+    get_size_bytes() const;
+
+    //
+    // Gets the number of entries in the cache shard.
+    //
+    std::size_t
+    get_number_entries() const;
+
+    //
+    // Gets the number of negative entries in the cache shard, including the expired ones not yet evicted.
+    //
+    std::size_t
+    get_number_negative_entries() const;
+
+    //
+    // Gets a snapshot of the access and admission counters of the cache shard.
+    //
+    cache_statistics
+    get_statistics() const;
+
 private:
 
+    //
+    // Inserts an object into the cache shard. Writes carry no fill version
+    // and bump the object version; fills are checked against their fill version.
+    //
+    status::status_code
+    insert(
+        const std::uint64_t key_hash,
+        std::string&& object_id,
+        shared_byte_stream object_data,
+        std::string&& container_name,
+        const std::optional<std::uint64_t> fill_version);
+
+    //
+    // Gets the version stripe for the given key hash.
+    //
+    std::atomic<std::uint64_t>&
+    get_version_stripe(
+        const std::uint64_t key_hash) const;
+
+    //
+    // Reference bit for the CLOCK policy.
+    // Copyable so the entries slab can grow, which only happens under the exclusive lock.
+    //
+    struct clock_reference_bit
+    {
+        clock_reference_bit() = default;
+
+        clock_reference_bit(
+            const clock_reference_bit& other)
+            : value_{other.value_.load(std::memory_order_relaxed)}
+        {}
+
+        clock_reference_bit&
+        operator=(
+            const clock_reference_bit& other)
+        {
+            value_.store(other.value_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+
+        mutable std::atomic<bool> value_{false};
+    };
+
+    //
+    // Cache entry stored in the contiguous entries slab.
+    // The key is stored once as the concatenation of {ContainerName, ObjectId}.
+    //
+    struct cache_entry
+    {
+        //
+        // Precomputed hash of the key.
+        //
+        std::uint64_t key_hash_;
+
+        //
+        // Concatenated {ContainerName, ObjectId} key.
+        //
+        std::string key_;
+
+        //
+        // Size of the container name prefix within the key.
+        //
+        std::uint32_t container_name_size_;
+
+        //
+        // Immutable object data buffer, shared with the readers.
+        //
+        shared_byte_stream object_data_;
+
+        //
+        // Intrusive LRU list links as indices within the entries slab.
+        // Only maintained under the LRU policy.
+        //
+        std::uint32_t lru_previous_index_;
+        std::uint32_t lru_next_index_;
+
+        //
+        // Set by hits under the CLOCK policy without taking the exclusive lock.
+        //
+        clock_reference_bit clock_referenced_;
+    };
+
+    //
+    // Negative entry for an object found absent in the storage engine.
+    //
+    struct negative_entry
+    {
+        //
+        // Concatenated {ContainerName, ObjectId} key.
+        //
+        std::string key_;
+
+        //
+        // Size of the container name prefix within the key.
+        //
+        std::uint32_t container_name_size_;
+
+        //
+        // Time after which the entry is no longer served.
+        //
+        std::chrono::steady_clock::time_point expiration_time_;
+    };
+
+    //
+    // Open-addressing hash table slot.
+    // Holds the full key hash to avoid touching the entry on probe mismatches.
+    //
+    struct hash_slot
+    {
+        std::uint64_t key_hash_;
+        std::uint32_t entry_index_;
+    };
+
+    //
+    // Sentinel index for empty slots and for the ends of the LRU list.
+    //
+    static constexpr std::uint32_t k_null_index = std::numeric_limits<std::uint32_t>::max();
+
+    //
+    // Initial number of slots in the hash table. Must be a power of two.
+    //
+    static constexpr std::size_t k_initial_number_slots = 16u;
+
+    //
+    // Average entry size assumed for sizing the frequency sketch.
+    //
+    static constexpr std::size_t k_expected_average_entry_size_bytes = 1'024u;
+
+    //
+    // Number of version stripes. Must be a power of two.
+    //
+    static constexpr std::size_t k_number_version_stripes = 1'024u;
+
+    //
+    // Checks whether a concatenated {ContainerName, ObjectId} key matches the given key.
+    //
+    static
+    bool
+    is_same_key(
+        std::string_view key,
+        const std::uint32_t container_name_size,
+        std::string_view object_id,
+        std::string_view container_name);
+
+    //
+    // Erases the negative entry of the given key hash, if any.
+    //
+    void
+    erase_negative_entry(
+        const std::uint64_t key_hash);
+
+    //
+    // Finds the slot holding the given key.
+    // Returns the null index if the key is not present.
+    //
+    std::size_t
+    find_slot(
+        const std::uint64_t key_hash,
+        std::string_view object_id,
+        std::string_view container_name) const;
+
+    //
+    // Finds the slot pointing to the given entry.
+    //
+    std::size_t
+    find_slot_by_entry(
+        const std::uint32_t entry_index) const;
+
+    //
+    // Inserts a slot for the given entry through linear probing.
+    // Grows the hash table beforehand if the load factor would be exceeded.
+    //
+    void
+    insert_slot(
+        const std::uint64_t key_hash,
+        const std::uint32_t entry_index);
+
+    //
+    // Erases a slot by shifting back the subsequent slots of its probe sequence.
+    // This keeps the probe sequences contiguous without the need for tombstones.
+    //
+    void
+    erase_slot(
+        std::size_t slot_index);
+
+    //
+    // Doubles the number of slots and reinserts all entries.
+    //
+    void
+    grow_hash_table();
+
+    //
+    // Removes the entry referenced by the given slot from the cache shard.
+    //
+    void
+    remove_entry(
+        const std::size_t slot_index);
+
+    //
+    // Evicts the given victim entry from the cache shard, or the
+    // next one according to the eviction policy if none is given.
+    //
+    void
+    evict_entry(
+        const std::uint32_t victim_index);
+
+    //
+    // Gets the index of the next entry to be evicted according to the eviction policy.
+    //
+    std::uint32_t
+    find_victim();
+
+    //
+    // Sweeps the CLOCK hand over the slab, clearing the reference bits
+    // on its way, until it finds an unreferenced entry.
+    // Returns the index of the victim entry.
+    //
+    std::uint32_t
+    find_clock_victim();
+
+    //
+    // Takes an entry from the free list or appends a new one into the slab.
+    //
+    std::uint32_t
+    allocate_entry();
+
+    //
+    // Releases the memory of an entry and returns it to the free list.
+    //
+    void
+    release_entry(
+        const std::uint32_t entry_index);
+
+    //
+    // Links an entry at the front of the LRU list.
+    //
+    void
+    lru_push_front(
+        const std::uint32_t entry_index);
+
+    //
+    // Unlinks an entry from the LRU list.
+    //
+    void
+    lru_unlink(
+        const std::uint32_t entry_index);
+
+    //
+    // Gets the size accounted for an entry in bytes.
+    //
+    static
+    std::size_t
+    get_entry_size_bytes(
+        const cache_entry& entry);
+
+    //
+    // Eviction policy for the cache shard.
+    //
+    const cache_eviction_policy eviction_policy_;
+
     //
     // Max cache shard size in bytes.
     //
     const std::size_t max_cache_shard_size_bytes_;
 
     //
-    // Max size for objects to be inserted into the cache shard.
+    // Max size for objects to be inserted into the cache shard,
+    // accounting for both the key and the object data.
     //
     const std::size_t max_object_size_bytes_;
 
@@ -78,22 +482,97 @@ private:
     std::size_t current_cache_shard_size_bytes_;
 
     //
-    // Doubly linked list chain for storing the node objects in a flat structure for direct dereferencing.
-    // Maps a pair of {ContainerName, ObjectId} to a respective object data stream.
+    // Contiguous slab storage for the cache entries.
+    // Entries are referenced by index, so their positions are stable across slab growth.
+    //
+    std::vector<cache_entry> entries_;
+
+    //
+    // Indices of the released entries within the slab, available for reuse.
+    //
+    std::vector<std::uint32_t> free_entries_;
+
+    //
+    // Open-addressing hash table with linear probing.
+    // Maps the {ContainerName, ObjectId} key hash to its respective entry index.
+    //
+    std::vector<hash_slot> hash_table_;
+
+    //
+    // Number of entries currently indexed in the hash table.
+    //
+    std::size_t number_entries_;
+
+    //
+    // Most recently used entry.
+    //
+    std::uint32_t lru_head_index_;
+
+    //
+    // Least recently used entry.
+    //
+    std::uint32_t lru_tail_index_;
+
+    //
+    // Position of the CLOCK hand within the entries slab.
+    //
+    std::uint32_t clock_hand_index_;
+
+    //
+    // Whether new objects go through the admission filter.
+    //
+    const bool admission_enabled_;
+
+    //
+    // Access frequency sketch for the admission filter.
+    // Records accesses on gets without taking the exclusive lock.
+    //
+    frequency_sketch frequency_sketch_;
+
+    //
+    // Access and admission counters.
+    //
+    std::atomic<std::uint64_t> hits_;
+    std::atomic<std::uint64_t> misses_;
+    std::atomic<std::uint64_t> admissions_;
+    std::atomic<std::uint64_t> rejections_;
+    std::atomic<std::uint64_t> negative_hits_;
+
+    //
+    // Maximum number of negative entries in the cache shard. Zero disables negative caching.
+    //
+    const std::size_t max_number_negative_entries_;
+
+    //
+    // Time to live of the negative entries. Bounds how long an object written
+    // outside of the cache invalidation path, such as offline, can be reported absent.
+    //
+    const std::chrono::milliseconds negative_entry_ttl_;
+
+    //
+    // Negative entries indexed by key hash. A key hash collision only
+    // replaces the negative entry of the other key, which is always safe.
+    //
+    absl::flat_hash_map<std::uint64_t, negative_entry> negative_entries_;
+
+    //
+    // Key hashes and expiration times of the negative entries in insertion order. All entries
+    // share the same time to live, so this is also their expiration order. Records of
+    // invalidated or refreshed entries are skipped when they reach the front.
     //
-    std::list<std::pair<std::pair<std::string, std::string>, byte_stream>> lru_doubly_linked_list_;
+    std::deque<std::pair<std::uint64_t, std::chrono::steady_clock::time_point>> negative_entries_queue_;
 
     //
-    // Quick-access cache map for directly dereferencing the node object.
-    // Maps a pair of {ContainerName, ObjectId} to its respective object node iterator.
+    // Striped object versions. Bumped by writes and removals under the exclusive lock,
+    // and read without the lock when taking the fill version before a storage engine read.
     //
-    std::map<std::pair<std::string, std::string>,
-        std::list<std::pair<std::pair<std::string, std::string>, byte_stream>>::iterator> lru_cache_map_;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> version_stripes_;
 
     //
     // Lock for synchronizing access to the cache shard.
+    // Mutations take it exclusively; CLOCK hits take it shared.
     //
-    mutable std::mutex lock_;
+    mutable std::shared_mutex lock_;
 };
 
-} // namespace pandora::storage.
\ No newline at end of file
+} // namespace pandora::storage.
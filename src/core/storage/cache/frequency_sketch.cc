@@ -0,0 +1,120 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'frequency_sketch.cc'
+// Author: jcjuarez
+// Description:
+//      Count-min sketch with 4-bit counters and
+//      periodic aging for cache admission.
+// ****************************************************
+
+#include <bit>
+#include <utility>
+#include <algorithm>
+#include "frequency_sketch.hh"
+
+namespace pandora::storage
+{
+
+frequency_sketch::frequency_sketch(
+    const std::size_t expected_number_entries)
+    : counters_(std::bit_ceil(std::max<std::size_t>(expected_number_entries, 64u))),
+      counters_mask_{counters_.size() - 1u},
+      aging_sample_size_{std::max<std::uint64_t>(expected_number_entries, 64u) * 10u},
+      number_samples_{0u}
+{}
+
+void
+frequency_sketch::record_access(
+    const std::uint64_t key_hash)
+{
+    for (std::uint32_t row = 0u; row < k_number_rows; ++row)
+    {
+        const auto [word_index, bit_offset] = get_counter_location(key_hash, row);
+        std::atomic<std::uint64_t>& word = counters_[word_index];
+        std::uint64_t current_word = word.load(std::memory_order_relaxed);
+
+        //
+        // Saturate the counter instead of overflowing into its neighbour.
+        // Concurrent updates on the same word retry through the exchange.
+        //
+        while (((current_word >> bit_offset) & k_max_counter_value) < k_max_counter_value &&
+               !word.compare_exchange_weak(
+                   current_word,
+                   current_word + (std::uint64_t{1u} << bit_offset),
+                   std::memory_order_relaxed))
+        {}
+    }
+
+    //
+    // Only the access reaching the sample size triggers the aging pass.
+    // Increments racing with it may be partially lost, which is tolerable for an estimate.
+    //
+    if (number_samples_.fetch_add(1u, std::memory_order_relaxed) + 1u == aging_sample_size_)
+    {
+        age();
+        number_samples_.store(0u, std::memory_order_relaxed);
+    }
+}
+
+std::uint8_t
+frequency_sketch::estimate_frequency(
+    const std::uint64_t key_hash) const
+{
+    std::uint64_t frequency = k_max_counter_value;
+
+    for (std::uint32_t row = 0u; row < k_number_rows; ++row)
+    {
+        const auto [word_index, bit_offset] = get_counter_location(key_hash, row);
+        const std::uint64_t counter =
+            (counters_[word_index].load(std::memory_order_relaxed) >> bit_offset) & k_max_counter_value;
+        frequency = std::min(frequency, counter);
+    }
+
+    return static_cast<std::uint8_t>(frequency);
+}
+
+void
+frequency_sketch::age()
+{
+    //
+    // Shifting a whole word right by one halves all of its counters at once,
+    // after masking out the bits that move across counter boundaries.
+    //
+    constexpr std::uint64_t k_halving_mask = 0x7777'7777'7777'7777u;
+
+    for (std::atomic<std::uint64_t>& word : counters_)
+    {
+        std::uint64_t current_word = word.load(std::memory_order_relaxed);
+        while (!word.compare_exchange_weak(
+                   current_word,
+                   (current_word >> 1u) & k_halving_mask,
+                   std::memory_order_relaxed))
+        {}
+    }
+}
+
+std::pair<std::size_t, std::uint32_t>
+frequency_sketch::get_counter_location(
+    const std::uint64_t key_hash,
+    const std::uint32_t row) const
+{
+    //
+    // Derive an independent hash per row by remixing the key hash with a per-row seed.
+    //
+    std::uint64_t row_hash = key_hash + (0x9e37'79b9'7f4a'7c15u * (row + 1u));
+    row_hash = (row_hash ^ (row_hash >> 30u)) * 0xbf58'476d'1ce4'e5b9u;
+    row_hash = (row_hash ^ (row_hash >> 27u)) * 0x94d0'49bb'1331'11ebu;
+    row_hash ^= row_hash >> 31u;
+
+    return std::make_pair(
+        static_cast<std::size_t>((row_hash >> 4u) & counters_mask_),
+        static_cast<std::uint32_t>(row_hash & 0xfu) * 4u);
+}
+
+} // namespace pandora::storage.
@@ -0,0 +1,102 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'frequency_sketch.hh'
+// Author: jcjuarez
+// Description:
+//      Count-min sketch with 4-bit counters and
+//      periodic aging for cache admission.
+// ****************************************************
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+namespace pandora::storage
+{
+
+class frequency_sketch
+{
+public:
+
+    //
+    // Constructor.
+    // The sketch is sized for the expected number of entries of its cache,
+    // and ages all counters after ten times that number of recorded accesses.
+    //
+    frequency_sketch(
+        const std::size_t expected_number_entries);
+
+    //
+    // Records an access for the given key hash.
+    // This is a lock-free operation.
+    //
+    void
+    record_access(
+        const std::uint64_t key_hash);
+
+    //
+    // Estimates the access frequency for the given key hash.
+    // The estimate is saturated at the maximum counter value.
+    //
+    std::uint8_t
+    estimate_frequency(
+        const std::uint64_t key_hash) const;
+
+private:
+
+    //
+    // Halves all counters so the sketch follows the recent popularity of keys.
+    //
+    void
+    age();
+
+    //
+    // Gets the counter location for the given key hash in a sketch row.
+    // Returns the word index and the bit offset of the counter within the word.
+    //
+    std::pair<std::size_t, std::uint32_t>
+    get_counter_location(
+        const std::uint64_t key_hash,
+        const std::uint32_t row) const;
+
+    //
+    // Number of hash rows in the sketch.
+    //
+    static constexpr std::uint32_t k_number_rows = 4u;
+
+    //
+    // Maximum value of a 4-bit counter.
+    //
+    static constexpr std::uint64_t k_max_counter_value = 15u;
+
+    //
+    // Sketch counters, packed as sixteen 4-bit counters per word.
+    //
+    std::vector<std::atomic<std::uint64_t>> counters_;
+
+    //
+    // Mask for indexing the counter words. The number of words is a power of two.
+    //
+    const std::uint64_t counters_mask_;
+
+    //
+    // Number of recorded accesses which triggers an aging pass.
+    //
+    const std::uint64_t aging_sample_size_;
+
+    //
+    // Number of accesses recorded since the last aging pass.
+    //
+    std::atomic<std::uint64_t> number_samples_;
+};
+
+} // namespace pandora::storage.
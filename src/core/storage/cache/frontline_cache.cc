@@ -23,21 +23,33 @@ frontline_cache::frontline_cache(
     const std::uint16_t number_cache_shards,
     const std::size_t max_cache_shard_size_bytes,
     const std::size_t max_object_size_bytes,
+    const cache_eviction_policy eviction_policy,
+    const bool admission_enabled,
+    const std::size_t max_number_negative_entries_per_shard,
+    const std::uint32_t negative_entry_ttl_ms,
     container_index& container_index)
     : number_cache_shards_{number_cache_shards},
+      max_object_size_bytes_{max_object_size_bytes},
+      negative_caching_enabled_{max_number_negative_entries_per_shard > 0u && negative_entry_ttl_ms > 0u},
       container_index_{container_index}
 {
     for (std::uint16_t index = 0; index < number_cache_shards_; ++index)
     {
         cache_shards_table_.emplace_back(
-            std::make_unique<cache_shard>(max_cache_shard_size_bytes, max_object_size_bytes));
+            std::make_unique<cache_shard>(
+                max_cache_shard_size_bytes,
+                max_object_size_bytes,
+                eviction_policy,
+                admission_enabled,
+                negative_caching_enabled_ ? max_number_negative_entries_per_shard : 0u,
+                negative_entry_ttl_ms));
     }
 }
 
 status::status_code
 frontline_cache::put(
     std::string&& object_id,
-    byte_stream&& object_data,
+    shared_byte_stream object_data,
     std::string&& container_name)
 {
     status::status_code status =
@@ -59,16 +71,154 @@ frontline_cache::put(
         return status;
     }
 
+    const std::uint64_t key_hash = cache_shard::compute_key_hash(
+        object_id,
+        container_name);
     const std::uint16_t cache_shard_index =
-        get_associated_cache_shard_index(object_id);
+        get_associated_cache_shard_index(key_hash);
 
     return cache_shards_table_.at(cache_shard_index)->put(
+        key_hash,
         std::move(object_id),
         std::move(object_data),
         std::move(container_name));
 }
 
-std::optional<byte_stream>
+status::status_code
+frontline_cache::fill(
+    std::string&& object_id,
+    shared_byte_stream object_data,
+    std::string&& container_name,
+    const cache_fill_ticket& fill_ticket)
+{
+    status::status_code status =
+        container_index_.get_container_existence_status(container_name);
+
+    if (status != status::container_already_exists)
+    {
+        //
+        // Invalid cache access for an object container which is no longer indexed.
+        //
+        TRACE_LOG(error, "Invalid frontline cache fill operation as the object container is not active. "
+            "ObjectId={}, "
+            "ObjectContainerName={}, "
+            "Status={:#x}.",
+            object_id,
+            container_name,
+            status);
+
+        return status;
+    }
+
+    const std::uint16_t cache_shard_index =
+        get_associated_cache_shard_index(fill_ticket.key_hash_);
+
+    return cache_shards_table_.at(cache_shard_index)->fill(
+        fill_ticket.key_hash_,
+        std::move(object_id),
+        std::move(object_data),
+        std::move(container_name),
+        fill_ticket.version_);
+}
+
+status::status_code
+frontline_cache::fill_negative(
+    const std::string& object_id,
+    const std::string& container_name,
+    const cache_fill_ticket& fill_ticket)
+{
+    if (!negative_caching_enabled_)
+    {
+        return status::success;
+    }
+
+    status::status_code status =
+        container_index_.get_container_existence_status(container_name);
+
+    if (status != status::container_already_exists)
+    {
+        //
+        // Invalid cache access for an object container which is no longer indexed.
+        //
+        TRACE_LOG(error, "Invalid frontline cache negative fill operation as the object container is not active. "
+            "ObjectId={}, "
+            "ObjectContainerName={}, "
+            "Status={:#x}.",
+            object_id,
+            container_name,
+            status);
+
+        return status;
+    }
+
+    const std::uint16_t cache_shard_index =
+        get_associated_cache_shard_index(fill_ticket.key_hash_);
+
+    return cache_shards_table_.at(cache_shard_index)->fill_negative(
+        fill_ticket.key_hash_,
+        object_id,
+        container_name,
+        fill_ticket.version_,
+        std::chrono::steady_clock::now());
+}
+
+bool
+frontline_cache::is_negative(
+    const std::string& object_id,
+    const std::string& container_name)
+{
+    if (!negative_caching_enabled_)
+    {
+        return false;
+    }
+
+    const std::uint64_t key_hash = cache_shard::compute_key_hash(
+        object_id,
+        container_name);
+    const std::uint16_t cache_shard_index =
+        get_associated_cache_shard_index(key_hash);
+
+    return cache_shards_table_.at(cache_shard_index)->is_negative(
+        key_hash,
+        object_id,
+        container_name,
+        std::chrono::steady_clock::now());
+}
+
+void
+frontline_cache::remove(
+    const std::string& object_id,
+    const std::string& container_name)
+{
+    const std::uint64_t key_hash = cache_shard::compute_key_hash(
+        object_id,
+        container_name);
+    const std::uint16_t cache_shard_index =
+        get_associated_cache_shard_index(key_hash);
+
+    cache_shards_table_.at(cache_shard_index)->remove(
+        key_hash,
+        object_id,
+        container_name);
+}
+
+cache_fill_ticket
+frontline_cache::get_fill_ticket(
+    const std::string& object_id,
+    const std::string& container_name) const
+{
+    const std::uint64_t key_hash = cache_shard::compute_key_hash(
+        object_id,
+        container_name);
+    const std::uint16_t cache_shard_index =
+        get_associated_cache_shard_index(key_hash);
+
+    return cache_fill_ticket{
+        key_hash,
+        cache_shards_table_.at(cache_shard_index)->get_version(key_hash)};
+}
+
+shared_byte_stream
 frontline_cache::get(
     const std::string& object_id,
     const std::string& container_name)
@@ -89,27 +239,70 @@ frontline_cache::get(
             container_name,
             status);
 
-        return std::nullopt;
+        return nullptr;
     }
 
+    const std::uint64_t key_hash = cache_shard::compute_key_hash(
+        object_id,
+        container_name);
     const std::uint16_t cache_shard_index =
-        get_associated_cache_shard_index(object_id);
+        get_associated_cache_shard_index(key_hash);
 
     return cache_shards_table_.at(cache_shard_index)->get(
+        key_hash,
         object_id,
         container_name);
 }
 
+bool
+frontline_cache::is_object_size_cacheable(
+    const std::string& object_id,
+    const std::string& container_name,
+    const std::size_t object_size_bytes) const
+{
+    return (container_name.size() + object_id.size() + object_size_bytes) <= max_object_size_bytes_;
+}
+
+cache_statistics
+frontline_cache::get_statistics() const
+{
+    cache_statistics statistics{};
+    for (const std::unique_ptr<cache_shard>& shard : cache_shards_table_)
+    {
+        const cache_statistics shard_statistics = shard->get_statistics();
+        statistics.hits_ += shard_statistics.hits_;
+        statistics.misses_ += shard_statistics.misses_;
+        statistics.admissions_ += shard_statistics.admissions_;
+        statistics.rejections_ += shard_statistics.rejections_;
+        statistics.negative_hits_ += shard_statistics.negative_hits_;
+    }
+
+    return statistics;
+}
+
+std::vector<cache_statistics>
+frontline_cache::get_shard_statistics() const
+{
+    std::vector<cache_statistics> shard_statistics;
+    shard_statistics.reserve(cache_shards_table_.size());
+
+    for (const std::unique_ptr<cache_shard>& shard : cache_shards_table_)
+    {
+        shard_statistics.push_back(shard->get_statistics());
+    }
+
+    return shard_statistics;
+}
+
 std::uint16_t
 frontline_cache::get_associated_cache_shard_index(
-    const std::string& object_id) const
+    const std::uint64_t key_hash) const
 {
     //
-    // For simplicity, the cache shard will be decided by only hashing the
-    // object ID. This implies that identical object IDs from different
-    // containers will land at the same shard.
+    // The key hash is computed once and shared with the cache shard.
+    // Route with the upper bits, given the shard hash tables index with the lower ones.
     //
-    return hasher_(object_id) % number_cache_shards_;
+    return (key_hash >> 32u) % number_cache_shards_;
 }
 
 } // namespace pandora::storage.
\ No newline at end of file
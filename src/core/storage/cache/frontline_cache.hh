@@ -17,7 +17,6 @@
 
 #include <vector>
 #include <memory>
-#include <functional>
 #include "cache_shard.hh"
 
 namespace pandora::storage
@@ -25,6 +24,24 @@ namespace pandora::storage
 
 class container_index;
 
+//
+// Ticket taken before reading an object from the storage engine,
+// which allows filling the cache with the read value only if the
+// object was not written or removed in the meantime.
+//
+struct cache_fill_ticket
+{
+    //
+    // Hash of the {ContainerName, ObjectId} key.
+    //
+    std::uint64_t key_hash_;
+
+    //
+    // Version of the object at the time the ticket was taken.
+    //
+    std::uint64_t version_;
+};
+
 class frontline_cache
 {
 public:
@@ -36,6 +53,10 @@ public:
         const std::uint16_t number_cache_shards,
         const std::size_t max_cache_shard_size_bytes,
         const std::size_t max_object_size_bytes,
+        const cache_eviction_policy eviction_policy,
+        const bool admission_enabled,
+        const std::size_t max_number_negative_entries_per_shard,
+        const std::uint32_t negative_entry_ttl_ms,
         container_index& container_index);
 
     //
@@ -47,29 +68,104 @@ public:
     status::status_code
     put(
         std::string&& object_id,
-        byte_stream&& object_data,
+        shared_byte_stream object_data,
         std::string&& container_name);
 
+    //
+    // Inserts an object read from the storage engine into the cache shard.
+    // The insertion is dropped with cache_fill_superseded if the object
+    // was written or removed since the fill ticket was taken.
+    //
+    status::status_code
+    fill(
+        std::string&& object_id,
+        shared_byte_stream object_data,
+        std::string&& container_name,
+        const cache_fill_ticket& fill_ticket);
+
+    //
+    // Records an object found absent in the storage engine, so repeated gets of it are
+    // answered from the cache until the negative entry expires. The fill ticket must have been
+    // taken before the read; the record is dropped if the object was written or removed since.
+    //
+    status::status_code
+    fill_negative(
+        const std::string& object_id,
+        const std::string& container_name,
+        const cache_fill_ticket& fill_ticket);
+
+    //
+    // Checks whether an object is known to be absent from its container.
+    // Always false if negative caching is disabled.
+    //
+    bool
+    is_negative(
+        const std::string& object_id,
+        const std::string& container_name);
+
+    //
+    // Removes an object from the cache if present.
+    // Removals do not check for the container existence, so
+    // objects are invalidated even while their container is being deleted.
+    //
+    void
+    remove(
+        const std::string& object_id,
+        const std::string& container_name);
+
+    //
+    // Takes a fill ticket for an object. Must be called before
+    // reading the object from the storage engine to fill the cache.
+    //
+    cache_fill_ticket
+    get_fill_ticket(
+        const std::string& object_id,
+        const std::string& container_name) const;
+
     //
     // Gets an object data if present in the cache.
     // Note that if the object is not present in the cache, it will not be inserted.
     // This is a design choice as this is called from the server threads and there is no
     // need to consume computation resources to insert it at the step of checking if an entry exists.
     // Eventually, if the object needs to be inserted, it will be inserted by the IO thread pools.
+    // Returns a reference to the immutable cached buffer, or null if not present.
     //
-    std::optional<byte_stream>
+    shared_byte_stream
     get(
         const std::string& object_id,
         const std::string& container_name);
 
+    //
+    // Checks whether an object of the given size fits under the per-object cache limit,
+    // which accounts for its {ContainerName, ObjectId} key as well.
+    // Allows callers to skip materializing a cacheable copy of an oversized object.
+    //
+    bool
+    is_object_size_cacheable(
+        const std::string& object_id,
+        const std::string& container_name,
+        const std::size_t object_size_bytes) const;
+
+    //
+    // Gets the access and admission counters aggregated across all cache shards.
+    //
+    cache_statistics
+    get_statistics() const;
+
+    //
+    // Gets the access and admission counters of every cache shard, indexed by shard.
+    //
+    std::vector<cache_statistics>
+    get_shard_statistics() const;
+
 private:
 
     //
-    // Gets the cache shard index by hashing the given object ID.
+    // Gets the cache shard index for the given {ContainerName, ObjectId} key hash.
     //
     std::uint16_t
     get_associated_cache_shard_index(
-        const std::string& object_id) const;
+        const std::uint64_t key_hash) const;
 
     //
     // Table for storing the internal cache shards.
@@ -77,14 +173,20 @@ private:
     std::vector<std::unique_ptr<cache_shard>> cache_shards_table_;
 
     //
-    // Hasher for routing an object ID to its respective cache shard.
+    // Number of shards in the cache.
+    //
+    const std::uint16_t number_cache_shards_;
+
+    //
+    // Maximum size for a single object to be cached,
+    // accounting for both the key and the object data.
     //
-    std::hash<std::string> hasher_;
+    const std::size_t max_object_size_bytes_;
 
     //
-    // Number of shards in the cache.
+    // Whether absent objects are recorded as negative entries.
     //
-    const std::uint16_t number_cache_shards_;
+    const bool negative_caching_enabled_;
 
     //
     // Container index component handle.
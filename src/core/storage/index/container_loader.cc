@@ -90,28 +90,10 @@ container_loader::load_container_index(
     storage_engine_reference* container_metadata_engine_reference =
         metadata_partition_references.at(k_containers_container_name_metadata_partition);
 
-    //
-    // Get all known object containers to the system from the
-    // persistent container metadata and populate the rest of the object container index.
-    //
-    std::unordered_map<std::string, byte_stream> containers_present_on_metadata;
-    status::status_code status = metadata_partition_.get_storage_engine().get_all_objects_from_container(
-        container_metadata_engine_reference,
-        &containers_present_on_metadata);
-
-    if (status::failed(status))
-    {
-        TRACE_LOG(critical, "Failed to get all container names from the container metadata partition. "
-            "Status={:#x}.",
-            status);
-
-        return status;
-    }
-
     //
     // Index all container metadata containers.
     //
-    status = index_containers_from_metadata_partition(
+    status::status_code status = index_containers_from_metadata_partition(
         metadata_partition_references);
 
     if (status::failed(status))
@@ -127,8 +109,10 @@ container_loader::load_container_index(
     // Index all containers known to the persistent
     // container metadata into the container index.
     //
+    std::unordered_set<std::string> containers_present_on_metadata;
     status = index_containers_from_structured_data_partitions(
         structured_partitions_registry,
+        container_metadata_engine_reference,
         containers_present_on_metadata);
 
     if (status::failed(status))
@@ -296,12 +280,33 @@ container_loader::index_containers_from_metadata_partition(
 status::status_code
 container_loader::index_containers_from_structured_data_partitions(
     container_registry& structured_partitions_registry,
-    std::unordered_map<std::string, byte_stream>& containers_present_on_metadata)
+    storage_engine_reference* container_metadata_engine_reference,
+    std::unordered_set<std::string>& containers_present_on_metadata)
 {
-    for (auto& container_present_on_metadata : containers_present_on_metadata)
+    //
+    // Stream all known object containers to the system from the persistent
+    // container metadata, so only the container names are kept resident.
+    //
+    std::unique_ptr<storage_engine_iterator> metadata_iterator;
+    status::status_code status = metadata_partition_.get_storage_engine().create_object_iterator(
+        container_metadata_engine_reference,
+        &metadata_iterator);
+
+    if (status::failed(status))
     {
-        const std::string& container_name = container_present_on_metadata.first;
-        const byte_stream& container_raw_metadata = container_present_on_metadata.second;
+        TRACE_LOG(critical, "Failed to iterate over the container names from the container metadata partition. "
+            "Status={:#x}.",
+            status);
+
+        return status;
+    }
+
+    for (metadata_iterator->SeekToFirst(); metadata_iterator->Valid(); metadata_iterator->Next())
+    {
+        const std::string container_name = metadata_iterator->key().ToString();
+        const rocksdb::Slice container_raw_metadata = metadata_iterator->value();
+        containers_present_on_metadata.insert(container_name);
+
         const std::optional<std::vector<storage_engine_reference*>> engine_references =
             structured_partitions_registry.get_references(container_name);
 
@@ -329,7 +334,7 @@ container_loader::index_containers_from_structured_data_partitions(
         // All other containers not present on the metadata are considered as dirty filesystem state,
         // so their integrity is irrelevant for system startup.
         //
-        status::status_code status = structured_partitions_registry.execute_integrity_validation(
+        status = structured_partitions_registry.execute_integrity_validation(
             container_name);
 
         if (status::failed(status))
@@ -345,7 +350,9 @@ container_loader::index_containers_from_structured_data_partitions(
         }
 
         schemas::container_persistent_interface container_persistent_metadata;
-        const bool is_parsing_successful = container_persistent_metadata.ParseFromString(container_raw_metadata);
+        const bool is_parsing_successful = container_persistent_metadata.ParseFromArray(
+            container_raw_metadata.data(),
+            static_cast<std::int32_t>(container_raw_metadata.size()));
         if (!is_parsing_successful)
         {
             TRACE_LOG(critical, "Failed to parse a container raw metadata on startup. "
@@ -382,13 +389,31 @@ container_loader::index_containers_from_structured_data_partitions(
             container->to_string());
     }
 
+    //
+    // If an error occurred, it will only be discovered after the storage
+    // iteration, so error handling must be handled post iterator traversal.
+    //
+    if (!metadata_iterator->status().ok())
+    {
+        status = status::objects_retrieval_from_container_failed;
+        TRACE_LOG(critical, "Failed to get all container names from the container metadata partition. "
+            "StorageEngineCode={}, "
+            "StorageEngineSubCode={}, "
+            "Status={:#x}.",
+            static_cast<std::uint32_t>(metadata_iterator->status().code()),
+            static_cast<std::uint32_t>(metadata_iterator->status().subcode()),
+            status);
+
+        return status;
+    }
+
     return status::success;
 }
 
 status::status_code
 container_loader::scan_and_index_orphaned_containers(
     container_registry& structured_partitions_registry,
-    std::unordered_map<std::string, byte_stream>& containers_present_on_metadata)
+    const std::unordered_set<std::string>& containers_present_on_metadata)
 {
     for (const auto& registry_entry : structured_partitions_registry)
     {
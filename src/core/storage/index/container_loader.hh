@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_set>
 #include "../../status/status.hh"
 #include "../../common/aliases.hh"
 #include "../models/container_instance.hh"
@@ -80,11 +82,13 @@ private:
 
     //
     // Indexes the structured data partition containers known to the persistent container metadata.
+    // Streams the persistent container metadata and returns the names of the containers found on it.
     //
     status::status_code
     index_containers_from_structured_data_partitions(
         container_registry& structured_partitions_registry,
-        std::unordered_map<std::string, byte_stream>& containers_present_on_metadata);
+        storage_engine_reference* container_metadata_engine_reference,
+        std::unordered_set<std::string>& containers_present_on_metadata);
 
     //
     // Scans for orphaned containers and index them for garbage collection if found.
@@ -92,7 +96,7 @@ private:
     status::status_code
     scan_and_index_orphaned_containers(
         container_registry& structured_partitions_registry,
-        std::unordered_map<std::string, byte_stream>& containers_present_on_metadata);
+        const std::unordered_set<std::string>& containers_present_on_metadata);
 
     //
     // Converts a given list of ordered storage engine references by collocation index
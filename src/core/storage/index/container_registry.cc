@@ -15,14 +15,15 @@
 
 #include <unordered_set>
 #include "container_registry.hh"
-#include "../../startup/collocation_builder.hh"
 
 namespace pandora
 {
 namespace storage
 {
 
-container_registry::container_registry()
+container_registry::container_registry(
+    const std::uint16_t number_collocations)
+    : number_collocations_{number_collocations}
 {}
 
 status::status_code
@@ -61,7 +62,7 @@ container_registry::register_container_reference(
     //
     references_map_.try_emplace(
         container_name,
-        collocation_builder::k_number_collocations,
+        number_collocations_,
         nullptr);
     references_map_.at(container_name).at(collocation_index) = engine_reference;
 
@@ -86,14 +87,14 @@ container_registry::execute_integrity_validation(
     // and make sure all references are different.
     //
     auto& container_references = references_map_.at(container_name);
-    if (container_references.size() != collocation_builder::k_number_collocations)
+    if (container_references.size() != number_collocations_)
     {
         TRACE_LOG(critical, "Container contains unexpected number of storage engine references. "
             "ContainerName={}, "
             "ExpectedNumEngineReferences={}, "
             "FoundNumEngineReferences={}.",
             container_name,
-            collocation_builder::k_number_collocations,
+            number_collocations_,
             container_references.size());
 
         return status::invalid_number_engine_references;
@@ -32,8 +32,10 @@ public:
 
     //
     // Constructor.
+    // Every container is expected to have one reference per collocation.
     //
-    container_registry();
+    container_registry(
+        const std::uint16_t number_collocations);
 
     //
     // Iterators for range traversal support.
@@ -89,6 +91,11 @@ private:
     // Maps a reference to a collocation index,
     //
     std::unordered_map<storage_engine_reference*, std::uint16_t> references_discovered_;
+
+    //
+    // Number of collocations in the system.
+    //
+    const std::uint16_t number_collocations_;
 };
 
 } // namespace storage.
@@ -0,0 +1,279 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'collocation_topology.cc'
+// Author: jcjuarez
+// Description:
+//      Persistent marker for the number of
+//      collocations the data store was created with.
+// ****************************************************
+
+#include <limits>
+#include <fstream>
+#include <filesystem>
+#include "collocation_topology.hh"
+#include "../../common/aliases.hh"
+#include "../../startup/collocation_builder.hh"
+
+namespace pandora
+{
+namespace storage
+{
+
+status::status_code
+collocation_topology::validate_number_collocations(
+    const std::string& kv_store_path,
+    const std::uint16_t number_collocations)
+{
+    std::optional<std::uint16_t> persisted_number_collocations;
+    status::status_code status = read_number_collocations(
+        kv_store_path,
+        persisted_number_collocations);
+
+    if (status::failed(status))
+    {
+        return status;
+    }
+
+    if (!persisted_number_collocations.has_value())
+    {
+        TRACE_LOG(info, "No collocation topology found for the data store. "
+            "Persisting the configured topology. "
+            "NumCollocations={}.",
+            number_collocations);
+
+        return persist_number_collocations(
+            kv_store_path,
+            number_collocations);
+    }
+
+    if (persisted_number_collocations.value() != number_collocations)
+    {
+        status = status::collocation_topology_mismatch;
+        TRACE_LOG(critical, "The configured number of collocations does not match the persisted "
+            "collocation topology. Reshard the data store offline before changing it. "
+            "ConfiguredNumCollocations={}, "
+            "PersistedNumCollocations={}, "
+            "Status={:#x}.",
+            number_collocations,
+            persisted_number_collocations.value(),
+            status);
+
+        return status;
+    }
+
+    return status::success;
+}
+
+status::status_code
+collocation_topology::read_number_collocations(
+    const std::string& kv_store_path,
+    std::optional<std::uint16_t>& number_collocations)
+{
+    const std::string marker_path = get_marker_path(kv_store_path, k_marker_file_name);
+
+    if (!std::filesystem::exists(marker_path))
+    {
+        //
+        // Data stores created before the topology marker existed have the
+        // metadata partition at the index following the legacy number of collocations.
+        //
+        const std::string legacy_metadata_partition_path =
+            kv_store_path + "/" +
+            collocation_builder::k_metadata_partition_prefix + "-" +
+            std::to_string(k_legacy_number_collocations);
+
+        if (std::filesystem::exists(legacy_metadata_partition_path))
+        {
+            number_collocations = k_legacy_number_collocations;
+        }
+        else
+        {
+            number_collocations.reset();
+        }
+
+        return status::success;
+    }
+
+    std::ifstream marker_file{marker_path};
+    std::int64_t persisted_number_collocations = 0;
+
+    //
+    // Read into a wider type, so out of range values are rejected instead of wrapping around.
+    //
+    if (!(marker_file >> persisted_number_collocations) ||
+        !is_valid_number_collocations(persisted_number_collocations))
+    {
+        status::status_code status = status::collocation_topology_marker_failed;
+        TRACE_LOG(critical, "Failed to read the collocation topology marker. "
+            "MarkerPath={}, "
+            "Status={:#x}.",
+            marker_path,
+            status);
+
+        return status;
+    }
+
+    number_collocations = static_cast<std::uint16_t>(persisted_number_collocations);
+
+    return status::success;
+}
+
+status::status_code
+collocation_topology::persist_number_collocations(
+    const std::string& kv_store_path,
+    const std::uint16_t number_collocations)
+{
+    return write_marker_file(
+        kv_store_path,
+        get_marker_path(kv_store_path, k_marker_file_name),
+        std::to_string(number_collocations) + "\n");
+}
+
+status::status_code
+collocation_topology::read_resharding_intent(
+    const std::string& kv_store_path,
+    std::optional<resharding_intent>& resharding_intent)
+{
+    const std::string marker_path = get_marker_path(kv_store_path, k_resharding_intent_file_name);
+
+    if (!std::filesystem::exists(marker_path))
+    {
+        resharding_intent.reset();
+        return status::success;
+    }
+
+    std::ifstream marker_file{marker_path};
+    std::int64_t source_number_collocations = 0;
+    std::int64_t target_number_collocations = 0;
+
+    if (!(marker_file >> source_number_collocations >> target_number_collocations) ||
+        !is_valid_number_collocations(source_number_collocations) ||
+        !is_valid_number_collocations(target_number_collocations))
+    {
+        status::status_code status = status::collocation_topology_marker_failed;
+        TRACE_LOG(critical, "Failed to read the resharding intent marker. "
+            "MarkerPath={}, "
+            "Status={:#x}.",
+            marker_path,
+            status);
+
+        return status;
+    }
+
+    resharding_intent = storage::resharding_intent{
+        static_cast<std::uint16_t>(source_number_collocations),
+        static_cast<std::uint16_t>(target_number_collocations)};
+
+    return status::success;
+}
+
+status::status_code
+collocation_topology::persist_resharding_intent(
+    const std::string& kv_store_path,
+    const resharding_intent& resharding_intent)
+{
+    return write_marker_file(
+        kv_store_path,
+        get_marker_path(kv_store_path, k_resharding_intent_file_name),
+        std::to_string(resharding_intent.source_number_collocations_) + " " +
+            std::to_string(resharding_intent.target_number_collocations_) + "\n");
+}
+
+status::status_code
+collocation_topology::remove_resharding_intent(
+    const std::string& kv_store_path)
+{
+    const std::string marker_path = get_marker_path(kv_store_path, k_resharding_intent_file_name);
+    std::error_code error_code;
+
+    std::filesystem::remove(marker_path, error_code);
+
+    if (error_code)
+    {
+        status::status_code status = status::collocation_topology_marker_failed;
+        TRACE_LOG(critical, "Failed to remove the resharding intent marker. "
+            "MarkerPath={}, "
+            "ErrorMessage={}, "
+            "Status={:#x}.",
+            marker_path,
+            error_code.message(),
+            status);
+
+        return status;
+    }
+
+    return status::success;
+}
+
+bool
+collocation_topology::is_valid_number_collocations(
+    const std::int64_t number_collocations)
+{
+    return number_collocations >= 1 &&
+           number_collocations <= k_max_number_collocations;
+}
+
+std::string
+collocation_topology::get_marker_path(
+    const std::string& kv_store_path,
+    const char* marker_file_name)
+{
+    return kv_store_path + "/" + marker_file_name;
+}
+
+status::status_code
+collocation_topology::write_marker_file(
+    const std::string& kv_store_path,
+    const std::string& marker_path,
+    const std::string& marker_contents)
+{
+    const std::string temporary_marker_path = marker_path + ".tmp";
+    std::error_code error_code;
+
+    std::filesystem::create_directories(kv_store_path, error_code);
+
+    {
+        std::ofstream marker_file{temporary_marker_path, std::ios::trunc};
+        marker_file << marker_contents;
+        marker_file.flush();
+
+        if (!marker_file)
+        {
+            error_code = std::make_error_code(std::errc::io_error);
+        }
+    }
+
+    //
+    // Write to a temporary file and rename it over the marker,
+    // so a crash never leaves a partially written marker behind.
+    //
+    if (!error_code)
+    {
+        std::filesystem::rename(temporary_marker_path, marker_path, error_code);
+    }
+
+    if (error_code)
+    {
+        status::status_code status = status::collocation_topology_marker_failed;
+        TRACE_LOG(critical, "Failed to persist the collocation topology marker. "
+            "MarkerPath={}, "
+            "ErrorMessage={}, "
+            "Status={:#x}.",
+            marker_path,
+            error_code.message(),
+            status);
+
+        return status;
+    }
+
+    return status::success;
+}
+
+} // namespace storage.
+} // namespace pandora.
@@ -0,0 +1,155 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'collocation_topology.hh'
+// Author: jcjuarez
+// Description:
+//      Persistent marker for the number of
+//      collocations the data store was created with.
+// ****************************************************
+
+#pragma once
+
+#include <limits>
+#include <string>
+#include <cstdint>
+#include <optional>
+#include "../../status/status.hh"
+
+namespace pandora
+{
+namespace storage
+{
+
+//
+// Source and target number of collocations of a resharding
+// whose swap of data partitions has started.
+//
+struct resharding_intent
+{
+    std::uint16_t source_number_collocations_;
+    std::uint16_t target_number_collocations_;
+};
+
+class collocation_topology
+{
+public:
+
+    //
+    // Validates that the configured number of collocations matches the persisted one.
+    // Starting with a different number would route keys to the wrong data partitions,
+    // so the data store must be resharded offline before changing it.
+    // Persists the configured number on a first-time startup.
+    //
+    static
+    status::status_code
+    validate_number_collocations(
+        const std::string& kv_store_path,
+        const std::uint16_t number_collocations);
+
+    //
+    // Reads the persisted number of collocations.
+    // Leaves the output empty if the data store has not been created yet.
+    // Data stores created before the marker existed are assumed to use the legacy number.
+    //
+    static
+    status::status_code
+    read_number_collocations(
+        const std::string& kv_store_path,
+        std::optional<std::uint16_t>& number_collocations);
+
+    //
+    // Persists the number of collocations atomically.
+    //
+    static
+    status::status_code
+    persist_number_collocations(
+        const std::string& kv_store_path,
+        const std::uint16_t number_collocations);
+
+    //
+    // Reads the intent of a resharding whose swap of data partitions did not complete.
+    // Leaves the output empty if no swap is in progress.
+    //
+    static
+    status::status_code
+    read_resharding_intent(
+        const std::string& kv_store_path,
+        std::optional<resharding_intent>& resharding_intent);
+
+    //
+    // Persists the intent of a resharding atomically, before swapping its data partitions.
+    //
+    static
+    status::status_code
+    persist_resharding_intent(
+        const std::string& kv_store_path,
+        const resharding_intent& resharding_intent);
+
+    //
+    // Removes the intent of a resharding once its swap of data partitions completed.
+    //
+    static
+    status::status_code
+    remove_resharding_intent(
+        const std::string& kv_store_path);
+
+    //
+    // Checks whether a number of collocations is within the supported range.
+    //
+    static
+    bool
+    is_valid_number_collocations(
+        const std::int64_t number_collocations);
+
+    //
+    // Number of collocations of data stores created before it was configurable.
+    //
+    static constexpr std::uint16_t k_legacy_number_collocations = 8u;
+
+    //
+    // Maximum number of collocations. The metadata partition
+    // takes the index following the last collocation.
+    //
+    static constexpr std::uint16_t k_max_number_collocations = std::numeric_limits<std::uint16_t>::max() - 1u;
+
+private:
+
+    //
+    // Gets the path of the given marker file inside the core key-value store path.
+    //
+    static
+    std::string
+    get_marker_path(
+        const std::string& kv_store_path,
+        const char* marker_file_name);
+
+    //
+    // Writes a marker file atomically through a temporary file
+    // renamed over it, so a crash never leaves it partially written.
+    //
+    static
+    status::status_code
+    write_marker_file(
+        const std::string& kv_store_path,
+        const std::string& marker_path,
+        const std::string& marker_contents);
+
+    //
+    // Name of the topology marker file inside the core key-value store path.
+    //
+    static constexpr const char* k_marker_file_name = "TOPOLOGY";
+
+    //
+    // Name of the resharding intent marker file inside the core key-value store path.
+    //
+    static constexpr const char* k_resharding_intent_file_name = "RESHARDING";
+};
+
+} // namespace storage.
+} // namespace pandora.
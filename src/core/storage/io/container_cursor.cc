@@ -0,0 +1,238 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'container_cursor.cc'
+// Author: jcjuarez
+// Description:
+//      Key-ordered cursor over the objects of an object
+//      container across all of its collocations.
+// ****************************************************
+
+#include <algorithm>
+#include "container_cursor.hh"
+
+namespace pandora
+{
+namespace storage
+{
+
+container_cursor::container_cursor(
+    std::vector<std::unique_ptr<storage_engine_iterator>> object_iterators)
+    : object_iterators_{std::move(object_iterators)}
+{
+    merge_heap_.reserve(object_iterators_.size());
+}
+
+status::status_code
+container_cursor::seek(
+    const std::string& start_after_object_id)
+{
+    merge_heap_.clear();
+
+    for (std::size_t iterator_index = 0u; iterator_index < object_iterators_.size(); ++iterator_index)
+    {
+        storage_engine_iterator& object_iterator = *object_iterators_[iterator_index];
+
+        if (start_after_object_id.empty())
+        {
+            object_iterator.SeekToFirst();
+        }
+        else
+        {
+            //
+            // The continuation point is exclusive, as the
+            // object was already returned in the previous page.
+            //
+            object_iterator.Seek(start_after_object_id);
+            if (object_iterator.Valid() &&
+                object_iterator.key() == rocksdb::Slice{start_after_object_id})
+            {
+                object_iterator.Next();
+            }
+        }
+
+        const status::status_code status = push_iterator(iterator_index);
+
+        if (status::failed(status))
+        {
+            return status;
+        }
+    }
+
+    return status::success;
+}
+
+status::status_code
+container_cursor::next()
+{
+    if (merge_heap_.empty())
+    {
+        return status::success;
+    }
+
+    auto comparator = [this](const std::size_t first, const std::size_t second)
+    {
+        return is_iterator_key_greater(first, second);
+    };
+
+    std::pop_heap(merge_heap_.begin(), merge_heap_.end(), comparator);
+    const std::size_t iterator_index = merge_heap_.back();
+    merge_heap_.pop_back();
+
+    object_iterators_[iterator_index]->Next();
+
+    return push_iterator(iterator_index);
+}
+
+bool
+container_cursor::is_valid() const
+{
+    return !merge_heap_.empty();
+}
+
+std::string_view
+container_cursor::get_object_id() const
+{
+    const rocksdb::Slice key = object_iterators_[merge_heap_.front()]->key();
+    return std::string_view{key.data(), key.size()};
+}
+
+std::string_view
+container_cursor::get_object_data() const
+{
+    const rocksdb::Slice value = object_iterators_[merge_heap_.front()]->value();
+    return std::string_view{value.data(), value.size()};
+}
+
+std::string
+container_cursor::encode_continuation_token(
+    std::string_view object_id)
+{
+    //
+    // Hex-encode the object ID, so the token is safe to embed in any response
+    // format and clients do not take a dependency on its contents.
+    //
+    static constexpr char k_hex_digits[] = "0123456789abcdef";
+    std::string continuation_token;
+    continuation_token.reserve(object_id.size() * 2u);
+
+    for (const char character : object_id)
+    {
+        const auto byte_value = static_cast<std::uint8_t>(character);
+        continuation_token.push_back(k_hex_digits[byte_value >> 4u]);
+        continuation_token.push_back(k_hex_digits[byte_value & 0xfu]);
+    }
+
+    return continuation_token;
+}
+
+bool
+container_cursor::decode_continuation_token(
+    std::string_view continuation_token,
+    std::string& object_id)
+{
+    auto decode_hex_digit = [](const char digit) -> std::int32_t
+    {
+        if (digit >= '0' && digit <= '9')
+        {
+            return digit - '0';
+        }
+
+        if (digit >= 'a' && digit <= 'f')
+        {
+            return digit - 'a' + 10;
+        }
+
+        return -1;
+    };
+
+    if (continuation_token.size() % 2u != 0u)
+    {
+        return false;
+    }
+
+    object_id.clear();
+    object_id.reserve(continuation_token.size() / 2u);
+
+    for (std::size_t index = 0u; index < continuation_token.size(); index += 2u)
+    {
+        const std::int32_t high = decode_hex_digit(continuation_token[index]);
+        const std::int32_t low = decode_hex_digit(continuation_token[index + 1u]);
+
+        if (high < 0 || low < 0)
+        {
+            return false;
+        }
+
+        object_id.push_back(static_cast<char>((high << 4) | low));
+    }
+
+    return true;
+}
+
+status::status_code
+container_cursor::push_iterator(
+    const std::size_t iterator_index)
+{
+    storage_engine_iterator& object_iterator = *object_iterators_[iterator_index];
+
+    if (!object_iterator.Valid())
+    {
+        //
+        // An exhausted iterator is not pushed back. An iterator can also stop
+        // due to a storage engine error, which fails the whole traversal.
+        //
+        const rocksdb::Status engine_status = object_iterator.status();
+
+        if (!engine_status.ok())
+        {
+            status::status_code status = status::objects_retrieval_from_container_failed;
+            TRACE_LOG(error, "Failed to iterate over the objects of an object container. "
+                "IteratorIndex={}, "
+                "StorageEngineCode={}, "
+                "StorageEngineSubCode={}, "
+                "Status={:#x}.",
+                iterator_index,
+                static_cast<std::uint32_t>(engine_status.code()),
+                static_cast<std::uint32_t>(engine_status.subcode()),
+                status);
+
+            merge_heap_.clear();
+
+            return status;
+        }
+
+        return status::success;
+    }
+
+    merge_heap_.push_back(iterator_index);
+    std::push_heap(
+        merge_heap_.begin(),
+        merge_heap_.end(),
+        [this](const std::size_t first, const std::size_t second)
+        {
+            return is_iterator_key_greater(first, second);
+        });
+
+    return status::success;
+}
+
+bool
+container_cursor::is_iterator_key_greater(
+    const std::size_t first_iterator_index,
+    const std::size_t second_iterator_index) const
+{
+    //
+    // Bytewise comparison, matching the key order of the storage engine.
+    //
+    return object_iterators_[first_iterator_index]->key().compare(
+        object_iterators_[second_iterator_index]->key()) > 0;
+}
+
+} // namespace storage.
+} // namespace pandora.
@@ -0,0 +1,128 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'container_cursor.hh'
+// Author: jcjuarez
+// Description:
+//      Key-ordered cursor over the objects of an object
+//      container across all of its collocations.
+// ****************************************************
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <string_view>
+#include "../../status/status.hh"
+#include "../../common/aliases.hh"
+
+namespace pandora
+{
+namespace storage
+{
+
+class container_cursor
+{
+public:
+
+    //
+    // Constructor.
+    // Takes one object iterator per collocation of the object container. The cursor
+    // executes a k-way merge over them, so objects are visited in global key order
+    // while only the current position of each iterator is resident in memory.
+    //
+    container_cursor(
+        std::vector<std::unique_ptr<storage_engine_iterator>> object_iterators);
+
+    //
+    // Positions the cursor on the first object with a key greater than the given object ID.
+    // An empty object ID positions the cursor on the first object of the container.
+    //
+    status::status_code
+    seek(
+        const std::string& start_after_object_id);
+
+    //
+    // Advances the cursor to the next object in key order.
+    //
+    status::status_code
+    next();
+
+    //
+    // Checks whether the cursor is positioned on an object.
+    //
+    bool
+    is_valid() const;
+
+    //
+    // Gets the object ID at the current position.
+    // The view is only valid until the cursor is moved.
+    //
+    std::string_view
+    get_object_id() const;
+
+    //
+    // Gets the object data at the current position.
+    // The view is only valid until the cursor is moved.
+    //
+    std::string_view
+    get_object_data() const;
+
+    //
+    // Encodes the object ID of the last object returned to a client
+    // into an opaque continuation token for resuming the scan.
+    //
+    static
+    std::string
+    encode_continuation_token(
+        std::string_view object_id);
+
+    //
+    // Decodes a continuation token into the object ID to resume the scan after.
+    // Returns false if the token is malformed.
+    //
+    static
+    bool
+    decode_continuation_token(
+        std::string_view continuation_token,
+        std::string& object_id);
+
+private:
+
+    //
+    // Pushes the iterator into the merge heap if it is positioned on an object.
+    // Returns a failure if the iterator stopped due to a storage engine error.
+    //
+    status::status_code
+    push_iterator(
+        const std::size_t iterator_index);
+
+    //
+    // Compares the current keys of two iterators for the merge min-heap.
+    //
+    bool
+    is_iterator_key_greater(
+        const std::size_t first_iterator_index,
+        const std::size_t second_iterator_index) const;
+
+    //
+    // Per-collocation object iterators.
+    //
+    std::vector<std::unique_ptr<storage_engine_iterator>> object_iterators_;
+
+    //
+    // Min-heap with the indices of the iterators positioned on an object,
+    // ordered by their current key. Its front is the current position of the cursor.
+    // Every key lives in a single collocation, so there are no duplicates to merge.
+    //
+    std::vector<std::size_t> merge_heap_;
+};
+
+} // namespace storage.
+} // namespace pandora.
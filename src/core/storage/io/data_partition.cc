@@ -12,9 +12,9 @@
 //      Data storage partition instance for IO access.
 // ****************************************************
 
-#include "rocksdb/table.h"
 #include "data_partition.hh"
 #include "storage_engine.hh"
+#include <rocksdb/statistics.h>
 
 namespace pandora
 {
@@ -25,10 +25,12 @@ data_partition::data_partition(
     const std::string& partition_prefix,
     const std::uint16_t collocation_index,
     const storage_configuration& storage_configuration,
-    std::unique_ptr<storage_engine_interface> storage_engine)
+    std::unique_ptr<storage_engine_interface> storage_engine,
+    std::shared_ptr<const storage_engine_resources> storage_engine_resources)
     : collocation_index_{collocation_index},
       storage_engine_{std::move(storage_engine)},
       storage_configuration_{storage_configuration},
+      storage_engine_resources_{std::move(storage_engine_resources)},
       partition_path_{generate_partition_path(
         partition_prefix,
         collocation_index,
@@ -40,16 +42,19 @@ data_partition::boot(
     const std::vector<std::string>& containers_names,
     std::unordered_map<std::string, storage_engine_reference*>& storage_engine_references_mapping)
 {
+    const rocksdb::Options options = generate_engine_configurations();
     std::vector<rocksdb::ColumnFamilyDescriptor> column_family_descriptors;
 
     //
     // Append all mappings for the core key-value store initialization.
+    // All object containers use the engine configurations of the partition,
+    // so their tables are served from the shared block cache.
     //
     for (const auto& container_name : containers_names)
     {
         column_family_descriptors.emplace_back(
             container_name,
-            rocksdb::ColumnFamilyOptions());
+            rocksdb::ColumnFamilyOptions(options));
     }
 
     if (!std::filesystem::exists(partition_path_))
@@ -70,7 +75,6 @@ data_partition::boot(
     }
 
     rocksdb::DB* persistent_store;
-    const rocksdb::Options options = generate_engine_configurations();
     std::vector<storage_engine_reference*> storage_engine_references;
 
     //
@@ -201,13 +205,6 @@ data_partition::generate_engine_configurations() const
     rocksdb::Options options;
     options.create_if_missing = true;
 
-    //
-    // Increase the number of flushing threads to the
-    // same as the number of logical cores on the system.
-    //
-    options.IncreaseParallelism(
-        static_cast<std::int32_t>(std::thread::hardware_concurrency()));
-
     //
     // Optimize the compaction for
     // avoiding write stalls under heavy load.
@@ -215,15 +212,46 @@ data_partition::generate_engine_configurations() const
     options.OptimizeLevelStyleCompaction();
 
     //
-    // The engine will start with a block cache with an LRU-backed policy.
+    // The block cache, write buffer manager and background thread pools
+    // are shared by all data partitions instead of being created per partition.
+    //
+    storage_engine_resources_->apply_to_engine_configurations(options);
+
+    //
+    // Every partition keeps its own statistics, so engine behaviour can be told apart per collocation.
     //
-    rocksdb::BlockBasedTableOptions table_options;
-    table_options.block_cache = rocksdb::NewLRUCache(
-        storage_configuration_.storage_engine_block_cache_size_mib_ * 1024u * 1024u);
-        options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+    if (storage_configuration_.storage_engine_statistics_level_ != storage_engine_statistics_level::disabled)
+    {
+        options.statistics = rocksdb::CreateDBStatistics();
+        options.statistics->set_stats_level(get_engine_statistics_level(
+            storage_configuration_.storage_engine_statistics_level_));
+    }
 
     return options;
 }
 
+rocksdb::StatsLevel
+data_partition::get_engine_statistics_level(
+    const storage_engine_statistics_level statistics_level)
+{
+    switch (statistics_level)
+    {
+        case storage_engine_statistics_level::except_histograms:
+        {
+            return rocksdb::StatsLevel::kExceptHistogramOrTimers;
+        }
+
+        case storage_engine_statistics_level::all:
+        {
+            return rocksdb::StatsLevel::kAll;
+        }
+
+        default:
+        {
+            return rocksdb::StatsLevel::kExceptDetailedTimers;
+        }
+    }
+}
+
 } // namespace storage.
 } // namespace pandora.
\ No newline at end of file
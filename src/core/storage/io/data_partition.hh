@@ -17,10 +17,12 @@
 #include <memory>
 #include <cstdint>
 #include <rocksdb/db.h>
+#include <rocksdb/statistics.h>
 #include "../../status/status.hh"
 #include "../../common/aliases.hh"
 #include "../storage_configuration.hh"
 #include "storage_engine_interface.hh"
+#include "storage_engine_resources.hh"
 
 namespace pandora
 {
@@ -34,12 +36,14 @@ public:
     //
     // Constructor.
     // A valid storage engine instance must be provided.
+    // The storage engine resources are shared by all data partitions.
     //
     data_partition(
         const std::string& partition_prefix,
         const std::uint16_t collocation_index,
         const storage_configuration& storage_configuration,
-        std::unique_ptr<storage_engine_interface> storage_engine);
+        std::unique_ptr<storage_engine_interface> storage_engine,
+        std::shared_ptr<const storage_engine_resources> storage_engine_resources);
 
     //
     // Boots the data partition.
@@ -93,6 +97,14 @@ private:
     rocksdb::Options
     generate_engine_configurations() const;
 
+    //
+    // Gets the engine statistics level for the configured statistics level.
+    //
+    static
+    rocksdb::StatsLevel
+    get_engine_statistics_level(
+        const storage_engine_statistics_level statistics_level);
+
     //
     // Storage engine for the data partition.
     // Access to the engine should be done while always
@@ -105,6 +117,11 @@ private:
     //
     const storage_configuration storage_configuration_;
 
+    //
+    // Process-wide storage engine resources shared with all other data partitions.
+    //
+    std::shared_ptr<const storage_engine_resources> storage_engine_resources_;
+
     //
     // Corresponding data collocation index.
     //
@@ -28,13 +28,15 @@ data_partition_table::append_partition(
     const std::string& partition_prefix,
     const std::uint16_t collocation_index,
     const storage_configuration& storage_configuration,
-    std::unique_ptr<storage_engine> storage_engine)
+    std::unique_ptr<storage_engine> storage_engine,
+    std::shared_ptr<const storage_engine_resources> storage_engine_resources)
 {
     partitions_.emplace_back(
         partition_prefix,
         collocation_index,
         storage_configuration,
-        std::move(storage_engine));
+        std::move(storage_engine),
+        std::move(storage_engine_resources));
 }
 
 data_partition&
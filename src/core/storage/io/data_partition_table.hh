@@ -42,7 +42,8 @@ public:
         const std::string& partition_prefix,
         const std::uint16_t collocation_index,
         const storage_configuration& storage_configuration,
-        std::unique_ptr<storage_engine> storage_engine);
+        std::unique_ptr<storage_engine> storage_engine,
+        std::shared_ptr<const storage_engine_resources> storage_engine_resources);
 
     //
     // Returns a non-owning reference to a data partition.
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <vector>
+#include "../../status/status.hh"
 #include "../models/object_io_task.hh"
 #include "../../common/interface.hh"
 
@@ -26,6 +28,17 @@ class io_dispatcher_interface : common::interface
 {
 public:
 
+    //
+    // Reserves room in the dispatcher queue for a group of IO operations before they are
+    // enqueued. Fails with a retryable status if the queue is at capacity, in which case
+    // the operations must not be enqueued. Implementers without a bounded queue always succeed.
+    //
+    virtual
+    status::status_code
+    try_admit_io_tasks(
+        const std::size_t number_tasks,
+        const std::uint64_t size_bytes) = 0;
+
     //
     // Enqueues an IO operation for to be processed by the dispatcher.
     // Implementers must provide a response back to the server through the async callback.
@@ -35,6 +48,16 @@ public:
     enqueue_io_task(
         object_io_task&& object_io_task) = 0;
 
+    //
+    // Enqueues multiple IO operations at once, so they
+    // are made visible to the dispatcher back-to-back.
+    // Implementers must provide a response back for each of them.
+    //
+    virtual
+    void
+    enqueue_io_tasks(
+        std::vector<object_io_task>&& object_io_tasks) = 0;
+
     //
     // Waits for the dispatcher to be stopped in a blocking manner.
     //
@@ -0,0 +1,85 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'io_queue_budget.cc'
+// Author: jcjuarez
+// Description:
+//      Lock-free capacity budget for bounding the
+//      number of tasks and bytes held by an IO queue.
+// ****************************************************
+
+#include "io_queue_budget.hh"
+
+namespace pandora::storage
+{
+
+io_queue_budget::io_queue_budget(
+    const std::uint64_t max_number_tasks,
+    const std::uint64_t max_size_bytes)
+    : number_tasks_{0u},
+      size_bytes_{0u},
+      max_number_tasks_{max_number_tasks},
+      max_size_bytes_{max_size_bytes}
+{}
+
+bool
+io_queue_budget::try_acquire(
+    const std::uint64_t number_tasks,
+    const std::uint64_t size_bytes)
+{
+    //
+    // Reserve optimistically and roll back on overflow. This keeps admission to
+    // a single atomic operation per counter in the common case of a non-full queue.
+    //
+    const std::uint64_t previous_number_tasks = number_tasks_.fetch_add(number_tasks, std::memory_order_relaxed);
+    const std::uint64_t previous_size_bytes = size_bytes_.fetch_add(size_bytes, std::memory_order_relaxed);
+
+    if (previous_number_tasks == 0u)
+    {
+        return true;
+    }
+
+    const bool exceeds_number_tasks =
+        max_number_tasks_ != 0u && previous_number_tasks + number_tasks > max_number_tasks_;
+    const bool exceeds_size_bytes =
+        max_size_bytes_ != 0u && previous_size_bytes + size_bytes > max_size_bytes_;
+
+    if (exceeds_number_tasks || exceeds_size_bytes)
+    {
+        release(
+            number_tasks,
+            size_bytes);
+
+        return false;
+    }
+
+    return true;
+}
+
+void
+io_queue_budget::release(
+    const std::uint64_t number_tasks,
+    const std::uint64_t size_bytes)
+{
+    number_tasks_.fetch_sub(number_tasks, std::memory_order_relaxed);
+    size_bytes_.fetch_sub(size_bytes, std::memory_order_relaxed);
+}
+
+std::uint64_t
+io_queue_budget::get_number_tasks() const
+{
+    return number_tasks_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t
+io_queue_budget::get_size_bytes() const
+{
+    return size_bytes_.load(std::memory_order_relaxed);
+}
+
+} // namespace pandora::storage.
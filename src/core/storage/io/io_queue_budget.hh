@@ -0,0 +1,91 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'io_queue_budget.hh'
+// Author: jcjuarez
+// Description:
+//      Lock-free capacity budget for bounding the
+//      number of tasks and bytes held by an IO queue.
+// ****************************************************
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace pandora::storage
+{
+
+class io_queue_budget
+{
+public:
+
+    //
+    // Constructor. A zero limit disables the corresponding bound.
+    //
+    io_queue_budget(
+        const std::uint64_t max_number_tasks,
+        const std::uint64_t max_size_bytes);
+
+    //
+    // Tries to reserve room for a group of tasks. Returns false if the group would
+    // exceed any of the limits, in which case nothing is reserved. A group is always
+    // admitted into an empty queue, so oversized groups can still make progress.
+    // Racing reservations close to the limits may be rejected spuriously.
+    // This is a lock-free operation.
+    //
+    bool
+    try_acquire(
+        const std::uint64_t number_tasks,
+        const std::uint64_t size_bytes);
+
+    //
+    // Returns the room of a group of tasks previously reserved.
+    // This is a lock-free operation.
+    //
+    void
+    release(
+        const std::uint64_t number_tasks,
+        const std::uint64_t size_bytes);
+
+    //
+    // Gets the number of tasks currently reserved.
+    //
+    std::uint64_t
+    get_number_tasks() const;
+
+    //
+    // Gets the number of bytes currently reserved.
+    //
+    std::uint64_t
+    get_size_bytes() const;
+
+private:
+
+    //
+    // Number of tasks currently reserved.
+    //
+    std::atomic<std::uint64_t> number_tasks_;
+
+    //
+    // Number of bytes currently reserved.
+    //
+    std::atomic<std::uint64_t> size_bytes_;
+
+    //
+    // Maximum number of tasks which can be reserved at once.
+    //
+    const std::uint64_t max_number_tasks_;
+
+    //
+    // Maximum number of bytes which can be reserved at once.
+    //
+    const std::uint64_t max_size_bytes_;
+};
+
+} // namespace pandora::storage.
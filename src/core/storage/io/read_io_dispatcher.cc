@@ -10,42 +10,91 @@
 // Author: jcjuarez
 // Description:
 //      Read request dispatcher module for IO.
-//      Implemented as a thread pool dispatcher.
+//      Coalesces the pending reads of a collocation
+//      into multi-gets on the shared read IO thread pool.
 // ****************************************************
 
+#include <chrono>
+#include <iterator>
+#include <string_view>
+#include <algorithm>
 #include "storage_engine.hh"
 #include "read_io_executor.hh"
 #include "read_io_dispatcher.hh"
 #include "../cache/cache_accessor.hh"
+#include "../cache/frontline_cache.hh"
+#include "../../metrics/metrics_registry.hh"
+#include "../../common/work_stealing_thread_pool.hh"
 
 namespace pandora::storage
 {
 
 read_io_dispatcher::read_io_dispatcher(
-    const std::uint32_t number_read_io_threads,
+    const std::uint16_t collocation_index,
+    const std::uint32_t read_io_batch_max_number_tasks,
+    const std::uint32_t read_io_batch_max_wait_time_us,
+    common::work_stealing_thread_pool& read_io_thread_pool,
     std::unique_ptr<read_io_executor> read_io_executor,
     cache_accessor& cache_accessor)
-    : read_io_executor_{std::move(read_io_executor)},
+    : collocation_index_{collocation_index},
+      read_io_thread_pool_{read_io_thread_pool},
+      read_io_executor_{std::move(read_io_executor)},
       cache_accessor_{cache_accessor},
-      read_io_thread_pool_{number_read_io_threads},
-      num_read_io_threads_{number_read_io_threads}
+      read_io_batch_max_number_tasks_{std::max(read_io_batch_max_number_tasks, 1u)},
+      read_io_batch_max_wait_time_us_{read_io_batch_max_wait_time_us},
+      number_pending_read_io_tasks_{0u},
+      drain_scheduled_{false},
+      batching_window_deadline_{}
 {}
 
+status::status_code
+read_io_dispatcher::try_admit_io_tasks(
+    const std::size_t number_tasks,
+    const std::uint64_t size_bytes)
+{
+    return status::success;
+}
+
 void
 read_io_dispatcher::enqueue_io_task(
     object_io_task&& read_io_task)
 {
     //
-    // Enqueue the async IO action.
-    // This is a concurrent operation.
+    // This is a lock-free operation. The task is counted as pending
+    // before being enqueued, so the count never falls behind the queue.
     //
-    boost::asio::post(read_io_thread_pool_,
-        [this,
-        read_io_task = std::move(read_io_task)]() mutable
-        {
-          this->dispatch_read_io_task(
-              std::move(read_io_task));
-        });
+    add_pending_read_io_tasks(1u);
+    pending_read_io_tasks_queue_.enqueue(
+        std::make_unique<object_io_task>(
+            std::move(read_io_task)));
+
+    schedule_read_io_tasks_drain();
+}
+
+void
+read_io_dispatcher::enqueue_io_tasks(
+    std::vector<object_io_task>&& read_io_tasks)
+{
+    std::vector<std::unique_ptr<object_io_task>> read_io_task_handles;
+    read_io_task_handles.reserve(read_io_tasks.size());
+
+    for (object_io_task& read_io_task : read_io_tasks)
+    {
+        read_io_task_handles.emplace_back(
+            std::make_unique<object_io_task>(
+                std::move(read_io_task)));
+    }
+
+    //
+    // This is a lock-free operation. All tasks are counted as pending
+    // before being enqueued, so the count never falls behind the queue.
+    //
+    add_pending_read_io_tasks(read_io_task_handles.size());
+    pending_read_io_tasks_queue_.enqueue_bulk(
+        std::make_move_iterator(read_io_task_handles.begin()),
+        read_io_task_handles.size());
+
+    schedule_read_io_tasks_drain();
 }
 
 void
@@ -54,100 +103,370 @@ read_io_dispatcher::wait_for_stop()
     //
     // This call will make sure that all queued and in-progress
     // tasks within the thread pool are completed, in a blocking manner.
+    // The pool is shared, so this waits for the reads of all collocations.
     //
     read_io_thread_pool_.join();
 }
 
 void
-read_io_dispatcher::dispatch_read_io_task(
-    object_io_task&& read_io_task)
+read_io_dispatcher::schedule_read_io_tasks_drain()
 {
     //
-    // At this point of execution, this scope guarantees that the
-    // object container will be held for as long as the storage API takes,
-    // so it is safe to only pass down the storage engine reference given
-    // the storage engine reference will not be dropped by the storage engine.
+    // Only a single drain owner exists per collocation, so concurrent
+    // reads that arrive while it waits for a thread get coalesced into its batch.
+    // The collocation index keeps the drains on the same worker queue
+    // while the pool is balanced; idle workers steal them when the load is skewed.
     //
-    byte_stream object_data;
-    status::status_code status = execute_read_io_task(
-        read_io_task,
-        object_data);
+    if (!drain_scheduled_.exchange(true, std::memory_order_seq_cst))
+    {
+        post_read_io_tasks_drain_owner();
+    }
+}
 
-    if (status::failed(status))
+void
+read_io_dispatcher::post_read_io_tasks_drain_owner()
+{
+    const bool is_posted = read_io_thread_pool_.post(
+        [this]()
+        {
+            this->drain_read_io_tasks(true /* is_drain_owner */);
+        },
+        collocation_index_);
+
+    if (!is_posted)
+    {
+        TRACE_LOG(critical, "Failed to schedule the drain of the pending read IO tasks "
+            "as the read IO thread pool was already stopped. "
+            "CollocationIndex={}, "
+            "NumberPendingReadIOTasks={}.",
+            collocation_index_,
+            number_pending_read_io_tasks_.load(std::memory_order_relaxed));
+    }
+}
+
+void
+read_io_dispatcher::add_pending_read_io_tasks(
+    const std::size_t number_tasks)
+{
+    const std::size_t previous_number_pending_read_io_tasks =
+        number_pending_read_io_tasks_.fetch_add(number_tasks, std::memory_order_seq_cst);
+
+    if (read_io_batch_max_wait_time_us_ > 0u &&
+        previous_number_pending_read_io_tasks < read_io_batch_max_number_tasks_ &&
+        previous_number_pending_read_io_tasks + number_tasks >= read_io_batch_max_number_tasks_)
+    {
+        batch_filled_semaphore_.signal();
+    }
+}
+
+void
+read_io_dispatcher::drain_read_io_tasks(
+    const bool is_drain_owner)
+{
+    if (is_drain_owner &&
+        is_batching_window_open())
+    {
+        if (read_io_thread_pool_.has_pending_tasks())
+        {
+            //
+            // Other work is waiting for a worker, so give this one back
+            // to the pool while the batch fills up, and check again once re-posted.
+            //
+            post_read_io_tasks_drain_owner();
+            return;
+        }
+
+        //
+        // Nothing else is waiting for a worker, so wait for the batch to fill
+        // up in place instead of re-posting the drain owner until the window closes.
+        //
+        wait_for_batching_window();
+    }
+
+    std::vector<std::unique_ptr<object_io_task>> read_io_tasks(read_io_batch_max_number_tasks_);
+    const std::size_t number_read_io_tasks = dequeue_read_io_tasks_batch(read_io_tasks);
+
+    if (is_drain_owner &&
+        number_read_io_tasks == 0u)
     {
         //
-        // Empty response on failure.
+        // Release the drain and check the pending count, given a task enqueued
+        // after the last dequeue attempt could have observed the drain as still scheduled.
+        // Producers count their tasks before checking the flag, so either they schedule
+        // a new drain owner or the count shows their tasks here. The count is checked
+        // instead of the queue, as a completed enqueue is not guaranteed to be visible
+        // to the next dequeue attempt; the drain owner is re-posted until it is.
         //
-        network::server::send_response(
-            read_io_task.response_callback_,
-            status);
+        drain_scheduled_.store(false, std::memory_order_seq_cst);
+
+        if (number_pending_read_io_tasks_.load(std::memory_order_seq_cst) > 0u &&
+            !drain_scheduled_.exchange(true, std::memory_order_seq_cst))
+        {
+            post_read_io_tasks_drain_owner();
+        }
 
         return;
     }
 
-    //
-    // On success, send the response fields with the object data.
-    //
-    network::response_fields response_fields;
-    response_fields.emplace(schemas::object_request::object_data_key_tag, &object_data);
-    network::server::send_response(
-        read_io_task.response_callback_,
-        status,
-        &response_fields);
+    if (number_read_io_tasks == read_io_batch_max_number_tasks_)
+    {
+        //
+        // A full batch means more reads are likely pending, so post a helper
+        // to execute the next batch in parallel on another read IO thread.
+        //
+        read_io_thread_pool_.post(
+            [this]()
+            {
+                this->drain_read_io_tasks(false /* is_drain_owner */);
+            },
+            collocation_index_);
+    }
+
+    if (number_read_io_tasks > 0u)
+    {
+        execute_read_io_tasks_batch(std::span<std::unique_ptr<object_io_task>>{
+            read_io_tasks.data(),
+            number_read_io_tasks});
+    }
+
+    if (is_drain_owner)
+    {
+        //
+        // Re-post the drain owner instead of looping in place,
+        // so the drains of other collocations are not starved.
+        //
+        post_read_io_tasks_drain_owner();
+    }
+}
+
+bool
+read_io_dispatcher::is_batching_window_open()
+{
+    const std::size_t number_pending_read_io_tasks =
+        number_pending_read_io_tasks_.load(std::memory_order_relaxed);
+
+    if (read_io_batch_max_wait_time_us_ == 0u ||
+        number_pending_read_io_tasks == 0u ||
+        number_pending_read_io_tasks >= read_io_batch_max_number_tasks_)
+    {
+        batching_window_deadline_ = {};
+        return false;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+
+    if (batching_window_deadline_ == std::chrono::steady_clock::time_point{})
+    {
+        //
+        // Open the batching window to give concurrent reads
+        // of the collocation the chance to join the same multi-get.
+        //
+        batching_window_deadline_ = now +
+            std::chrono::microseconds(read_io_batch_max_wait_time_us_);
 
+        return true;
+    }
+
+    if (now < batching_window_deadline_)
+    {
+        return true;
+    }
+
+    batching_window_deadline_ = {};
+    return false;
+}
+
+void
+read_io_dispatcher::wait_for_batching_window()
+{
     //
-    // If the operation was successful, insert the object into the cache,
-    // but only after replying back to the server. Cache insertions triggered
-    // by get operations do not need a strong feedback loop; eventual cache alignment is accepted.
+    // Discard the signals of the batches filled while no drain owner was waiting.
+    // The pending count is incremented before signaling, so a full batch whose
+    // signal is discarded here is seen by the window check right after.
     //
-    cache_accessor_.insert_object_into_cache(
-        read_io_task.object_request_);
+    while (batch_filled_semaphore_.tryWait())
+    {}
+
+    while (is_batching_window_open())
+    {
+        const auto remaining_wait_time = std::chrono::duration_cast<std::chrono::microseconds>(
+            batching_window_deadline_ - std::chrono::steady_clock::now());
+
+        batch_filled_semaphore_.wait(std::max<std::int64_t>(remaining_wait_time.count(), 0));
+    }
 }
 
-status::status_code
-read_io_dispatcher::execute_read_io_task(
-    object_io_task& read_io_task,
-    byte_stream& object_data)
+std::size_t
+read_io_dispatcher::dequeue_read_io_tasks_batch(
+    std::vector<std::unique_ptr<object_io_task>>& read_io_tasks)
+{
+    const std::size_t number_read_io_tasks = pending_read_io_tasks_queue_.try_dequeue_bulk(
+        read_io_tasks.begin(),
+        read_io_tasks.size());
+
+    if (number_read_io_tasks > 0u)
+    {
+        number_pending_read_io_tasks_.fetch_sub(number_read_io_tasks, std::memory_order_seq_cst);
+    }
+
+    return number_read_io_tasks;
+}
+
+void
+read_io_dispatcher::execute_read_io_tasks_batch(
+    std::span<std::unique_ptr<object_io_task>> read_io_tasks)
 {
+    std::vector<pinned_byte_stream> objects_data(read_io_tasks.size());
+    std::vector<status::status_code> statuses(read_io_tasks.size(), status::success);
+    std::vector<cache_fill_ticket> fill_tickets;
+    fill_tickets.reserve(read_io_tasks.size());
+
     //
-    // The underlying storage engine is of blocking nature,
-    // so all threads reaching the storage engine API will block until
-    // the storage IO makes progress, as to later provide a response to the client.
+    // Only get operations can be coalesced into the multi-get.
+    // Any other optype should have been rejected before enqueuing the task.
     //
-    switch (read_io_task.object_request_.get_optype())
+    std::size_t number_get_tasks = 0u;
+    std::size_t number_expired_tasks = 0u;
+    const auto dequeue_time = std::chrono::steady_clock::now();
+
+    for (std::size_t index = 0u; index < read_io_tasks.size(); ++index)
     {
-        case schemas::object_request_optype::get:
-        {
-            return read_io_executor_->execute_get_operation(
-                read_io_task.collocation_index_,
-                read_io_task.container_->get_engine_reference(read_io_task.collocation_index_),
-                read_io_task.object_request_,
-                object_data);
-        }
-        default:
+        metrics::metrics_registry::record_io_queue_wait(
+            metrics::io_queue::read,
+            collocation_index_,
+            read_io_tasks[index]->creation_time_);
+
+        if (read_io_tasks[index]->object_request_.get_optype() == schemas::object_request_optype::get)
         {
             //
-            // This should never happen given this should have been
-            // taken care of before enqueuing the task to the thread pool.
+            // Leave the reads whose client gave up waiting out of the multi-get.
             //
-            TRACE_LOG(critical, "Invalid read request optype for object "
-                "operation scheduled in the read IO thread pool. "
-                "Optype={}, "
-                "ObjectId={}, "
-                "ObjectContainerName={}.",
-                static_cast<std::uint8_t>(read_io_task.object_request_.get_optype()),
-                read_io_task.object_request_.get_object_id(),
-                read_io_task.object_request_.get_container_name());
-
-            return status::invalid_operation;
+            if (read_io_tasks[index]->is_expired(dequeue_time))
+            {
+                ++number_expired_tasks;
+                continue;
+            }
+
+            std::swap(read_io_tasks[number_get_tasks], read_io_tasks[index]);
+            ++number_get_tasks;
+            continue;
         }
+
+        TRACE_LOG(critical, "Invalid read request optype for object "
+            "operation scheduled in the read IO thread pool. "
+            "Optype={}, "
+            "ObjectId={}, "
+            "ObjectContainerName={}.",
+            static_cast<std::uint8_t>(read_io_tasks[index]->object_request_.get_optype()),
+            read_io_tasks[index]->object_request_.get_object_id(),
+            read_io_tasks[index]->object_request_.get_container_name());
+    }
+
+    for (std::size_t index = number_get_tasks; index < read_io_tasks.size(); ++index)
+    {
+        statuses[index] = read_io_tasks[index]->object_request_.get_optype() == schemas::object_request_optype::get ?
+            status::deadline_exceeded :
+            status::invalid_operation;
     }
+
+    if (number_expired_tasks > 0u)
+    {
+        metrics::metrics_registry::record_expired_io_tasks(
+            metrics::io_queue::read,
+            collocation_index_,
+            number_expired_tasks);
+    }
+
+    //
+    // Take the cache fill tickets before reading from the storage engine, so
+    // a value read before a concurrent write or removal is not cached after it.
+    //
+    for (std::size_t index = 0u; index < number_get_tasks; ++index)
+    {
+        fill_tickets.emplace_back(
+            cache_accessor_.get_cache_fill_ticket(read_io_tasks[index]->object_request_));
+    }
+
+    //
+    // The underlying storage engine is of blocking nature,
+    // so the thread reaching the storage engine API will block until
+    // the storage IO makes progress, as to later provide a response to the clients.
+    //
+    if (number_get_tasks > 0u)
+    {
+        read_io_executor_->execute_get_operations(
+            collocation_index_,
+            read_io_tasks.first(number_get_tasks),
+            std::span<pinned_byte_stream>{objects_data}.first(number_get_tasks),
+            std::span<status::status_code>{statuses}.first(number_get_tasks));
+    }
+
+    for (std::size_t index = 0u; index < read_io_tasks.size(); ++index)
+    {
+        complete_read_io_task(
+            *read_io_tasks[index],
+            objects_data[index],
+            statuses[index],
+            index < number_get_tasks ? &fill_tickets[index] : nullptr);
+
+        read_io_tasks[index].reset();
+    }
+}
+
+void
+read_io_dispatcher::complete_read_io_task(
+    object_io_task& read_io_task,
+    pinned_byte_stream& object_data,
+    const status::status_code status,
+    const cache_fill_ticket* fill_ticket)
+{
+    //
+    // Provide the outcome back to the client, or to the batch the task belongs to.
+    // The response is written straight from the pinned storage engine block.
+    //
+    const std::string_view object_data_view{
+        object_data.data(),
+        object_data.size()};
+    read_io_task.complete(
+        status,
+        object_data_view);
+
+    if (status == status::object_not_found)
+    {
+        //
+        // Remember the absence of the object, so repeated misses on it are
+        // answered from the frontline cache without reaching the storage engine.
+        //
+        cache_accessor_.fill_negative_object_into_cache(
+            read_io_task.object_request_,
+            *fill_ticket);
+
+        return;
+    }
+
+    if (status::failed(status))
+    {
+        return;
+    }
+
+    //
+    // If the operation was successful, insert the retrieved object into the cache,
+    // but only after replying back to the server. Cache insertions triggered
+    // by get operations do not need a strong feedback loop; eventual cache alignment is accepted.
+    // The fill is dropped if the object was written or removed after the fill ticket was taken.
+    // The cached buffer is copied from the same pinned block, which is released right after.
+    //
+    cache_accessor_.fill_object_into_cache(
+        read_io_task.object_request_,
+        object_data_view,
+        *fill_ticket);
+    object_data.Reset();
 }
 
 std::uint32_t
 read_io_dispatcher::get_num_io_threads()
 {
-    return num_read_io_threads_;
+    return read_io_thread_pool_.get_num_threads();
 }
 
 } // namespace pandora::storage.
\ No newline at end of file
@@ -10,20 +10,35 @@
 // Author: jcjuarez
 // Description:
 //      Read request dispatcher module for IO.
-//      Implemented as a thread pool dispatcher.
+//      Coalesces the pending reads of a collocation
+//      into multi-gets on the shared read IO thread pool.
 // ****************************************************
 
 #pragma once
 
-#include <boost/asio.hpp>
+#include <span>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
 #include "io_dispatcher_interface.hh"
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
 #include "../../network/server/server.hh"
 #include "../../schemas/request-interfaces/object_request.hh"
 
+namespace pandora::common
+{
+
+class work_stealing_thread_pool;
+
+} // namespace pandora::common.
+
 namespace pandora::storage
 {
 
 class cache_accessor;
+struct cache_fill_ticket;
 class read_io_executor;
 
 class read_io_dispatcher : public io_dispatcher_interface
@@ -34,20 +49,41 @@ public:
     // Constructor.
     //
     read_io_dispatcher(
-        const std::uint32_t number_read_io_threads,
+        const std::uint16_t collocation_index,
+        const std::uint32_t read_io_batch_max_number_tasks,
+        const std::uint32_t read_io_batch_max_wait_time_us,
+        common::work_stealing_thread_pool& read_io_thread_pool,
         std::unique_ptr<read_io_executor> read_io_executor,
         cache_accessor& cache_accessor);
 
+    //
+    // Read IO tasks are not bounded, as every pending read
+    // of a collocation is coalesced into a few multi-gets.
+    //
+    status::status_code
+    try_admit_io_tasks(
+        const std::size_t number_tasks,
+        const std::uint64_t size_bytes) override;
+
     //
     // Enqueues a read IO operation for to be processed
-    // by the dispatcher within a thread pool context.
+    // by the dispatcher within the shared read IO thread pool.
+    // Schedules a drain of the pending reads if none is scheduled yet.
     //
     void
     enqueue_io_task(
         object_io_task&& read_io_task) override;
 
     //
-    // Waits for the read dispatcher thread pool
+    // Enqueues multiple read IO operations at once, so they are most
+    // likely coalesced into the same multi-get. Schedules a single drain.
+    //
+    void
+    enqueue_io_tasks(
+        std::vector<object_io_task>&& read_io_tasks) override;
+
+    //
+    // Waits for the shared read IO thread pool
     // to finish execution in a blocking manner.
     //
     void
@@ -55,32 +91,101 @@ public:
 
     //
     // Gets the number of read IO threads.
+    // These are shared across all read IO dispatchers.
     //
     std::uint32_t
     get_num_io_threads() override;
 
 private:
 
+    //
+    // Schedules a drain of the pending read IO tasks in the shared
+    // read IO thread pool, unless there is one already scheduled.
+    //
+    void
+    schedule_read_io_tasks_drain();
+
     //
     // Read IO requests dispatcher entry point.
     // This is the upcall entry point for the thread pool.
+    // The drain owner keeps the drain scheduled flag until no read IO
+    // tasks are pending; helpers only execute a single batch.
     //
     void
-    dispatch_read_io_task(
-        object_io_task&& read_io_task);
+    drain_read_io_tasks(
+        const bool is_drain_owner);
 
     //
-    // Executes a get object task.
+    // Posts the drain owner to the shared read IO thread pool.
     //
-    status::status_code
-    execute_read_io_task(
+    void
+    post_read_io_tasks_drain_owner();
+
+    //
+    // Counts the given number of read IO tasks as pending, and wakes up
+    // the drain owner waiting on the batching window if a full batch is now pending.
+    //
+    void
+    add_pending_read_io_tasks(
+        const std::size_t number_tasks);
+
+    //
+    // Blocks the drain owner until the batching window closes, either
+    // because its deadline passed or because a full batch is pending.
+    // Only called by the drain owner, as it owns the batching window.
+    //
+    void
+    wait_for_batching_window();
+
+    //
+    // Checks whether the drain owner should hold off dequeuing, so
+    // the pending batch gets the chance to fill up. Opens the batching
+    // window on the first check which finds a partial batch pending.
+    // Only called by the drain owner, as it owns the batching window.
+    //
+    bool
+    is_batching_window_open();
+
+    //
+    // Dequeues a batch of pending read IO tasks without blocking.
+    //
+    std::size_t
+    dequeue_read_io_tasks_batch(
+        std::vector<std::unique_ptr<object_io_task>>& read_io_tasks);
+
+    //
+    // Executes a batch of get object tasks through a single
+    // storage engine multi-get and completes each task.
+    //
+    void
+    execute_read_io_tasks_batch(
+        std::span<std::unique_ptr<object_io_task>> read_io_tasks);
+
+    //
+    // Sends the response for a read IO task and fills the cache
+    // with the retrieved object on success, or with a negative entry
+    // if the object was not found. The fill ticket is
+    // only present for tasks which reached the storage engine.
+    // The object data is released from the storage engine afterwards.
+    //
+    void
+    complete_read_io_task(
         object_io_task& read_io_task,
-        byte_stream& object_data);
+        pinned_byte_stream& object_data,
+        const status::status_code status,
+        const cache_fill_ticket* fill_ticket);
+
+    //
+    // Collocation index of the dispatcher.
+    // Used as the affinity hint for the shared read IO thread pool.
+    //
+    const std::uint16_t collocation_index_;
 
     //
-    // IO thread pool for dispatching read IO storage engine operations.
+    // Shared IO thread pool for dispatching read IO storage engine operations.
+    // Owned by the threading context table, which outlives all dispatchers.
     //
-    boost::asio::thread_pool read_io_thread_pool_;
+    common::work_stealing_thread_pool& read_io_thread_pool_;
 
     //
     // Object IO executor handle.
@@ -93,9 +198,45 @@ private:
     cache_accessor& cache_accessor_;
 
     //
-    // Number of read IO threads.
+    // Maximum number of read IO tasks coalesced into a single multi-get.
+    //
+    const std::uint32_t read_io_batch_max_number_tasks_;
+
+    //
+    // Maximum time in microseconds a drain waits for a batch to fill up.
+    //
+    const std::uint32_t read_io_batch_max_wait_time_us_;
+
+    //
+    // Lock-free queue for the read IO tasks pending to be drained.
+    //
+    moodycamel::ConcurrentQueue<std::unique_ptr<object_io_task>> pending_read_io_tasks_queue_;
+
+    //
+    // Number of read IO tasks enqueued and not yet dequeued. Counted by the
+    // producers before checking the drain scheduled flag, so the drain owner
+    // can tell whether reads are pending without relying on the visibility
+    // guarantees of the queue.
+    //
+    std::atomic<std::size_t> number_pending_read_io_tasks_;
+
+    //
+    // Signaled by the producers when a full batch becomes pending,
+    // so the drain owner waiting on the batching window stops waiting early.
+    //
+    moodycamel::LightweightSemaphore batch_filled_semaphore_;
+
+    //
+    // Whether a drain owner is scheduled or running for the pending queue.
+    //
+    std::atomic<bool> drain_scheduled_;
+
+    //
+    // Time at which the current batching window closes, or the epoch if
+    // none is open. Only accessed by the drain owner, which is unique and
+    // handed over through the drain scheduled flag.
     //
-    const std::uint32_t num_read_io_threads_;
+    std::chrono::steady_clock::time_point batching_window_deadline_;
 };
 
-} // namespace pandora::common.
\ No newline at end of file
+} // namespace pandora::storage.
\ No newline at end of file
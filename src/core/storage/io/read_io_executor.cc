@@ -12,8 +12,11 @@
 //      Executes an object IO task against the engine.
 // ****************************************************
 
+#include <chrono>
+#include <vector>
 #include "read_io_executor.hh"
 #include "data_partition_provider.hh"
+#include "../../metrics/metrics_registry.hh"
 
 namespace pandora
 {
@@ -25,45 +28,87 @@ read_io_executor::read_io_executor(
     : data_partition_provider_{data_partition_provider}
 {}
 
-status::status_code
-read_io_executor::execute_get_operation(
+void
+read_io_executor::execute_get_operations(
     const std::uint16_t collocation_index,
-    storage_engine_reference* engine_reference,
-    const schemas::object_request& object_request,
-    byte_stream& object_data)
+    std::span<std::unique_ptr<object_io_task>> read_io_tasks,
+    std::span<pinned_byte_stream> objects_data,
+    std::span<status::status_code> statuses)
 {
     storage_engine_interface& partition_storage_engine =
         data_partition_provider_.get_partition_by_collocation(collocation_index).get_storage_engine();
 
-    status::status_code status = partition_storage_engine.get_object(
-        engine_reference,
-        object_request.get_object_id().c_str(),
-        &object_data);
+    std::vector<storage_engine_reference*> engine_references;
+    std::vector<const char*> object_ids;
+    engine_references.reserve(read_io_tasks.size());
+    object_ids.reserve(read_io_tasks.size());
 
-    if (status::succeeded(status))
+    for (const std::unique_ptr<object_io_task>& read_io_task : read_io_tasks)
     {
-        TRACE_LOG(info, "Object retrieval succeeded. "
-            "Optype={}, "
-            "ObjectId={}, "
-            "ObjectContainerName={}.",
-            static_cast<std::uint8_t>(object_request.get_optype()),
-            object_request.get_object_id(),
-            object_request.get_container_name());
+        //
+        // At this point of execution, each task guarantees that its object container
+        // will be held for as long as the storage API takes, so it is safe to only pass
+        // down the storage engine references given they will not be dropped by the storage engine.
+        //
+        engine_references.emplace_back(read_io_task->container_->get_engine_reference(collocation_index));
+        object_ids.emplace_back(read_io_task->object_request_.get_object_id().c_str());
     }
-    else
+
+    const auto multi_get_start_time = std::chrono::steady_clock::now();
+    partition_storage_engine.get_objects_pinned(
+        engine_references,
+        object_ids,
+        objects_data,
+        statuses);
+
+    metrics::metrics_registry::record_storage_engine_call(
+        metrics::storage_engine_call::multi_get,
+        collocation_index,
+        multi_get_start_time);
+
+    for (std::size_t index = 0u; index < read_io_tasks.size(); ++index)
     {
-        TRACE_LOG(error, "Object retrieval failed. "
-            "Optype={}, "
-            "ObjectId={}, "
-            "ObjectContainerName={}, "
-            "Status={:#x}.",
-            static_cast<std::uint8_t>(object_request.get_optype()),
-            object_request.get_object_id(),
-            object_request.get_container_name(),
-            status);
-    }
+        const schemas::object_request& object_request = read_io_tasks[index]->object_request_;
 
-    return status;
+        if (status::succeeded(statuses[index]))
+        {
+            TRACE_LOG_SAMPLED(info, k_object_operation_log_sample_rate, "Object retrieval succeeded. "
+                "Optype={}, "
+                "ObjectId={}, "
+                "ObjectContainerName={}, "
+                "BatchSize={}.",
+                static_cast<std::uint8_t>(object_request.get_optype()),
+                object_request.get_object_id(),
+                object_request.get_container_name(),
+                read_io_tasks.size());
+        }
+        else if (statuses[index] == status::object_not_found)
+        {
+            TRACE_LOG_SAMPLED(info, k_object_operation_log_sample_rate, "Object retrieval found no object. "
+                "Optype={}, "
+                "ObjectId={}, "
+                "ObjectContainerName={}, "
+                "BatchSize={}.",
+                static_cast<std::uint8_t>(object_request.get_optype()),
+                object_request.get_object_id(),
+                object_request.get_container_name(),
+                read_io_tasks.size());
+        }
+        else
+        {
+            TRACE_LOG_RATE_LIMITED(error, k_object_failure_max_log_lines_per_second, "Object retrieval failed. "
+                "Optype={}, "
+                "ObjectId={}, "
+                "ObjectContainerName={}, "
+                "BatchSize={}, "
+                "Status={:#x}.",
+                static_cast<std::uint8_t>(object_request.get_optype()),
+                object_request.get_object_id(),
+                object_request.get_container_name(),
+                read_io_tasks.size(),
+                statuses[index]);
+        }
+    }
 }
 
 } // namespace storage.
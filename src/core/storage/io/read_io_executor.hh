@@ -14,9 +14,11 @@
 
 #pragma once
 
+#include <span>
+#include <memory>
 #include "../../status/status.hh"
 #include "../../common/aliases.hh"
-#include "../../schemas/request-interfaces/object_request.hh"
+#include "../models/object_io_task.hh"
 
 namespace pandora
 {
@@ -36,14 +38,17 @@ public:
         data_partition_provider& data_partition_provider);
 
     //
-    // Executes a get operation with the storage engine.
+    // Executes a batch of get operations with the storage engine
+    // through a single multi-get. The object data and status of each
+    // task are stored at the same offset within the respective spans.
+    // The object data stays pinned in the storage engine until it is released.
     //
-    status::status_code
-    execute_get_operation(
+    void
+    execute_get_operations(
         const std::uint16_t collocation_index,
-        storage_engine_reference* engine_reference,
-        const schemas::object_request& object_request,
-        byte_stream& object_data);
+        std::span<std::unique_ptr<object_io_task>> read_io_tasks,
+        std::span<pinned_byte_stream> objects_data,
+        std::span<status::status_code> statuses);
 
 private:
 
@@ -51,6 +56,16 @@ private:
     // Reference for the data partition provider.
     //
     data_partition_provider& data_partition_provider_;
+
+    //
+    // Number of successful per-object operations per logged one.
+    //
+    static constexpr std::uint32_t k_object_operation_log_sample_rate = 1'000u;
+
+    //
+    // Maximum number of failed per-object operations logged per second.
+    //
+    static constexpr std::uint32_t k_object_failure_max_log_lines_per_second = 100u;
 };
 
 } // namespace storage.
@@ -12,6 +12,9 @@
 //      Core storage engine for handling IO operations. 
 // ****************************************************
 
+#include <map>
+#include <array>
+#include <rocksdb/statistics.h>
 #include "storage_engine.hh"
 
 namespace pandora
@@ -19,6 +22,31 @@ namespace pandora
 namespace storage
 {
 
+//
+// Engine properties which apply to the whole storage engine instance.
+//
+static constexpr std::array<const char*, 7u> k_instance_property_names = {
+    "rocksdb.num-running-compactions",
+    "rocksdb.num-running-flushes",
+    "rocksdb.actual-delayed-write-rate",
+    "rocksdb.is-write-stopped",
+    "rocksdb.background-errors",
+    "rocksdb.block-cache-usage",
+    "rocksdb.block-cache-pinned-usage"};
+
+//
+// Engine properties of every column family, which also get summed across the instance.
+//
+static constexpr std::array<const char*, 8u> k_container_int_property_names = {
+    "rocksdb.estimate-pending-compaction-bytes",
+    "rocksdb.compaction-pending",
+    "rocksdb.mem-table-flush-pending",
+    "rocksdb.num-immutable-mem-table",
+    "rocksdb.cur-size-all-mem-tables",
+    "rocksdb.estimate-num-keys",
+    "rocksdb.total-sst-files-size",
+    "rocksdb.estimate-table-readers-mem"};
+
 storage_engine::storage_engine()
     : persistent_store_{nullptr} /* Intentional. Any non-initialized use should result in a segfault. */
 {}
@@ -92,6 +120,151 @@ storage_engine::insert_object(
     return status::success;
 }
 
+status::status_code
+storage_engine::stage_object_insertion(
+    storage_engine_write_batch* write_batch,
+    storage_engine_reference* container_storage_engine_reference,
+    const char* object_id,
+    std::string_view object_data)
+{
+    if (!fence_engine_reference(container_storage_engine_reference))
+    {
+        status::status_code status = status::storage_engine_reference_not_approved;
+        TRACE_LOG(error, "Stage object insertion operation is invalid since "
+            "engine reference is not approved for the storage engine. "
+            "ObjectId={}, "
+            "EngineReference={}, "
+            "CollocationIndex={}, "
+            "Status={:#x}.",
+            object_id,
+            static_cast<void*>(container_storage_engine_reference),
+            collocation_index_,
+            status);
+
+        return status;
+    }
+
+    const rocksdb::Status engine_status = write_batch->Put(
+        container_storage_engine_reference,
+        object_id,
+        rocksdb::Slice{object_data.data(), object_data.size()});
+
+    if (!engine_status.ok())
+    {
+        status::status_code status = status::object_insertion_failed;
+        TRACE_LOG(error, "Failed to stage object insertion into the write batch. "
+            "ObjectId={}, "
+            "EngineReference={}, "
+            "EngineReferenceID={}, "
+            "ContainerName={}, "
+            "CollocationIndex={}, "
+            "StorageEngineCode={}, "
+            "StorageEngineSubCode={}, "
+            "Status={:#x}.",
+            object_id,
+            static_cast<void*>(container_storage_engine_reference),
+            container_storage_engine_reference->GetID(),
+            container_storage_engine_reference->GetName(),
+            collocation_index_,
+            static_cast<std::uint32_t>(engine_status.code()),
+            static_cast<std::uint32_t>(engine_status.subcode()),
+            status);
+
+        return status;
+    }
+
+    return status::success;
+}
+
+status::status_code
+storage_engine::stage_object_removal(
+    storage_engine_write_batch* write_batch,
+    storage_engine_reference* container_storage_engine_reference,
+    const char* object_id)
+{
+    if (!fence_engine_reference(container_storage_engine_reference))
+    {
+        status::status_code status = status::storage_engine_reference_not_approved;
+        TRACE_LOG(error, "Stage object removal operation is invalid since "
+            "engine reference is not approved for the storage engine. "
+            "ObjectId={}, "
+            "EngineReference={}, "
+            "CollocationIndex={}, "
+            "Status={:#x}.",
+            object_id,
+            static_cast<void*>(container_storage_engine_reference),
+            collocation_index_,
+            status);
+
+        return status;
+    }
+
+    const rocksdb::Status engine_status = write_batch->Delete(
+        container_storage_engine_reference,
+        object_id);
+
+    if (!engine_status.ok())
+    {
+        status::status_code status = status::object_deletion_failed;
+        TRACE_LOG(error, "Failed to stage object removal into the write batch. "
+            "ObjectId={}, "
+            "EngineReference={}, "
+            "EngineReferenceID={}, "
+            "ContainerName={}, "
+            "CollocationIndex={}, "
+            "StorageEngineCode={}, "
+            "StorageEngineSubCode={}, "
+            "Status={:#x}.",
+            object_id,
+            static_cast<void*>(container_storage_engine_reference),
+            container_storage_engine_reference->GetID(),
+            container_storage_engine_reference->GetName(),
+            collocation_index_,
+            static_cast<std::uint32_t>(engine_status.code()),
+            static_cast<std::uint32_t>(engine_status.subcode()),
+            status);
+
+        return status;
+    }
+
+    return status::success;
+}
+
+status::status_code
+storage_engine::commit_write_batch(
+    storage_engine_write_batch* write_batch)
+{
+    //
+    // A single write call appends the whole batch to the WAL and the
+    // memtables at once, so all staged operations share the same commit cost.
+    //
+    const rocksdb::Status engine_status = persistent_store_->Write(
+        rocksdb::WriteOptions(),
+        write_batch);
+
+    if (!engine_status.ok())
+    {
+        status::status_code status = status::object_write_batch_failed;
+        TRACE_LOG(error, "Failed to commit the write batch into the storage engine. "
+            "NumberOperations={}, "
+            "WriteBatchSizeBytes={}, "
+            "CollocationIndex={}, "
+            "StorageEngineCode={}, "
+            "StorageEngineSubCode={}, "
+            "Status={:#x}.",
+            write_batch->Count(),
+            write_batch->GetDataSize(),
+            collocation_index_,
+            static_cast<std::uint32_t>(engine_status.code()),
+            static_cast<std::uint32_t>(engine_status.subcode()),
+            status);
+
+        return status;
+    }
+
+    return status::success;
+}
+
 status::status_code
 storage_engine::get_object(
     storage_engine_reference* container_storage_engine_reference,
@@ -125,6 +298,14 @@ storage_engine::get_object(
         object_id,
         object_data);
 
+    if (engine_status.IsNotFound())
+    {
+        //
+        // An absent object is an expected outcome, so it is reported apart from the engine failures.
+        //
+        return status::object_not_found;
+    }
+
     if (!engine_status.ok())
     {
         status::status_code status = status::object_retrieval_failed;
@@ -152,13 +333,164 @@ storage_engine::get_object(
     return status::success;
 }
 
+status::status_code
+storage_engine::get_objects(
+    std::span<storage_engine_reference* const> container_storage_engine_references,
+    std::span<const char* const> object_ids,
+    std::span<byte_stream> objects_data,
+    std::span<status::status_code> statuses)
+{
+    std::vector<pinned_byte_stream> pinned_objects_data(object_ids.size());
+    const status::status_code batch_status = get_objects_pinned(
+        container_storage_engine_references,
+        object_ids,
+        pinned_objects_data,
+        statuses);
+
+    for (std::size_t index = 0u; index < object_ids.size(); ++index)
+    {
+        if (status::succeeded(statuses[index]))
+        {
+            objects_data[index].assign(
+                pinned_objects_data[index].data(),
+                pinned_objects_data[index].size());
+        }
+    }
+
+    return batch_status;
+}
+
+status::status_code
+storage_engine::get_objects_pinned(
+    std::span<storage_engine_reference* const> container_storage_engine_references,
+    std::span<const char* const> object_ids,
+    std::span<pinned_byte_stream> objects_data,
+    std::span<status::status_code> statuses)
+{
+    //
+    // Only objects whose engine references are approved
+    // are forwarded to the storage engine multi-get.
+    //
+    const std::size_t number_objects = object_ids.size();
+    std::vector<storage_engine_reference*> approved_references;
+    std::vector<rocksdb::Slice> approved_object_ids;
+    std::vector<std::size_t> approved_indices;
+    approved_references.reserve(number_objects);
+    approved_object_ids.reserve(number_objects);
+    approved_indices.reserve(number_objects);
+    status::status_code batch_status = status::success;
+
+    for (std::size_t index = 0u; index < number_objects; ++index)
+    {
+        storage_engine_reference* container_storage_engine_reference = container_storage_engine_references[index];
+
+        if (!fence_engine_reference(container_storage_engine_reference))
+        {
+            statuses[index] = status::storage_engine_reference_not_approved;
+            batch_status = statuses[index];
+            TRACE_LOG(error, "Get object operation is invalid since "
+                "engine reference is not approved for the storage engine. "
+                "ObjectId={}, "
+                "EngineReference={}, "
+                "EngineReferenceID={}, "
+                "ContainerName={}, "
+                "CollocationIndex={}, "
+                "Status={:#x}.",
+                object_ids[index],
+                static_cast<void*>(container_storage_engine_reference),
+                container_storage_engine_reference->GetID(),
+                container_storage_engine_reference->GetName(),
+                collocation_index_,
+                statuses[index]);
+
+            continue;
+        }
+
+        approved_references.emplace_back(container_storage_engine_reference);
+        approved_object_ids.emplace_back(object_ids[index]);
+        approved_indices.emplace_back(index);
+    }
+
+    if (approved_indices.empty())
+    {
+        return batch_status;
+    }
+
+    //
+    // The batched multi-get shares the index and filter lookups across
+    // all keys and fetches the data blocks of the batch in parallel.
+    // Values are pinned in place, so they are moved out without copying their data.
+    //
+    const std::size_t number_approved_objects = approved_indices.size();
+    std::vector<pinned_byte_stream> values(number_approved_objects);
+    std::vector<rocksdb::Status> engine_statuses(number_approved_objects);
+    persistent_store_->MultiGet(
+        rocksdb::ReadOptions(),
+        number_approved_objects,
+        approved_references.data(),
+        approved_object_ids.data(),
+        values.data(),
+        engine_statuses.data());
+
+    for (std::size_t approved_index = 0u; approved_index < number_approved_objects; ++approved_index)
+    {
+        const std::size_t index = approved_indices[approved_index];
+        const rocksdb::Status& engine_status = engine_statuses[approved_index];
+
+        if (engine_status.IsNotFound())
+        {
+            //
+            // An absent object is an expected outcome, so it is reported apart from the engine failures.
+            //
+            statuses[index] = status::object_not_found;
+            batch_status = statuses[index];
+
+            continue;
+        }
+
+        if (!engine_status.ok())
+        {
+            statuses[index] = status::object_retrieval_failed;
+            batch_status = statuses[index];
+            TRACE_LOG(error, "Failed to retrieve object from the specified object container. "
+                "ObjectId={}, "
+                "EngineReference={}, "
+                "EngineReferenceID={}, "
+                "ContainerName={}, "
+                "CollocationIndex={}, "
+                "StorageEngineCode={}, "
+                "StorageEngineSubCode={}, "
+                "Status={:#x}.",
+                object_ids[index],
+                static_cast<void*>(approved_references[approved_index]),
+                approved_references[approved_index]->GetID(),
+                approved_references[approved_index]->GetName(),
+                collocation_index_,
+                static_cast<std::uint32_t>(engine_status.code()),
+                static_cast<std::uint32_t>(engine_status.subcode()),
+                statuses[index]);
+
+            continue;
+        }
+
+        objects_data[index] = std::move(values[approved_index]);
+        statuses[index] = status::success;
+    }
+
+    return batch_status;
+}
+
 status::status_code
 storage_engine::create_container(
     const char* container_name,
     storage_engine_reference** container_storage_engine_reference)
 {
+    //
+    // New object containers inherit the engine configurations of the partition
+    // from the default column family, including the shared block cache.
+    //
     const rocksdb::Status engine_status = persistent_store_->CreateColumnFamily(
-        rocksdb::ColumnFamilyOptions(),
+        rocksdb::ColumnFamilyOptions(persistent_store_->GetOptions()),
         container_name,
         container_storage_engine_reference);
 
@@ -189,14 +521,14 @@ storage_engine::create_container(
 }
 
 status::status_code
-storage_engine::get_all_objects_from_container(
+storage_engine::create_object_iterator(
     storage_engine_reference* container_storage_engine_reference,
-    std::unordered_map<std::string, byte_stream>* objects)
+    std::unique_ptr<storage_engine_iterator>* object_iterator)
 {
     if (!fence_engine_reference(container_storage_engine_reference))
     {
         status::status_code status = status::storage_engine_reference_not_approved;
-        TRACE_LOG(error, "Get all objects operation is invalid since "
+        TRACE_LOG(error, "Create object iterator operation is invalid since "
             "engine reference is not approved for the storage engine. "
             "EngineReference={}, "
             "EngineReferenceID={}, "
@@ -212,50 +544,16 @@ storage_engine::get_all_objects_from_container(
         return status;
     }
 
+    //
+    // Scans touch every block of the object container once,
+    // so do not let them evict the hot blocks from the shared block cache.
+    //
     rocksdb::ReadOptions read_options;
-    std::unique_ptr<rocksdb::Iterator> it(persistent_store_->NewIterator(
+    read_options.fill_cache = false;
+    object_iterator->reset(persistent_store_->NewIterator(
         read_options,
         container_storage_engine_reference));
 
-    //
-    // Iterate over all objects in the object container
-    // and append them to the list to return.
-    //
-    for (it->SeekToFirst(); it->Valid(); it->Next())
-    {
-        std::string key = it->key().ToString();
-        std::string value = it->value().ToString();
-        objects->emplace(key, value);
-    }
-
-    //
-    // If an error occurred, it will only be discovered after the storage
-    // iteration, so error handling must be handled post iterator traversal.
-    //
-    const rocksdb::Status engine_status = it->status();
-
-    if (!engine_status.ok())
-    {
-        status::status_code status = status::objects_retrieval_from_container_failed;
-        TRACE_LOG(error, "Failed to retrieve all objects inside the specified object container. "
-            "EngineReference={}, "
-            "EngineReferenceID={}, "
-            "ContainerName={}, "
-            "CollocationIndex={}, "
-            "StorageEngineCode={}, "
-            "StorageEngineSubCode={}, "
-            "Status={:#x}.",
-            static_cast<void*>(container_storage_engine_reference),
-            container_storage_engine_reference->GetID(),
-            container_storage_engine_reference->GetName(),
-            collocation_index_,
-            static_cast<std::uint32_t>(engine_status.code()),
-            static_cast<std::uint32_t>(engine_status.subcode()),
-            status);
-
-        return status;
-    }
-
     return status::success;
 }
 
@@ -445,5 +743,115 @@ storage_engine::fence_engine_reference(
            approved_references_.exists(engine_reference);
 }
 
+storage_engine_statistics
+storage_engine::get_engine_statistics(
+    std::span<storage_engine_reference* const> container_storage_engine_references)
+{
+    storage_engine_statistics statistics{};
+
+    //
+    // Properties which apply to the whole instance, such as background work and write stalls.
+    //
+    for (const char* property_name : k_instance_property_names)
+    {
+        std::uint64_t property_value = 0u;
+        if (persistent_store_->GetIntProperty(property_name, &property_value))
+        {
+            statistics.properties_.emplace_back(property_name, std::to_string(property_value));
+        }
+    }
+
+    //
+    // Properties of the column families, summed across all object containers of the instance.
+    //
+    for (const char* property_name : k_container_int_property_names)
+    {
+        std::uint64_t property_value = 0u;
+        if (persistent_store_->GetAggregatedIntProperty(property_name, &property_value))
+        {
+            statistics.properties_.emplace_back(property_name, std::to_string(property_value));
+        }
+    }
+
+    std::map<std::string, std::string> instance_map_property;
+    if (persistent_store_->GetMapProperty(rocksdb::DB::Properties::kDBStats, &instance_map_property))
+    {
+        for (auto& [key, value] : instance_map_property)
+        {
+            statistics.properties_.emplace_back(
+                std::string{rocksdb::DB::Properties::kDBStats} + "." + key,
+                std::move(value));
+        }
+    }
+
+    const std::shared_ptr<rocksdb::Statistics> engine_statistics = persistent_store_->GetDBOptions().statistics;
+    if (engine_statistics != nullptr)
+    {
+        std::map<std::string, std::uint64_t> tickers;
+        engine_statistics->getTickerMap(&tickers);
+        statistics.tickers_.assign(tickers.begin(), tickers.end());
+
+        for (const auto& [histogram, histogram_name] : rocksdb::HistogramsNameMap)
+        {
+            rocksdb::HistogramData histogram_data{};
+            engine_statistics->histogramData(histogram, &histogram_data);
+
+            if (histogram_data.count == 0u)
+            {
+                continue;
+            }
+
+            statistics.histograms_.push_back(storage_engine_histogram_statistics{
+                histogram_name,
+                histogram_data.count,
+                histogram_data.median,
+                histogram_data.percentile95,
+                histogram_data.percentile99,
+                histogram_data.max});
+        }
+    }
+
+    for (storage_engine_reference* container_storage_engine_reference : container_storage_engine_references)
+    {
+        if (!fence_engine_reference(container_storage_engine_reference))
+        {
+            continue;
+        }
+
+        storage_engine_container_statistics container_statistics{};
+        container_statistics.container_name_ = container_storage_engine_reference->GetName();
+
+        for (const char* property_name : k_container_int_property_names)
+        {
+            std::uint64_t property_value = 0u;
+            if (persistent_store_->GetIntProperty(container_storage_engine_reference, property_name, &property_value))
+            {
+                container_statistics.properties_.emplace_back(property_name, std::to_string(property_value));
+            }
+        }
+
+        //
+        // Per-level compaction and stall counters of the column family.
+        //
+        std::map<std::string, std::string> container_map_property;
+        if (persistent_store_->GetMapProperty(
+                container_storage_engine_reference,
+                rocksdb::DB::Properties::kCFStats,
+                &container_map_property))
+        {
+            for (auto& [key, value] : container_map_property)
+            {
+                container_statistics.properties_.emplace_back(
+                    std::string{rocksdb::DB::Properties::kCFStats} + "." + key,
+                    std::move(value));
+            }
+        }
+
+        statistics.containers_.push_back(std::move(container_statistics));
+    }
+
+    return statistics;
+}
+
 } // namespace storage.
 } // namespace pandora.
\ No newline at end of file
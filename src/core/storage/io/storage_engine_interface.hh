@@ -15,11 +15,14 @@
 
 #pragma once
 
+#include <span>
 #include <string>
+#include <string_view>
 #include "../../status/status.hh"
 #include "../../common/aliases.hh"
 #include "../../common/interface.hh"
 #include "../storage_configuration.hh"
+#include "storage_engine_statistics.hh"
 
 namespace pandora
 {
@@ -50,9 +53,43 @@ public:
         const char* object_id,
         const byte_stream& object_data) = 0;
 
+    //
+    // Stages an object insertion into the given write batch.
+    // The insertion is not persisted until the write batch is committed.
+    // The object data only needs to outlive this call, as the write batch copies it.
+    //
+    virtual
+    status::status_code
+    stage_object_insertion(
+        storage_engine_write_batch* write_batch,
+        storage_engine_reference* container_storage_engine_reference,
+        const char* object_id,
+        std::string_view object_data) = 0;
+
+    //
+    // Stages an object removal into the given write batch.
+    // The removal is not persisted until the write batch is committed.
+    //
+    virtual
+    status::status_code
+    stage_object_removal(
+        storage_engine_write_batch* write_batch,
+        storage_engine_reference* container_storage_engine_reference,
+        const char* object_id) = 0;
+
+    //
+    // Atomically commits all the operations staged into the write batch
+    // with a single write into the data store.
+    //
+    virtual
+    status::status_code
+    commit_write_batch(
+        storage_engine_write_batch* write_batch) = 0;
+
     //
     // Get an object from the data store.
-    // Stores the object contents into the data stream if it exists.
+    // Stores the object contents into the data stream if it exists,
+    // otherwise returns object_not_found.
     //
     virtual
     status::status_code
@@ -61,6 +98,35 @@ public:
         const char* object_id,
         byte_stream* object_data) = 0;
 
+    //
+    // Gets a batch of objects from the data store in a single storage engine call.
+    // All spans must have the same size; each object is stored into its respective
+    // data stream and its individual outcome into its respective status.
+    // Absent objects get object_not_found as their status.
+    // Returns success only if all objects were retrieved.
+    //
+    virtual
+    status::status_code
+    get_objects(
+        std::span<storage_engine_reference* const> container_storage_engine_references,
+        std::span<const char* const> object_ids,
+        std::span<byte_stream> objects_data,
+        std::span<status::status_code> statuses) = 0;
+
+    //
+    // Gets a batch of objects from the data store without copying them out of the storage engine.
+    // Each pinned data stream references the object within the storage engine block cache
+    // and keeps its block pinned until the pinned data stream is reset or destroyed.
+    // Follows the same conventions as the copying multi-get otherwise.
+    //
+    virtual
+    status::status_code
+    get_objects_pinned(
+        std::span<storage_engine_reference* const> container_storage_engine_references,
+        std::span<const char* const> object_ids,
+        std::span<pinned_byte_stream> objects_data,
+        std::span<status::status_code> statuses) = 0;
+
     //
     // Creates a new object container inside the data store.
     // Returns the associated column family reference on success.
@@ -72,14 +138,14 @@ public:
         storage_engine_reference** container_storage_engine_reference) = 0;
 
     //
-    // Gets all the objects from a specified object container.
-    // Returns them in an unordered fashion.
+    // Creates an iterator over the objects of a specified object container in key order.
+    // The iterator must be destroyed before the container storage engine reference is closed.
     //
     virtual
     status::status_code
-    get_all_objects_from_container(
+    create_object_iterator(
         storage_engine_reference* container_storage_engine_reference,
-        std::unordered_map<std::string, byte_stream>* objects) = 0;
+        std::unique_ptr<storage_engine_iterator>* object_iterator) = 0;
 
     //
     // Closes the in-memory object container storage engine reference.
@@ -123,6 +189,16 @@ public:
     bool
     fence_engine_reference(
         storage_engine_reference* engine_reference) = 0;
+
+    //
+    // Gets a snapshot of the statistics and engine properties of the storage engine instance,
+    // along with the engine properties of every given object container reference.
+    // References which are not approved for this engine instance are skipped.
+    //
+    virtual
+    storage_engine_statistics
+    get_engine_statistics(
+        std::span<storage_engine_reference* const> container_storage_engine_references) = 0;
 };
 
 } // namespace storage.
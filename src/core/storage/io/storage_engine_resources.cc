@@ -0,0 +1,115 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'storage_engine_resources.cc'
+// Author: jcjuarez
+// Description:
+//      Process-wide storage engine resources
+//      shared by all data partitions.
+// ****************************************************
+
+#include <algorithm>
+#include "storage_engine_resources.hh"
+
+namespace pandora
+{
+namespace storage
+{
+
+storage_engine_resources::storage_engine_resources(
+    const storage_configuration& storage_configuration,
+    const std::uint32_t number_data_partitions)
+    : environment_{rocksdb::Env::Default()},
+      number_background_threads_{static_cast<std::int32_t>(
+        std::max(storage_configuration.storage_engine_number_background_threads_, 2u))},
+      max_background_jobs_per_partition_{std::max(
+        number_background_threads_ / static_cast<std::int32_t>(std::max(number_data_partitions, 1u)),
+        2)}
+{
+    const std::size_t block_cache_size_bytes =
+        storage_configuration.storage_engine_block_cache_size_mib_ * 1'024u * 1'024u;
+
+    //
+    // A single block cache for all data partitions, so the configured size is the
+    // total memory budget of the process instead of a budget per partition.
+    // The number of cache shards is derived from the capacity by the engine.
+    //
+    if (storage_configuration.storage_engine_hyper_clock_cache_enabled_)
+    {
+        //
+        // A zero estimated entry charge lets the engine size the table automatically.
+        //
+        block_cache_ = rocksdb::HyperClockCacheOptions(
+            block_cache_size_bytes,
+            0u).MakeSharedCache();
+    }
+    else
+    {
+        block_cache_ = rocksdb::NewLRUCache(
+            block_cache_size_bytes);
+    }
+
+    rocksdb::BlockBasedTableOptions table_options;
+    table_options.block_cache = block_cache_;
+    table_factory_.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+
+    write_buffer_manager_ = std::make_shared<rocksdb::WriteBufferManager>(
+        storage_configuration.storage_engine_write_buffer_manager_size_mib_ * 1'024u * 1'024u,
+        block_cache_);
+
+    //
+    // Flushes run in the high priority pool and compactions in the low priority pool.
+    // A quarter of the background threads is dedicated to flushes, as to avoid write stalls.
+    //
+    const std::int32_t number_flush_threads = std::max(number_background_threads_ / 4, 1);
+    environment_->SetBackgroundThreads(
+        number_flush_threads,
+        rocksdb::Env::Priority::HIGH);
+    environment_->SetBackgroundThreads(
+        number_background_threads_ - number_flush_threads,
+        rocksdb::Env::Priority::LOW);
+
+    TRACE_LOG(info, "Storage engine shared resources created. "
+        "BlockCacheType={}, "
+        "BlockCacheSizeMiB={}, "
+        "WriteBufferManagerSizeMiB={}, "
+        "NumFlushThreads={}, "
+        "NumCompactionThreads={}, "
+        "MaxBackgroundJobsPerPartition={}.",
+        storage_configuration.storage_engine_hyper_clock_cache_enabled_ ? "HyperClock" : "LRU",
+        storage_configuration.storage_engine_block_cache_size_mib_,
+        storage_configuration.storage_engine_write_buffer_manager_size_mib_,
+        number_flush_threads,
+        number_background_threads_ - number_flush_threads,
+        max_background_jobs_per_partition_);
+}
+
+void
+storage_engine_resources::apply_to_engine_configurations(
+    rocksdb::Options& options) const
+{
+    options.env = environment_;
+    options.table_factory = table_factory_;
+    options.write_buffer_manager = write_buffer_manager_;
+
+    //
+    // The background threads are divided across the partitions, so a single partition
+    // cannot queue enough jobs to starve the flushes of the others in the shared pools.
+    // Each partition keeps at least two jobs, so one flush can run next to one compaction.
+    //
+    options.max_background_jobs = max_background_jobs_per_partition_;
+}
+
+const std::shared_ptr<rocksdb::Cache>&
+storage_engine_resources::get_block_cache() const
+{
+    return block_cache_;
+}
+
+} // namespace storage.
+} // namespace pandora.
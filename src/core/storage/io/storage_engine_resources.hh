@@ -0,0 +1,99 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'storage_engine_resources.hh'
+// Author: jcjuarez
+// Description:
+//      Process-wide storage engine resources
+//      shared by all data partitions.
+// ****************************************************
+
+#pragma once
+
+#include <memory>
+#include <cstdint>
+#include <rocksdb/env.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/options.h>
+#include <rocksdb/table.h>
+#include <rocksdb/write_buffer_manager.h>
+#include "../../common/aliases.hh"
+#include "../storage_configuration.hh"
+
+namespace pandora
+{
+namespace storage
+{
+
+class storage_engine_resources
+{
+public:
+
+    //
+    // Constructor.
+    // Creates the shared block cache and write buffer manager, and sizes the
+    // background thread pools of the shared environment. Must only be constructed
+    // once per process, as the environment thread pools are process-wide.
+    // The number of data partitions is the number opened against these resources.
+    //
+    storage_engine_resources(
+        const storage_configuration& storage_configuration,
+        const std::uint32_t number_data_partitions);
+
+    //
+    // Applies the shared resources to the engine configurations of a data partition,
+    // so that the memory and background work of all partitions is bounded by a single budget.
+    //
+    void
+    apply_to_engine_configurations(
+        rocksdb::Options& options) const;
+
+    //
+    // Gets the shared block cache.
+    //
+    const std::shared_ptr<rocksdb::Cache>&
+    get_block_cache() const;
+
+private:
+
+    //
+    // Block cache shared by all data partitions.
+    // Either a sharded LRU cache or a HyperClock cache, based on the configuration.
+    //
+    std::shared_ptr<rocksdb::Cache> block_cache_;
+
+    //
+    // Block-based table factory bound to the shared block cache.
+    //
+    std::shared_ptr<rocksdb::TableFactory> table_factory_;
+
+    //
+    // Write buffer manager shared by all data partitions.
+    // Memtable memory is charged against the shared block cache.
+    //
+    std::shared_ptr<rocksdb::WriteBufferManager> write_buffer_manager_;
+
+    //
+    // Shared environment whose background thread pools
+    // run the flushes and compactions of all data partitions.
+    //
+    rocksdb::Env* environment_;
+
+    //
+    // Number of background threads in the shared environment.
+    //
+    const std::int32_t number_background_threads_;
+
+    //
+    // Maximum number of concurrent background jobs of each data partition.
+    //
+    const std::int32_t max_background_jobs_per_partition_;
+};
+
+} // namespace storage.
+} // namespace pandora.
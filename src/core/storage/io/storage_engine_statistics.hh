@@ -0,0 +1,155 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'storage_engine_statistics.hh'
+// Author: jcjuarez
+// Description:
+//      Statistics collection level and statistics
+//      snapshots of the storage engine instances.
+// ****************************************************
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <string_view>
+
+namespace pandora::storage
+{
+
+//
+// Level of the statistics collected by every storage engine instance.
+// Higher levels collect more timers, at a higher cost on every operation.
+//
+enum class storage_engine_statistics_level : std::uint8_t
+{
+    //
+    // No statistics are collected. Engine properties are still available.
+    //
+    disabled = 0,
+
+    //
+    // Only tickers are collected.
+    //
+    except_histograms = 1,
+
+    //
+    // Tickers and histograms are collected, except for the detailed timers.
+    //
+    except_detailed_timers = 2,
+
+    //
+    // All tickers, histograms and timers are collected.
+    //
+    all = 3
+};
+
+//
+// Gets the statistics level from its configuration name.
+// Returns an empty optional if the name is not recognized.
+//
+inline
+std::optional<storage_engine_statistics_level>
+get_storage_engine_statistics_level_from_name(
+    std::string_view name)
+{
+    if (name == "disabled")
+    {
+        return storage_engine_statistics_level::disabled;
+    }
+
+    if (name == "except_histograms")
+    {
+        return storage_engine_statistics_level::except_histograms;
+    }
+
+    if (name == "except_detailed_timers")
+    {
+        return storage_engine_statistics_level::except_detailed_timers;
+    }
+
+    if (name == "all")
+    {
+        return storage_engine_statistics_level::all;
+    }
+
+    return std::nullopt;
+}
+
+//
+// Distribution summary of a storage engine histogram.
+//
+struct storage_engine_histogram_statistics
+{
+    //
+    // Name of the histogram.
+    //
+    std::string name_;
+
+    //
+    // Number of recorded values.
+    //
+    std::uint64_t count_;
+
+    //
+    // Percentiles and maximum of the recorded values.
+    //
+    double median_;
+    double percentile_95_;
+    double percentile_99_;
+    double max_;
+};
+
+//
+// Engine properties of an object container within a storage engine instance.
+//
+struct storage_engine_container_statistics
+{
+    //
+    // Name of the object container.
+    //
+    std::string container_name_;
+
+    //
+    // Engine properties of the container, as {Name, Value} pairs.
+    //
+    std::vector<std::pair<std::string, std::string>> properties_;
+};
+
+//
+// Snapshot of the statistics of a storage engine instance.
+//
+struct storage_engine_statistics
+{
+    //
+    // Engine properties of the whole instance, as {Name, Value} pairs.
+    //
+    std::vector<std::pair<std::string, std::string>> properties_;
+
+    //
+    // Ticker counts since the instance was opened, as {Name, Count} pairs.
+    // Empty if statistics are disabled.
+    //
+    std::vector<std::pair<std::string, std::uint64_t>> tickers_;
+
+    //
+    // Histograms with at least one recorded value.
+    // Empty if statistics are disabled or only tickers are collected.
+    //
+    std::vector<storage_engine_histogram_statistics> histograms_;
+
+    //
+    // Engine properties of every requested object container.
+    //
+    std::vector<storage_engine_container_statistics> containers_;
+};
+
+} // namespace pandora::storage.
@@ -34,6 +34,12 @@ threading_context_provider::get_context_by_collocation(
     return contexts_table_->get_threading_context(collocation_index);
 }
 
+common::work_stealing_thread_pool&
+threading_context_provider::get_read_io_thread_pool()
+{
+    return contexts_table_->get_read_io_thread_pool();
+}
+
 void
 threading_context_provider::start_write_io_dispatching()
 {
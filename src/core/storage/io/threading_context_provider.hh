@@ -40,6 +40,12 @@ public:
     get_context_by_collocation(
         const std::uint16_t collocation_index);
 
+    //
+    // Gets the read IO thread pool shared by all contexts.
+    //
+    common::work_stealing_thread_pool&
+    get_read_io_thread_pool();
+
     //
     // Starts all write IO dispatcher threads.
     //
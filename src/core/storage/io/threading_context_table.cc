@@ -16,15 +16,23 @@
 #include "threading_context_table.hh"
 #include "io_dispatcher_interface.hh"
 #include "../../common/startable_interface.hh"
+#include "../../common/work_stealing_thread_pool.hh"
 
 namespace pandora
 {
 namespace storage
 {
 
-threading_context_table::threading_context_table()
+threading_context_table::threading_context_table(
+    std::unique_ptr<common::work_stealing_thread_pool> read_io_thread_pool)
+    : read_io_thread_pool_{std::move(read_io_thread_pool)}
 {}
 
+threading_context_table::~threading_context_table()
+{
+    read_io_thread_pool_->join();
+}
+
 void
 threading_context_table::append_context(
     const std::uint16_t collocation_index,
@@ -44,6 +52,12 @@ threading_context_table::get_threading_context(
     return threading_contexts_.at(collocation_index);
 }
 
+common::work_stealing_thread_pool&
+threading_context_table::get_read_io_thread_pool()
+{
+    return *(read_io_thread_pool_.get());
+}
+
 void
 threading_context_table::start_write_io_dispatching()
 {
@@ -64,12 +78,7 @@ threading_context_table::get_num_contexts()
 std::uint32_t
 threading_context_table::get_num_read_io_threads()
 {
-    std::uint32_t num_read_io_threads = 0u;
-    for (auto& context : threading_contexts_)
-    {
-        num_read_io_threads += context.get_num_read_io_threads();
-    }
-    return num_read_io_threads;
+    return read_io_thread_pool_->get_num_threads();
 }
 
 std::uint32_t
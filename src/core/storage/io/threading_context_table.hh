@@ -18,6 +18,13 @@
 #include <memory>
 #include "threading_context.hh"
 
+namespace pandora::common
+{
+
+class work_stealing_thread_pool;
+
+} // namespace pandora::common.
+
 namespace pandora
 {
 namespace storage
@@ -29,8 +36,17 @@ public:
 
     //
     // Constructor.
+    // Takes ownership of the read IO thread pool shared by all contexts.
+    //
+    threading_context_table(
+        std::unique_ptr<common::work_stealing_thread_pool> read_io_thread_pool);
+
+    //
+    // Destructor.
+    // Drains the read IO thread pool before the contexts are destroyed,
+    // given pending read IO tasks hold references to their dispatchers.
     //
-    threading_context_table();
+    ~threading_context_table();
 
     //
     // Appends a new threading context instance to the table.
@@ -49,6 +65,12 @@ public:
     get_threading_context(
         const std::uint16_t collocation_index);
 
+    //
+    // Returns a reference to the read IO thread pool shared by all contexts.
+    //
+    common::work_stealing_thread_pool&
+    get_read_io_thread_pool();
+
     //
     // Starts all write IO dispatcher threads.
     //
@@ -62,7 +84,8 @@ public:
     get_num_contexts();
 
     //
-    // Gets the total number of read IO threads across all contexts.
+    // Gets the total number of read IO threads.
+    // These are shared across all contexts.
     //
     std::uint32_t
     get_num_read_io_threads();
@@ -75,6 +98,12 @@ public:
 
 private:
 
+    //
+    // Read IO thread pool shared by all contexts.
+    // Declared before the contexts so it outlives the read IO dispatchers.
+    //
+    std::unique_ptr<common::work_stealing_thread_pool> read_io_thread_pool_;
+
     //
     // Table for holding all threading contexts in an owning model.
     // References to be provided should be owning.
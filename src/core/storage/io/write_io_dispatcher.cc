@@ -15,32 +15,91 @@
 // ****************************************************
 
 #include <pthread.h>
+#include <iterator>
+#include <algorithm>
 #include "write_io_dispatcher.hh"
 #include "../cache/cache_accessor.hh"
 #include "data_partition_provider.hh"
 #include "storage_engine_interface.hh"
 #include "../../startup/system_init.hh"
+#include "../../metrics/metrics_registry.hh"
 #include "../../network/server/server.hh"
 
 namespace pandora::storage
 {
 
 write_io_dispatcher::write_io_dispatcher(
+    const std::uint16_t collocation_index,
+    const std::uint32_t write_io_batch_max_number_tasks,
+    const std::uint64_t write_io_batch_max_size_bytes,
+    const std::uint32_t write_io_batch_max_wait_time_us,
+    const std::uint32_t write_io_queue_max_number_tasks,
+    const std::uint64_t write_io_queue_max_size_bytes,
     data_partition_provider& data_partition_provider,
     cache_accessor& cache_accessor)
-    : data_partition_provider_{data_partition_provider},
-      cache_accessor_{cache_accessor}
+    : collocation_index_{collocation_index},
+      write_io_queue_budget_{write_io_queue_max_number_tasks, write_io_queue_max_size_bytes},
+      data_partition_provider_{data_partition_provider},
+      cache_accessor_{cache_accessor},
+      write_io_batch_max_number_tasks_{std::max(write_io_batch_max_number_tasks, 1u)},
+      write_io_batch_max_size_bytes_{write_io_batch_max_size_bytes},
+      write_io_batch_max_wait_time_us_{write_io_batch_max_wait_time_us}
 {}
 
 void
 write_io_dispatcher::start()
 {
-    TRACE_LOG(info, "Starting PandoraDB write IO dispatcher thread.");
+    start(get_stop_source_token());
+}
+
+void
+write_io_dispatcher::start(
+    std::stop_token stop_token)
+{
+    TRACE_LOG(info, "Starting PandoraDB write IO dispatcher thread. "
+        "CollocationIndex={}, "
+        "WriteIoBatchMaxNumberTasks={}, "
+        "WriteIoBatchMaxSizeInBytes={}, "
+        "WriteIoBatchMaxWaitTimeUs={}.",
+        collocation_index_,
+        write_io_batch_max_number_tasks_,
+        write_io_batch_max_size_bytes_,
+        write_io_batch_max_wait_time_us_);
 
     write_dispatcher_master_thread_ = std::jthread(
         &write_io_dispatcher::dispatch_write_io_tasks,
         this,
-        get_stop_source_token());
+        std::move(stop_token));
+}
+
+status::status_code
+write_io_dispatcher::try_admit_io_tasks(
+    const std::size_t number_tasks,
+    const std::uint64_t size_bytes)
+{
+    if (write_io_queue_budget_.try_acquire(number_tasks, size_bytes))
+    {
+        return status::success;
+    }
+
+    metrics::metrics_registry::record_write_io_queue_rejection(
+        collocation_index_,
+        number_tasks);
+
+    TRACE_LOG_RATE_LIMITED(warn, k_object_failure_max_log_lines_per_second, "Write IO queue is at capacity. "
+        "Rejecting write IO tasks. "
+        "CollocationIndex={}, "
+        "NumberTasks={}, "
+        "SizeInBytes={}, "
+        "QueueNumberTasks={}, "
+        "QueueSizeInBytes={}.",
+        collocation_index_,
+        number_tasks,
+        size_bytes,
+        write_io_queue_budget_.get_number_tasks(),
+        write_io_queue_budget_.get_size_bytes());
+
+    return status::write_io_queue_full;
 }
 
 void
@@ -55,6 +114,29 @@ write_io_dispatcher::enqueue_io_task(
             std::move(write_io_task)));
 }
 
+void
+write_io_dispatcher::enqueue_io_tasks(
+    std::vector<object_io_task>&& write_io_tasks)
+{
+    std::vector<std::unique_ptr<object_io_task>> write_io_task_handles;
+    write_io_task_handles.reserve(write_io_tasks.size());
+
+    for (object_io_task& write_io_task : write_io_tasks)
+    {
+        write_io_task_handles.emplace_back(
+            std::make_unique<object_io_task>(
+                std::move(write_io_task)));
+    }
+
+    //
+    // This is a lock-free operation. A bulk enqueue keeps the tasks
+    // contiguous in the queue, so the dispatcher dequeues them together.
+    //
+    write_io_tasks_queue_.enqueue_bulk(
+        std::make_move_iterator(write_io_task_handles.begin()),
+        write_io_task_handles.size());
+}
+
 void
 write_io_dispatcher::wait_for_stop()
 {
@@ -71,164 +153,376 @@ write_io_dispatcher::dispatch_write_io_tasks(
 {
     pthread_setname_np(pthread_self(), "pandora_write");
 
+    //
+    // Reusable buffer for the batches of tasks taken out of the queue.
+    //
+    std::vector<std::unique_ptr<object_io_task>> write_io_tasks(write_io_batch_max_number_tasks_);
+    std::size_t number_carried_over_tasks = 0u;
+
     //
     // This is the core tight loop for dispatching write io tasks.
+    // Tasks already taken out of the queue are completed before stopping.
     //
-    while (!stop_token.stop_requested())
+    while (!stop_token.stop_requested() ||
+           number_carried_over_tasks > 0u)
     {
-        std::unique_ptr<object_io_task> write_io_task;
-        if (write_io_tasks_queue_.wait_dequeue_timed(write_io_task, std::chrono::seconds(1u)))
+        const std::size_t number_write_io_tasks = dequeue_write_io_tasks_batch(
+            write_io_tasks,
+            number_carried_over_tasks);
+
+        if (number_write_io_tasks == 0u)
         {
-            execute_write_io_task(std::move(write_io_task));
+            continue;
         }
+
+        //
+        // Cut the batch at its maximum size in bytes. The tasks past the cut
+        // are carried over to the front of the next batch, keeping their order.
+        //
+        const std::size_t number_batch_tasks = get_write_io_tasks_batch_length(
+            std::span<const std::unique_ptr<object_io_task>>{
+                write_io_tasks.data(),
+                number_write_io_tasks});
+
+        execute_write_io_tasks_batch(std::span<std::unique_ptr<object_io_task>>{
+            write_io_tasks.data(),
+            number_batch_tasks});
+
+        std::move(
+            write_io_tasks.begin() + number_batch_tasks,
+            write_io_tasks.begin() + number_write_io_tasks,
+            write_io_tasks.begin());
+        number_carried_over_tasks = number_write_io_tasks - number_batch_tasks;
     }
 
     TRACE_LOG(info, "Stopping PandoraDB write IO dispatcher thread.");
 }
 
-void
-write_io_dispatcher::execute_write_io_task(
-    std::unique_ptr<object_io_task> write_io_task)
+std::size_t
+write_io_dispatcher::dequeue_write_io_tasks_batch(
+    std::vector<std::unique_ptr<object_io_task>>& write_io_tasks,
+    const std::size_t number_carried_over_tasks)
 {
-    storage_engine_interface& partition_storage_engine =
-        data_partition_provider_.get_partition_by_collocation(write_io_task->collocation_index_).get_storage_engine();
+    if (number_carried_over_tasks > 0u)
+    {
+        //
+        // The carried over tasks already waited for a batch, so only
+        // top the buffer up with whatever is ready in the queue.
+        //
+        return number_carried_over_tasks + write_io_tasks_queue_.try_dequeue_bulk(
+            write_io_tasks.begin() + number_carried_over_tasks,
+            write_io_tasks.size() - number_carried_over_tasks);
+    }
 
     //
-    // At this point of execution, this scope guarantees that the
-    // object container will be held for as long as the storage API takes,
-    // so it is safe to only pass down the storage engine reference given
-    // the storage engine reference will not be dropped by the storage engine.
+    // Block until at least one task is available. The timeout
+    // allows the dispatcher thread to periodically check for stop requests.
     //
-    status::status_code status = status::success;
-    switch (write_io_task->object_request_.get_optype())
+    std::size_t number_write_io_tasks = write_io_tasks_queue_.wait_dequeue_bulk_timed(
+        write_io_tasks.begin(),
+        write_io_tasks.size(),
+        std::chrono::seconds(1u));
+
+    if (number_write_io_tasks == 0u)
     {
-        case schemas::object_request_optype::insert:
+        return 0u;
+    }
+
+    std::uint64_t write_io_tasks_size_bytes = 0u;
+    for (std::size_t index = 0u; index < number_write_io_tasks; ++index)
+    {
+        write_io_tasks_size_bytes += get_write_io_task_size_bytes(write_io_tasks[index]->object_request_);
+    }
+
+    //
+    // Keep draining the queue until the batch is full in tasks or bytes, or the batching window expires.
+    // With a zero-length window, the batch only contains the tasks that accumulated
+    // while the previous batch was being committed, which adds no extra latency.
+    //
+    const auto batching_deadline = std::chrono::steady_clock::now() +
+        std::chrono::microseconds(write_io_batch_max_wait_time_us_);
+
+    while (number_write_io_tasks < write_io_tasks.size() &&
+           write_io_tasks_size_bytes < write_io_batch_max_size_bytes_)
+    {
+        const auto now = std::chrono::steady_clock::now();
+
+        if (now >= batching_deadline)
         {
-            status = execute_insert_operation(
-                partition_storage_engine,
-                write_io_task->container_->get_engine_reference(write_io_task->collocation_index_),
-                write_io_task->object_request_);
             break;
         }
-        case schemas::object_request_optype::remove:
+
+        const std::size_t number_dequeued_tasks = write_io_tasks_queue_.wait_dequeue_bulk_timed(
+            write_io_tasks.begin() + number_write_io_tasks,
+            write_io_tasks.size() - number_write_io_tasks,
+            std::chrono::duration_cast<std::chrono::microseconds>(batching_deadline - now));
+
+        if (number_dequeued_tasks == 0u)
         {
-            status = execute_remove_operation(
-                partition_storage_engine,
-                write_io_task->container_->get_engine_reference(write_io_task->collocation_index_),
-                write_io_task->object_request_);
             break;
         }
-        default:
+
+        for (std::size_t index = number_write_io_tasks; index < number_write_io_tasks + number_dequeued_tasks; ++index)
         {
-            //
-            // This should never happen given this should have been
-            // taken care of before enqueuing the task to the thread pool.
-            //
-            TRACE_LOG(critical, "Invalid write request optype for object "
-                "operation scheduled in the write IO thread pool. "
-                "Optype={}, "
-                "ObjectId={}, "
-                "ObjectContainerName={}.",
-                static_cast<std::uint8_t>(write_io_task->object_request_.get_optype()),
-                write_io_task->object_request_.get_object_id(),
-                write_io_task->object_request_.get_container_name());
+            write_io_tasks_size_bytes += get_write_io_task_size_bytes(write_io_tasks[index]->object_request_);
+        }
+
+        number_write_io_tasks += number_dequeued_tasks;
+    }
+
+    return number_write_io_tasks;
+}
 
-            status = status::invalid_operation;
+std::size_t
+write_io_dispatcher::get_write_io_tasks_batch_length(
+    std::span<const std::unique_ptr<object_io_task>> write_io_tasks) const
+{
+    std::uint64_t write_io_tasks_size_bytes = get_write_io_task_size_bytes(write_io_tasks.front()->object_request_);
+    std::size_t number_batch_tasks = 1u;
+
+    while (number_batch_tasks < write_io_tasks.size())
+    {
+        write_io_tasks_size_bytes += get_write_io_task_size_bytes(write_io_tasks[number_batch_tasks]->object_request_);
+
+        if (write_io_tasks_size_bytes > write_io_batch_max_size_bytes_)
+        {
             break;
         }
+
+        ++number_batch_tasks;
     }
 
+    return number_batch_tasks;
+}
+
+void
+write_io_dispatcher::execute_write_io_tasks_batch(
+    std::span<std::unique_ptr<object_io_task>> write_io_tasks)
+{
     //
-    // If the operation was successful, insert the object into the frontline cache.
-    // Doing this before returning a response back to the client
-    // guarantees that all future request see a consistent state for the object.
-    // This provides strong consistency for get operations after a well-acknowledged object insertion.
+    // Every write IO dispatcher is bound to a single collocation,
+    // so all tasks in the batch target the same data partition.
     //
-    if (status::succeeded(status))
+    storage_engine_interface& partition_storage_engine =
+        data_partition_provider_.get_partition_by_collocation(write_io_tasks.front()->collocation_index_).get_storage_engine();
+
+    //
+    // At this point of execution, this scope guarantees that the
+    // object containers will be held for as long as the storage API takes,
+    // so it is safe to only pass down the storage engine references given
+    // the storage engine references will not be dropped by the storage engine.
+    //
+    storage_engine_write_batch write_batch;
+    std::vector<status::status_code> statuses;
+    statuses.reserve(write_io_tasks.size());
+    std::size_t number_staged_tasks = 0u;
+    std::size_t number_expired_tasks = 0u;
+    std::uint64_t write_io_tasks_size_bytes = 0u;
+    const auto dequeue_time = std::chrono::steady_clock::now();
+
+    for (auto& write_io_task : write_io_tasks)
+    {
+        write_io_tasks_size_bytes += get_write_io_task_size_bytes(write_io_task->object_request_);
+
+        metrics::metrics_registry::record_io_queue_wait(
+            metrics::io_queue::write,
+            write_io_task->collocation_index_,
+            write_io_task->creation_time_);
+
+        //
+        // Drop the writes whose client gave up waiting, so no IO is spent on them under overload.
+        // An expired write is never applied, so its outcome stays consistent with the response.
+        //
+        if (write_io_task->is_expired(dequeue_time))
+        {
+            statuses.push_back(status::deadline_exceeded);
+            ++number_expired_tasks;
+
+            continue;
+        }
+
+        statuses.push_back(stage_write_io_task(
+            partition_storage_engine,
+            write_batch,
+            *write_io_task));
+
+        if (status::succeeded(statuses.back()))
+        {
+            ++number_staged_tasks;
+        }
+    }
+
+    if (number_expired_tasks > 0u)
+    {
+        metrics::metrics_registry::record_expired_io_tasks(
+            metrics::io_queue::write,
+            collocation_index_,
+            number_expired_tasks);
+    }
+
+    if (number_staged_tasks > 0u)
+    {
+        //
+        // Commit all the staged operations at once. This pays the WAL append
+        // and memtable insertion overhead a single time for the whole batch.
+        //
+        const auto commit_start_time = std::chrono::steady_clock::now();
+        const status::status_code commit_status = partition_storage_engine.commit_write_batch(
+            &write_batch);
+
+        metrics::metrics_registry::record_storage_engine_call(
+            metrics::storage_engine_call::commit_write_batch,
+            write_io_tasks.front()->collocation_index_,
+            commit_start_time);
+
+        if (status::failed(commit_status))
+        {
+            TRACE_LOG(error, "Write batch commit failed. Failing all staged write IO tasks. "
+                "CollocationIndex={}, "
+                "NumberStagedTasks={}, "
+                "Status={:#x}.",
+                write_io_tasks.front()->collocation_index_,
+                number_staged_tasks,
+                commit_status);
+
+            for (auto& status : statuses)
+            {
+                if (status::succeeded(status))
+                {
+                    status = commit_status;
+                }
+            }
+        }
+    }
+
+    //
+    // Only fan out the responses once the batch has been committed.
+    // Tasks are completed in the same order they were enqueued.
+    //
+    for (std::size_t index = 0u; index < write_io_tasks.size(); ++index)
     {
-        cache_accessor_.insert_object_into_cache(
-            write_io_task->object_request_);
+        complete_write_io_task(
+            std::move(write_io_tasks[index]),
+            statuses[index]);
     }
 
     //
-    // Provide the response back to the client over the async callback.
+    // Only make room for new write IO tasks once the batch has been completed,
+    // so the budget also bounds the memory held by the batch being committed.
     //
-    network::server::send_response(
-        write_io_task->response_callback_,
-        status);
+    write_io_queue_budget_.release(
+        write_io_tasks.size(),
+        write_io_tasks_size_bytes);
+
+    metrics::metrics_registry::record_write_io_queue_depth(
+        collocation_index_,
+        write_io_queue_budget_.get_number_tasks(),
+        write_io_queue_budget_.get_size_bytes());
 }
 
 status::status_code
-write_io_dispatcher::execute_insert_operation(
+write_io_dispatcher::stage_write_io_task(
     storage_engine_interface& partition_storage_engine,
-    storage_engine_reference* engine_reference,
-    const schemas::object_request& object_request)
+    storage_engine_write_batch& write_batch,
+    object_io_task& write_io_task)
 {
-    status::status_code status = partition_storage_engine.insert_object(
-        engine_reference,
-        object_request.get_object_id().c_str(),
-        object_request.get_object_data());
+    storage_engine_reference* engine_reference =
+        write_io_task.container_->get_engine_reference(write_io_task.collocation_index_);
+    const schemas::object_request& object_request = write_io_task.object_request_;
 
-    if (status::succeeded(status))
+    switch (object_request.get_optype())
     {
-        TRACE_LOG(info, "Object insertion succeeded. "
-            "Optype={}, "
-            "ObjectId={}, "
-            "ObjectContainerName={}.",
-            static_cast<std::uint8_t>(object_request.get_optype()),
-            object_request.get_object_id(),
-            object_request.get_container_name());
-    }
-    else
-    {
-        TRACE_LOG(error, "Object insertion failed. "
-            "Optype={}, "
-            "ObjectId={}, "
-            "ObjectContainerName={}, "
-            "Status={:#x}.",
-            static_cast<std::uint8_t>(object_request.get_optype()),
-            object_request.get_object_id(),
-            object_request.get_container_name(),
-            status);
-    }
+        case schemas::object_request_optype::insert:
+        {
+            return partition_storage_engine.stage_object_insertion(
+                &write_batch,
+                engine_reference,
+                object_request.get_object_id().c_str(),
+                object_request.get_object_data());
+        }
+        case schemas::object_request_optype::remove:
+        {
+            return partition_storage_engine.stage_object_removal(
+                &write_batch,
+                engine_reference,
+                object_request.get_object_id().c_str());
+        }
+        default:
+        {
+            //
+            // This should never happen given this should have been
+            // taken care of before enqueuing the task to the thread pool.
+            //
+            TRACE_LOG(critical, "Invalid write request optype for object "
+                "operation scheduled in the write IO thread pool. "
+                "Optype={}, "
+                "ObjectId={}, "
+                "ObjectContainerName={}.",
+                static_cast<std::uint8_t>(object_request.get_optype()),
+                object_request.get_object_id(),
+                object_request.get_container_name());
 
-    return status;
+            return status::invalid_operation;
+        }
+    }
 }
 
-status::status_code
-write_io_dispatcher::execute_remove_operation(
-    storage_engine_interface& partition_storage_engine,
-    storage_engine_reference* engine_reference,
-    const schemas::object_request& object_request)
+void
+write_io_dispatcher::complete_write_io_task(
+    std::unique_ptr<object_io_task> write_io_task,
+    const status::status_code status)
 {
-    status::status_code status = partition_storage_engine.remove_object(
-        engine_reference,
-        object_request.get_object_id().c_str());
+    const schemas::object_request& object_request = write_io_task->object_request_;
+    const char* operation_name =
+        object_request.get_optype() == schemas::object_request_optype::remove ? "removal" : "insertion";
 
     if (status::succeeded(status))
     {
-        TRACE_LOG(info, "Object removal succeeded. "
+        TRACE_LOG_SAMPLED(info, k_object_operation_log_sample_rate, "Object {} succeeded. "
             "Optype={}, "
             "ObjectId={}, "
             "ObjectContainerName={}.",
+            operation_name,
             static_cast<std::uint8_t>(object_request.get_optype()),
             object_request.get_object_id(),
             object_request.get_container_name());
+
+        //
+        // If the operation was successful, insert the object into the frontline cache,
+        // or evict it for removals. Doing this before returning a response back to the client
+        // guarantees that all future request see a consistent state for the object.
+        // This provides strong consistency for get operations after a well-acknowledged object
+        // insertion or removal. Both operations supersede any in-flight cache fill of the object.
+        //
+        if (object_request.get_optype() == schemas::object_request_optype::remove)
+        {
+            cache_accessor_.remove_object_from_cache(
+                write_io_task->object_request_);
+        }
+        else
+        {
+            cache_accessor_.insert_object_into_cache(
+                write_io_task->object_request_);
+        }
     }
     else
     {
-        TRACE_LOG(error, "Object removal failed. "
+        TRACE_LOG_RATE_LIMITED(error, k_object_failure_max_log_lines_per_second, "Object {} failed. "
             "Optype={}, "
             "ObjectId={}, "
             "ObjectContainerName={}, "
             "Status={:#x}.",
+            operation_name,
             static_cast<std::uint8_t>(object_request.get_optype()),
             object_request.get_object_id(),
             object_request.get_container_name(),
             status);
     }
 
-    return status;
+    //
+    // Provide the outcome back to the client, or to the batch the task belongs to.
+    //
+    write_io_task->complete(status);
 }
 
 std::uint32_t
@@ -237,4 +531,11 @@ write_io_dispatcher::get_num_io_threads()
     return 1u;
 }
 
+std::uint64_t
+write_io_dispatcher::get_write_io_task_size_bytes(
+    const schemas::object_request& object_request)
+{
+    return object_request.get_object_id().size() + object_request.get_object_data().size();
+}
+
 } // namespace pandora::storage.
\ No newline at end of file
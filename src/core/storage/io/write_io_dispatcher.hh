@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <span>
+#include <stop_token>
+#include <vector>
+#include "io_queue_budget.hh"
 #include "io_dispatcher_interface.hh"
 #include "../models/object_io_task.hh"
 #include "../../common/startable_interface.hh"
@@ -36,23 +40,57 @@ public:
     // Constructor.
     //
     write_io_dispatcher(
+        const std::uint16_t collocation_index,
+        const std::uint32_t write_io_batch_max_number_tasks,
+        const std::uint64_t write_io_batch_max_size_bytes,
+        const std::uint32_t write_io_batch_max_wait_time_us,
+        const std::uint32_t write_io_queue_max_number_tasks,
+        const std::uint64_t write_io_queue_max_size_bytes,
         data_partition_provider& data_partition_provider,
         cache_accessor& cache_accessor);
 
     //
     // Starts the write dispatcher master thread.
+    // The thread stops along with the rest of the system.
     //
     void
     start() override;
 
+    //
+    // Starts the write dispatcher master thread,
+    // which stops once a stop is requested on the given token.
+    //
+    void
+    start(
+        std::stop_token stop_token);
+
+    //
+    // Reserves room in the write IO queue for a group of write IO operations.
+    // The room is returned once the write batch holding the tasks has been completed,
+    // so the budget bounds both the queued tasks and the ones being committed.
+    //
+    status::status_code
+    try_admit_io_tasks(
+        const std::size_t number_tasks,
+        const std::uint64_t size_bytes) override;
+
     //
     // Enqueues a write IO operation for to be processed
     // by the dispatcher in a single-threaded batching model.
+    // Room for the task must have been admitted beforehand.
     //
     void
     enqueue_io_task(
         object_io_task&& write_io_task) override;
 
+    //
+    // Enqueues multiple write IO operations at once, so
+    // they are most likely committed within the same write batch.
+    //
+    void
+    enqueue_io_tasks(
+        std::vector<object_io_task>&& write_io_tasks) override;
+
     //
     // Waits for the write dispatcher master
     // thread to finish execution in a blocking manner.
@@ -66,6 +104,14 @@ public:
     std::uint32_t
     get_num_io_threads() override;
 
+    //
+    // Gets the number of bytes a write IO operation holds in the write IO queue.
+    //
+    static
+    std::uint64_t
+    get_write_io_task_size_bytes(
+        const schemas::object_request& object_request);
+
 private:
 
     //
@@ -76,33 +122,67 @@ private:
     dispatch_write_io_tasks(
         std::stop_token stop_token);
 
+    //
+    // Dequeues the next batch of write IO tasks into the provided buffer, after the tasks
+    // carried over from the previous batch. Blocks until at least one task is available,
+    // and then keeps draining the queue until the buffer is full, the batch reaches its size
+    // in bytes or the batching wait time expires. Carried over tasks are never made to wait.
+    // Returns the number of tasks in the buffer, including the carried over ones.
+    //
+    std::size_t
+    dequeue_write_io_tasks_batch(
+        std::vector<std::unique_ptr<object_io_task>>& write_io_tasks,
+        const std::size_t number_carried_over_tasks);
+
+    //
+    // Gets the number of leading tasks in the buffer which fit within the maximum
+    // size in bytes of a write batch. The first task always fits, whatever its size.
+    //
+    std::size_t
+    get_write_io_tasks_batch_length(
+        std::span<const std::unique_ptr<object_io_task>> write_io_tasks) const;
+
+    //
+    // Group-commits a batch of write IO tasks into the storage engine
+    // with a single write batch and provides the responses for every task.
+    //
     void
-    execute_write_io_task(
-        std::unique_ptr<object_io_task> write_io_task);
+    execute_write_io_tasks_batch(
+        std::span<std::unique_ptr<object_io_task>> write_io_tasks);
 
     //
-    // Executes an insertion operation with the storage engine.
+    // Stages the operation of a write IO task into the write batch.
     //
     status::status_code
-    execute_insert_operation(
+    stage_write_io_task(
         storage_engine_interface& partition_storage_engine,
-        storage_engine_reference* engine_reference,
-        const schemas::object_request& object_request);
+        storage_engine_write_batch& write_batch,
+        object_io_task& write_io_task);
 
     //
-    // Executes a removal operation with the storage engine.
+    // Completes a write IO task once its write batch has been committed.
+    // Updates the frontline cache on success and replies back to the client.
     //
-    status::status_code
-    execute_remove_operation(
-        storage_engine_interface& partition_storage_engine,
-        storage_engine_reference* engine_reference,
-        const schemas::object_request& object_request);
+    void
+    complete_write_io_task(
+        std::unique_ptr<object_io_task> write_io_task,
+        const status::status_code status);
+
+    //
+    // Collocation to which the dispatcher is bound.
+    //
+    const std::uint16_t collocation_index_;
 
     //
     // Lock-free and blocking queue for processing write IO operations.
     //
     moodycamel::BlockingConcurrentQueue<std::unique_ptr<object_io_task>> write_io_tasks_queue_;
 
+    //
+    // Capacity budget of the write IO queue.
+    //
+    io_queue_budget write_io_queue_budget_;
+
     //
     // Reference for the data partition provider.
     //
@@ -113,10 +193,36 @@ private:
     //
     cache_accessor& cache_accessor_;
 
+    //
+    // Maximum number of write IO tasks to be group-committed in a single write batch.
+    //
+    const std::uint32_t write_io_batch_max_number_tasks_;
+
+    //
+    // Maximum size in bytes of the write IO tasks group-committed in a single write batch.
+    // Bounds the memory and the commit latency of batches of large objects.
+    //
+    const std::uint64_t write_io_batch_max_size_bytes_;
+
+    //
+    // Maximum time in microseconds to wait for more tasks before committing a write batch.
+    //
+    const std::uint32_t write_io_batch_max_wait_time_us_;
+
     //
     // Long-running write io dispatcher master thread.
     //
     std::jthread write_dispatcher_master_thread_;
+
+    //
+    // Number of successful per-object operations per logged one.
+    //
+    static constexpr std::uint32_t k_object_operation_log_sample_rate = 1'000u;
+
+    //
+    // Maximum number of failed per-object operations logged per second.
+    //
+    static constexpr std::uint32_t k_object_failure_max_log_lines_per_second = 100u;
 };
 
 } // namespace pandora::storage.
\ No newline at end of file
@@ -0,0 +1,85 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'engine_statistics_service.cc'
+// Author: jcjuarez
+// Description:
+//      Service for collecting the statistics of the
+//      storage engine instances of all data partitions.
+// ****************************************************
+
+#include <memory>
+#include "../models/container.hh"
+#include "../io/data_partition.hh"
+#include "engine_statistics_service.hh"
+#include "../index/container_index.hh"
+#include "../io/data_partition_provider.hh"
+
+namespace pandora
+{
+namespace storage
+{
+
+engine_statistics_service::engine_statistics_service(
+    data_partition& metadata_partition,
+    data_partition_provider& data_partition_provider,
+    container_index& container_index)
+    : metadata_partition_{metadata_partition},
+      data_partition_provider_{data_partition_provider},
+      container_index_{container_index}
+{}
+
+std::vector<data_partition_statistics>
+engine_statistics_service::get_engine_statistics()
+{
+    //
+    // Hold a reference to every live object container for the duration of the collection,
+    // so their storage engine references cannot be closed while their properties are read.
+    //
+    std::vector<std::shared_ptr<container>> containers;
+    for (std::uint16_t bucket_index = 0u; bucket_index < container_index_.get_number_container_buckets(); ++bucket_index)
+    {
+        for (std::shared_ptr<container>& container : container_index_.get_all_containers_from_bucket(bucket_index))
+        {
+            if (!container->is_deleted())
+            {
+                containers.push_back(std::move(container));
+            }
+        }
+    }
+
+    std::vector<data_partition_statistics> partitions_statistics;
+    std::vector<storage_engine_reference*> engine_references;
+    engine_references.reserve(containers.size());
+
+    for (data_partition& partition : data_partition_provider_.get_all_partitions())
+    {
+        engine_references.clear();
+        for (const std::shared_ptr<container>& container : containers)
+        {
+            engine_references.push_back(container->get_engine_reference(partition.get_collocation_index()));
+        }
+
+        partitions_statistics.push_back(data_partition_statistics{
+            partition.get_collocation_index(),
+            false /* is_metadata_partition */,
+            partition.get_storage_engine().get_engine_statistics(engine_references)});
+    }
+
+    storage_engine_reference* metadata_engine_reference = container_index_.get_container_metadata_engine_reference();
+    partitions_statistics.push_back(data_partition_statistics{
+        metadata_partition_.get_collocation_index(),
+        true /* is_metadata_partition */,
+        metadata_partition_.get_storage_engine().get_engine_statistics(
+            std::span<storage_engine_reference* const>{&metadata_engine_reference, 1u})});
+
+    return partitions_statistics;
+}
+
+} // namespace storage.
+} // namespace pandora.
@@ -0,0 +1,90 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'engine_statistics_service.hh'
+// Author: jcjuarez
+// Description:
+//      Service for collecting the statistics of the
+//      storage engine instances of all data partitions.
+// ****************************************************
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "../io/storage_engine_statistics.hh"
+
+namespace pandora
+{
+namespace storage
+{
+
+class data_partition;
+class container_index;
+class data_partition_provider;
+
+//
+// Statistics of the storage engine instance of a data partition.
+//
+struct data_partition_statistics
+{
+    //
+    // Collocation index of the data partition.
+    //
+    std::uint16_t collocation_index_;
+
+    //
+    // Whether this is the partition holding the object containers metadata.
+    //
+    bool is_metadata_partition_;
+
+    //
+    // Statistics of the storage engine instance, including its object containers.
+    //
+    storage_engine_statistics engine_statistics_;
+};
+
+class engine_statistics_service
+{
+public:
+
+    //
+    // Constructor.
+    //
+    engine_statistics_service(
+        data_partition& metadata_partition,
+        data_partition_provider& data_partition_provider,
+        container_index& container_index);
+
+    //
+    // Collects the statistics of every data partition, followed by the metadata partition.
+    // Data partitions include the engine properties of every live object container.
+    //
+    std::vector<data_partition_statistics>
+    get_engine_statistics();
+
+private:
+
+    //
+    // Containers metadata partition handle.
+    //
+    data_partition& metadata_partition_;
+
+    //
+    // Data partition provider handle.
+    //
+    data_partition_provider& data_partition_provider_;
+
+    //
+    // Object container index handle.
+    //
+    container_index& container_index_;
+};
+
+} // namespace storage.
+} // namespace pandora.
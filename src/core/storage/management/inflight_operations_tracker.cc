@@ -1,10 +1,197 @@
 // ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
 // PandoraDB
-// 
+// Storage
 // 'inflight_operations_tracker.cc'
 // Author: jcjuarez
 // Description:
-//
+//      Tracker of the in-flight object reads, which
+//      lets concurrent cache misses of the same object
+//      share a single storage engine read.
 // ****************************************************
 
 #include "inflight_operations_tracker.hh"
+#include "../../metrics/metrics_registry.hh"
+#include "../../network/server/server.hh"
+
+namespace pandora::storage
+{
+
+inflight_read::inflight_read(
+    inflight_operations_tracker& tracker,
+    std::string&& container_name,
+    std::string&& object_id,
+    const std::uint64_t object_version,
+    const std::chrono::steady_clock::time_point deadline)
+    : tracker_{tracker},
+      key_{std::move(container_name), std::move(object_id)},
+      object_version_{object_version},
+      deadline_{deadline.time_since_epoch().count()}
+{}
+
+void
+inflight_read::complete(
+    const status::status_code status,
+    std::optional<std::string_view> object_data)
+{
+    //
+    // The joined clients are taken out under the shard lock, and replied to outside of it.
+    //
+    std::vector<inflight_read_waiter> waiters = tracker_.finish_read(*this);
+
+    for (inflight_read_waiter& waiter : waiters)
+    {
+        network::server::send_object_response(
+            waiter.response_callback_,
+            status,
+            waiter.is_binary_transport_,
+            status::succeeded(status) ? object_data : std::nullopt);
+
+        metrics::metrics_registry::record_object_operation(
+            schemas::object_request_optype::get,
+            metrics::cache_outcome::coalesced,
+            status,
+            waiter.reception_time_);
+    }
+}
+
+std::chrono::steady_clock::time_point
+inflight_read::get_deadline() const
+{
+    return std::chrono::steady_clock::time_point{
+        std::chrono::steady_clock::duration{deadline_.load(std::memory_order_relaxed)}};
+}
+
+bool
+inflight_read::try_expire(
+    const std::chrono::steady_clock::time_point now)
+{
+    return tracker_.expire_read(
+        *this,
+        now);
+}
+
+std::shared_ptr<inflight_read>
+inflight_operations_tracker::join_or_start_read(
+    const std::string& container_name,
+    const std::string& object_id,
+    const std::uint64_t object_version,
+    const std::chrono::steady_clock::time_point deadline,
+    const std::chrono::steady_clock::time_point reception_time,
+    const bool is_binary_transport,
+    network::server_response_callback& response_callback)
+{
+    std::pair<std::string, std::string> key{container_name, object_id};
+    tracker_shard& shard = get_tracker_shard(key);
+    std::lock_guard<std::mutex> lock{shard.lock_};
+
+    auto read_iterator = shard.reads_.find(key);
+
+    if (read_iterator != shard.reads_.end() &&
+        read_iterator->second->object_version_ == object_version)
+    {
+        inflight_read& read = *read_iterator->second;
+
+        //
+        // Keep the shared read alive for as long as any joined client still waits for it.
+        //
+        const std::chrono::steady_clock::rep deadline_ticks = deadline.time_since_epoch().count();
+        if (deadline_ticks > read.deadline_.load(std::memory_order_relaxed))
+        {
+            read.deadline_.store(deadline_ticks, std::memory_order_relaxed);
+        }
+
+        read.waiters_.push_back(inflight_read_waiter{
+            std::move(response_callback),
+            is_binary_transport,
+            reception_time});
+
+        return nullptr;
+    }
+
+    //
+    // Either no read is in flight, or the object was written or removed after it started,
+    // in which case the new read supersedes it for the clients arriving from now on.
+    //
+    auto read = std::make_shared<inflight_read>(
+        *this,
+        std::move(key.first),
+        std::move(key.second),
+        object_version,
+        deadline);
+    shard.reads_.insert_or_assign(read->key_, read);
+
+    return read;
+}
+
+std::vector<inflight_read_waiter>
+inflight_operations_tracker::finish_read(
+    inflight_read& read)
+{
+    tracker_shard& shard = get_tracker_shard(read.key_);
+    std::lock_guard<std::mutex> lock{shard.lock_};
+    unregister_read(
+        shard,
+        read);
+
+    return std::move(read.waiters_);
+}
+
+bool
+inflight_operations_tracker::expire_read(
+    inflight_read& read,
+    const std::chrono::steady_clock::time_point now)
+{
+    tracker_shard& shard = get_tracker_shard(read.key_);
+    std::lock_guard<std::mutex> lock{shard.lock_};
+
+    if (now < read.get_deadline())
+    {
+        return false;
+    }
+
+    //
+    // Close the read before the expiry is acted upon, so a client arriving
+    // from now on starts a new read instead of joining one about to fail.
+    //
+    unregister_read(
+        shard,
+        read);
+
+    return true;
+}
+
+void
+inflight_operations_tracker::unregister_read(
+    tracker_shard& shard,
+    inflight_read& read)
+{
+    //
+    // A superseded read is no longer registered, so its successor must be kept.
+    //
+    auto read_iterator = shard.reads_.find(read.key_);
+
+    if (read_iterator != shard.reads_.end() &&
+        read_iterator->second.get() == &read)
+    {
+        shard.reads_.erase(read_iterator);
+    }
+}
+
+inflight_operations_tracker::tracker_shard&
+inflight_operations_tracker::get_tracker_shard(
+    const std::pair<std::string, std::string>& key)
+{
+    //
+    // Route with the upper bits, given the shard hash tables index with the lower ones.
+    //
+    const std::uint64_t key_hash = absl::Hash<std::pair<std::string, std::string>>{}(key);
+
+    return tracker_shards_[(key_hash >> 32u) % k_number_tracker_shards];
+}
+
+} // namespace pandora::storage.
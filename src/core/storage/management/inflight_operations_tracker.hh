@@ -1,15 +1,213 @@
 // ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
 // PandoraDB
-// 
+// Storage
 // 'inflight_operations_tracker.hh'
 // Author: jcjuarez
 // Description:
-//
+//      Tracker of the in-flight object reads, which
+//      lets concurrent cache misses of the same object
+//      share a single storage engine read.
 // ****************************************************
 
 #pragma once
 
+#include <mutex>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <string_view>
+#include <absl/container/flat_hash_map.h>
+#include "../../status/status.hh"
+#include "../../common/aliases.hh"
+
+namespace pandora::storage
+{
+
+class inflight_operations_tracker;
+
+//
+// Client waiting for the outcome of a read started by another request.
+//
+struct inflight_read_waiter
+{
+    //
+    // Callback on which to provide the response to the client.
+    //
+    network::server_response_callback response_callback_;
+
+    //
+    // Whether the client uses the binary transport.
+    //
+    bool is_binary_transport_;
+
+    //
+    // Time at which the request of the client was received.
+    //
+    std::chrono::steady_clock::time_point reception_time_;
+};
+
+//
+// Storage engine read of an object shared by every concurrent cache miss of the object.
+// Held by the IO task of the request which started it, which completes it with its outcome.
+//
+class inflight_read
+{
+public:
+
+    //
+    // Constructor.
+    //
+    inflight_read(
+        inflight_operations_tracker& tracker,
+        std::string&& container_name,
+        std::string&& object_id,
+        const std::uint64_t object_version,
+        const std::chrono::steady_clock::time_point deadline);
+
+    //
+    // Completes the read, replying to every joined client with the same outcome.
+    // Clients arriving afterwards start a new read. Must be called exactly once.
+    //
+    void
+    complete(
+        const status::status_code status,
+        std::optional<std::string_view> object_data);
+
+    //
+    // Gets the latest deadline across the request which started the read and every joined client.
+    //
+    std::chrono::steady_clock::time_point
+    get_deadline() const;
+
+    //
+    // Expires the read if the latest deadline has passed at the given time. Decided under the
+    // tracker shard lock, which joining clients also take to extend the deadline, so a client either
+    // keeps the read alive or arrives once it is closed and starts a new read. Returns whether it expired.
+    //
+    bool
+    try_expire(
+        const std::chrono::steady_clock::time_point now);
+
+private:
 
-class inflight_operations_tracker {
+    friend class inflight_operations_tracker;
 
+    //
+    // Tracker the read is registered in.
+    //
+    inflight_operations_tracker& tracker_;
+
+    //
+    // {ContainerName, ObjectId} key of the object being read.
+    //
+    const std::pair<std::string, std::string> key_;
+
+    //
+    // Frontline cache version of the object when the read was started. Clients only join
+    // while the version is unchanged, so no client gets a value older than an acknowledged write.
+    //
+    const std::uint64_t object_version_;
+
+    //
+    // Latest deadline of the read, in steady clock ticks. Extended as clients join.
+    //
+    std::atomic<std::chrono::steady_clock::rep> deadline_;
+
+    //
+    // Clients joined to the read. Guarded by the lock of the tracker shard of the key.
+    //
+    std::vector<inflight_read_waiter> waiters_;
+};
+
+class inflight_operations_tracker
+{
+public:
+
+    //
+    // Constructor.
+    //
+    inflight_operations_tracker() = default;
+
+    //
+    // Joins the in-flight read of an object, or starts a new read if there is none, or if the
+    // object version changed since it started. Returns the handle of a new read, which the caller
+    // must complete once the object is read. Returns null if the client joined an existing read,
+    // in which case the response callback is consumed and will be completed with its outcome.
+    //
+    std::shared_ptr<inflight_read>
+    join_or_start_read(
+        const std::string& container_name,
+        const std::string& object_id,
+        const std::uint64_t object_version,
+        const std::chrono::steady_clock::time_point deadline,
+        const std::chrono::steady_clock::time_point reception_time,
+        const bool is_binary_transport,
+        network::server_response_callback& response_callback);
+
+private:
+
+    friend class inflight_read;
+
+    //
+    // Unregisters a read and takes its joined clients out of it.
+    //
+    std::vector<inflight_read_waiter>
+    finish_read(
+        inflight_read& read);
+
+    //
+    // Unregisters a read if its latest deadline has passed at the given time.
+    //
+    bool
+    expire_read(
+        inflight_read& read,
+        const std::chrono::steady_clock::time_point now);
+
+    //
+    // Tracker shard, aligned to a cache line to avoid false sharing between shards.
+    //
+    struct alignas(64) tracker_shard
+    {
+        std::mutex lock_;
+        absl::flat_hash_map<std::pair<std::string, std::string>, std::shared_ptr<inflight_read>> reads_;
+    };
+
+    //
+    // Gets the tracker shard of a {ContainerName, ObjectId} key.
+    //
+    tracker_shard&
+    get_tracker_shard(
+        const std::pair<std::string, std::string>& key);
+
+    //
+    // Unregisters a read, unless it was already superseded by a newer read.
+    // Must be called under the lock of the tracker shard of the read.
+    //
+    static
+    void
+    unregister_read(
+        tracker_shard& shard,
+        inflight_read& read);
+
+    //
+    // Number of tracker shards.
+    //
+    static constexpr std::size_t k_number_tracker_shards = 32u;
+
+    //
+    // Tracker shards, indexed by key hash.
+    //
+    std::array<tracker_shard, k_number_tracker_shards> tracker_shards_;
 };
+
+} // namespace pandora::storage.
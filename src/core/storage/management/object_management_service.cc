@@ -12,12 +12,19 @@
 //      Management service for object operations.
 // ****************************************************
 
+#include <algorithm>
+#include "../models/container.hh"
+#include "../models/object_batch_context.hh"
+#include "../io/container_cursor.hh"
 #include "../index/container_index.hh"
 #include "../cache/frontline_cache.hh"
 #include "object_management_service.hh"
 #include "../io/collocation_resolver.hh"
+#include "../io/write_io_dispatcher.hh"
 #include "../io/io_dispatcher_interface.hh"
 #include "../../common/request_validations.hh"
+#include "../../common/response_utilities.hh"
+#include "../../common/work_stealing_thread_pool.hh"
 #include "../io/threading_context_provider.hh"
 
 namespace pandora
@@ -187,19 +194,35 @@ object_management_service::orchestrate_concurrent_write_request(
         return status::invalid_operation;
     }
 
+    const std::uint16_t collocation_index = collocation_resolver_.get_collocation_index_for_key(
+        object_request.get_object_id());
+    const std::uint64_t write_io_task_size_bytes = write_io_dispatcher::get_write_io_task_size_bytes(
+        object_request);
+    io_dispatcher_interface& write_io_dispatcher =
+        threading_context_provider_.get_context_by_collocation(collocation_index).get_write_io_dispatcher();
+
+    //
+    // Fail fast while the write IO queue of the collocation is at capacity. This happens
+    // before the request is moved into the task, so the caller can still reply with it.
+    //
+    const status::status_code status = write_io_dispatcher.try_admit_io_tasks(
+        1u,
+        write_io_task_size_bytes);
+
+    if (status::failed(status))
+    {
+        return status;
+    }
+
     //
     // Create the long-lived write IO task to be dispatched down to the storage engine.
     //
-    const std::uint16_t collocation_index = collocation_resolver_.get_collocation_index_for_key(
-        object_request.get_object_id());
     object_io_task write_io_task {
         collocation_index,
         std::move(object_request),
         std::move(container),
         std::move(response_callback)};
 
-    io_dispatcher_interface& write_io_dispatcher =
-        threading_context_provider_.get_context_by_collocation(collocation_index).get_write_io_dispatcher();
     write_io_dispatcher.enqueue_io_task(
         std::move(write_io_task));
 
@@ -229,6 +252,29 @@ object_management_service::orchestrate_concurrent_read_request(
         return status::invalid_operation;
     }
 
+    //
+    // Concurrent cache misses of the same object share a single storage engine read,
+    // so a hot object being evicted or first requested does not trigger a read per request.
+    // The object version is taken before the read, so clients only join a read which started
+    // after the last acknowledged write or removal of the object.
+    //
+    const cache_fill_ticket object_version_ticket = frontline_cache_.get_fill_ticket(
+        object_request.get_object_id(),
+        object_request.get_container_name());
+    std::shared_ptr<inflight_read> inflight_read = inflight_operations_tracker_.join_or_start_read(
+        object_request.get_container_name(),
+        object_request.get_object_id(),
+        object_version_ticket.version_,
+        object_request.get_deadline(),
+        object_request.get_reception_time(),
+        object_request.is_binary_transport(),
+        response_callback);
+
+    if (inflight_read == nullptr)
+    {
+        return status::success;
+    }
+
     //
     // Create the long-lived read IO task to be dispatched down to the storage engine.
     //
@@ -239,6 +285,7 @@ object_management_service::orchestrate_concurrent_read_request(
         std::move(object_request),
         std::move(container),
         std::move(response_callback)};
+    read_io_task.inflight_read_ = std::move(inflight_read);
 
     io_dispatcher_interface& read_io_dispatcher =
         threading_context_provider_.get_context_by_collocation(collocation_index).get_read_io_dispatcher();
@@ -248,7 +295,481 @@ object_management_service::orchestrate_concurrent_read_request(
     return status::success;
 }
 
-std::optional<byte_stream>
+status::status_code
+object_management_service::validate_object_batch_request(
+    const schemas::object_batch_request& object_batch_request)
+{
+    const std::size_t number_objects = object_batch_request.get_object_requests().size();
+
+    if (!is_object_operation_optype_valid(object_batch_request.get_optype()))
+    {
+        TRACE_LOG(error, "Invalid optype received for object batch operation. "
+            "Optype={}, "
+            "NumberObjects={}.",
+            static_cast<std::uint8_t>(object_batch_request.get_optype()),
+            number_objects);
+
+        return status::invalid_operation;
+    }
+
+    status::status_code status = common::request_validations::validate_container_name(
+        object_batch_request.get_container_name(),
+        storage_configuration_);
+
+    if (status::failed(status))
+    {
+        //
+        // Given object container name is invalid.
+        // Not logging the parameters as to avoid potential
+        // large-buffer attacks in case the parameters are too big.
+        //
+        TRACE_LOG(error, "Object batch operation will be failed as the "
+            "object container name is invalid. "
+            "Optype={}, "
+            "ObjectContainerNameSizeInBytes={}, "
+            "ObjectContainerNameMaxSizeInBytes={}, "
+            "Status={:#x}.",
+            static_cast<std::uint8_t>(object_batch_request.get_optype()),
+            object_batch_request.get_container_name().size(),
+            storage_configuration_.max_container_name_size_bytes_,
+            status);
+
+        return status;
+    }
+
+    if (number_objects == 0u)
+    {
+        TRACE_LOG(error, "Object batch operation will be failed as the batch is empty. "
+            "Optype={}, "
+            "ObjectContainerName={}.",
+            static_cast<std::uint8_t>(object_batch_request.get_optype()),
+            object_batch_request.get_container_name());
+
+        return status::object_batch_empty;
+    }
+
+    if (number_objects > storage_configuration_.max_number_objects_per_batch_)
+    {
+        TRACE_LOG(error, "Object batch operation will be failed as the "
+            "batch exceeds the maximum number of objects. "
+            "Optype={}, "
+            "ObjectContainerName={}, "
+            "NumberObjects={}, "
+            "MaxNumberObjects={}.",
+            static_cast<std::uint8_t>(object_batch_request.get_optype()),
+            object_batch_request.get_container_name(),
+            number_objects,
+            storage_configuration_.max_number_objects_per_batch_);
+
+        return status::object_batch_size_exceeds_limit;
+    }
+
+    return status::success;
+}
+
+void
+object_management_service::orchestrate_concurrent_batch_request(
+    schemas::object_batch_request&& object_batch_request,
+    std::shared_ptr<container> container,
+    network::server_response_callback&& response_callback)
+{
+    const schemas::object_request_optype optype = object_batch_request.get_optype();
+    std::vector<schemas::object_request>& object_requests = object_batch_request.get_object_requests_mutable();
+    auto batch_context = std::make_shared<object_batch_context>(
+        object_requests.size(),
+        optype == schemas::object_request_optype::get,
+        std::move(response_callback));
+
+    //
+    // Group the tasks by collocation. The per-object positions are kept
+    // in the tasks themselves, so the statuses are returned in request order.
+    //
+    std::vector<std::vector<object_io_task>> io_tasks_by_collocation(
+        threading_context_provider_.get_num_contexts());
+
+    for (std::size_t index = 0u; index < object_requests.size(); ++index)
+    {
+        schemas::object_request& object_request = object_requests[index];
+        status::status_code status = validate_request_parameters(object_request);
+
+        if (status::failed(status))
+        {
+            batch_context->complete_object(
+                index,
+                status);
+
+            continue;
+        }
+
+        if (optype == schemas::object_request_optype::get)
+        {
+            //
+            // Serve the objects present in the frontline cache, or known to be absent, right away.
+            // The held reference keeps the buffer alive while it is being copied.
+            //
+            shared_byte_stream object_data = frontline_cache_.get(
+                object_request.get_object_id(),
+                object_request.get_container_name());
+
+            if (object_data != nullptr)
+            {
+                batch_context->complete_object(
+                    index,
+                    status::success,
+                    *object_data);
+
+                continue;
+            }
+
+            if (frontline_cache_.is_negative(
+                    object_request.get_object_id(),
+                    object_request.get_container_name()))
+            {
+                batch_context->complete_object(
+                    index,
+                    status::object_not_found);
+
+                continue;
+            }
+        }
+
+        const std::uint16_t collocation_index = collocation_resolver_.get_collocation_index_for_key(
+            object_request.get_object_id());
+        io_tasks_by_collocation[collocation_index].emplace_back(
+            collocation_index,
+            std::move(object_request),
+            container,
+            batch_context,
+            index);
+    }
+
+    for (std::uint16_t collocation_index = 0u; collocation_index < io_tasks_by_collocation.size(); ++collocation_index)
+    {
+        std::vector<object_io_task>& io_tasks = io_tasks_by_collocation[collocation_index];
+
+        if (io_tasks.empty())
+        {
+            continue;
+        }
+
+        threading_context& threading_context =
+            threading_context_provider_.get_context_by_collocation(collocation_index);
+        io_dispatcher_interface& io_dispatcher = optype == schemas::object_request_optype::get ?
+            threading_context.get_read_io_dispatcher() :
+            threading_context.get_write_io_dispatcher();
+
+        //
+        // The objects of a collocation are admitted as a group. If its IO queue is
+        // at capacity, only those objects fail, and the rest of the batch goes through.
+        //
+        std::uint64_t io_tasks_size_bytes = 0u;
+        for (const object_io_task& io_task : io_tasks)
+        {
+            io_tasks_size_bytes += write_io_dispatcher::get_write_io_task_size_bytes(io_task.object_request_);
+        }
+
+        const status::status_code status = io_dispatcher.try_admit_io_tasks(
+            io_tasks.size(),
+            io_tasks_size_bytes);
+
+        if (status::failed(status))
+        {
+            for (object_io_task& io_task : io_tasks)
+            {
+                io_task.complete(status);
+            }
+
+            continue;
+        }
+
+        io_dispatcher.enqueue_io_tasks(
+            std::move(io_tasks));
+    }
+
+    TRACE_LOG(info, "Object batch operation enqueued. "
+        "Optype={}, "
+        "ObjectContainerName={}, "
+        "NumberObjects={}.",
+        static_cast<std::uint8_t>(optype),
+        object_batch_request.get_container_name(),
+        object_requests.size());
+}
+
+status::status_code
+object_management_service::validate_container_scan_request(
+    const schemas::container_scan_request& container_scan_request,
+    std::string& start_after_object_id)
+{
+    status::status_code status = common::request_validations::validate_container_name(
+        container_scan_request.get_container_name(),
+        storage_configuration_);
+
+    if (status::failed(status))
+    {
+        //
+        // Given object container name is invalid.
+        // Not logging the parameters as to avoid potential
+        // large-buffer attacks in case the parameters are too big.
+        //
+        TRACE_LOG(error, "Container scan will be failed as the "
+            "object container name is invalid. "
+            "ObjectContainerNameSizeInBytes={}, "
+            "ObjectContainerNameMaxSizeInBytes={}, "
+            "Status={:#x}.",
+            container_scan_request.get_container_name().size(),
+            storage_configuration_.max_container_name_size_bytes_,
+            status);
+
+        return status;
+    }
+
+    //
+    // A token can never encode an object ID larger than the maximum allowed,
+    // as it is always derived from an object previously returned to a client.
+    //
+    const std::string& continuation_token = container_scan_request.get_continuation_token();
+
+    if (continuation_token.size() > storage_configuration_.max_object_id_size_bytes_ * 2u ||
+        !container_cursor::decode_continuation_token(continuation_token, start_after_object_id))
+    {
+        TRACE_LOG(error, "Container scan will be failed as the "
+            "continuation token is malformed. "
+            "ObjectContainerName={}, "
+            "ContinuationTokenSizeInBytes={}.",
+            container_scan_request.get_container_name(),
+            continuation_token.size());
+
+        return status::invalid_continuation_token;
+    }
+
+    return status::success;
+}
+
+void
+object_management_service::orchestrate_concurrent_container_scan(
+    std::string&& start_after_object_id,
+    const std::uint32_t max_number_objects,
+    std::shared_ptr<container> container,
+    network::server_response_stream&& response_stream)
+{
+    //
+    // Pages which do not specify a size, or ask for more
+    // than the configured maximum, are capped to the maximum.
+    //
+    const std::uint32_t page_max_number_objects = max_number_objects == 0u ?
+        storage_configuration_.container_scan_max_number_objects_ :
+        std::min(max_number_objects, storage_configuration_.container_scan_max_number_objects_);
+
+    //
+    // Scans are served by the read IO thread pool so the network threads never
+    // block on the storage engine. Scans on different object containers spread
+    // across the worker queues; idle workers steal them when the load is skewed.
+    //
+    const std::string container_name = container->get_name();
+    const std::uint32_t affinity_hint = static_cast<std::uint32_t>(
+        std::hash<std::string>{}(container_name));
+
+    const bool is_posted = threading_context_provider_.get_read_io_thread_pool().post(
+        [this,
+         start_after_object_id = std::move(start_after_object_id),
+         page_max_number_objects,
+         container = std::move(container),
+         response_stream = std::move(response_stream)]() mutable
+        {
+            execute_container_scan(
+                start_after_object_id,
+                page_max_number_objects,
+                *container,
+                response_stream);
+
+            response_stream->close();
+        },
+        affinity_hint);
+
+    if (!is_posted)
+    {
+        //
+        // The response stream is closed as the rejected task is destroyed.
+        //
+        TRACE_LOG(error, "Failed to schedule the container scan "
+            "as the read IO thread pool was already stopped. "
+            "ObjectContainerName={}.",
+            container_name);
+    }
+}
+
+void
+object_management_service::execute_container_scan(
+    const std::string& start_after_object_id,
+    const std::uint32_t max_number_objects,
+    container& container,
+    network::server_response_stream& response_stream)
+{
+    const std::string container_name = container.get_name();
+    status::status_code status = status::success;
+
+    //
+    // Open one iterator per collocation of the object container.
+    // The cursor is destroyed at the end of this scope, while the
+    // caller still holds the ref-counted object container reference.
+    //
+    std::vector<std::unique_ptr<storage_engine_iterator>> object_iterators;
+    for (const container_instance& container_instance : container.get_container_instances())
+    {
+        std::unique_ptr<storage_engine_iterator> object_iterator;
+        status = container_instance.storage_engine_.create_object_iterator(
+            container_instance.storage_engine_reference_,
+            &object_iterator);
+
+        if (status::failed(status))
+        {
+            TRACE_LOG(error, "Failed to create the object iterator for container scan. "
+                "ObjectContainerName={}, "
+                "CollocationIndex={}, "
+                "Status={:#x}.",
+                container_name,
+                container_instance.collocation_index_,
+                status);
+
+            break;
+        }
+
+        object_iterators.emplace_back(std::move(object_iterator));
+    }
+
+    container_cursor cursor{std::move(object_iterators)};
+
+    if (status::succeeded(status))
+    {
+        status = cursor.seek(start_after_object_id);
+    }
+
+    //
+    // The page is written incrementally and flushed in chunks,
+    // so only a bounded part of it is ever buffered in memory.
+    //
+    std::string page_buffer;
+    page_buffer.reserve(k_container_scan_chunk_size_bytes + storage_configuration_.max_object_data_size_bytes_);
+    page_buffer += "{\"objects\":[";
+
+    std::string last_object_id;
+    std::uint32_t number_objects = 0u;
+    std::uint64_t page_size_bytes = 0u;
+
+    while (status::succeeded(status) &&
+        cursor.is_valid() &&
+        number_objects < max_number_objects &&
+        page_size_bytes < storage_configuration_.container_scan_max_page_size_bytes_)
+    {
+        const std::string_view object_id = cursor.get_object_id();
+        const std::string_view object_data = cursor.get_object_data();
+
+        if (number_objects > 0u)
+        {
+            page_buffer += ',';
+        }
+
+        const std::size_t object_entry_offset = page_buffer.size();
+        page_buffer += "{\"object_id\":";
+        bool is_object_representable = common::response_utilities::append_json_string(page_buffer, object_id);
+
+        if (is_object_representable)
+        {
+            page_buffer += ",\"object_data\":";
+            is_object_representable = common::response_utilities::append_json_string(page_buffer, object_data);
+        }
+
+        if (is_object_representable)
+        {
+            page_buffer += '}';
+        }
+        else
+        {
+            //
+            // Objects stored over the binary transport may not be valid UTF-8.
+            // They are listed with a failure status rather than altered, so the
+            // client can get them over the binary transport; the object id is
+            // omitted as well when it cannot be represented either.
+            //
+            page_buffer.resize(object_entry_offset);
+
+            if (!common::response_utilities::append_server_json_response(
+                page_buffer,
+                status::object_data_not_json_representable,
+                {{schemas::object_request::object_id_key_tag, object_id}}))
+            {
+                common::response_utilities::append_server_json_response(
+                    page_buffer,
+                    status::object_data_not_json_representable);
+            }
+        }
+
+        last_object_id.assign(object_id);
+        ++number_objects;
+        page_size_bytes += object_id.size() + object_data.size();
+
+        if (page_buffer.size() >= k_container_scan_chunk_size_bytes)
+        {
+            if (!response_stream->send(page_buffer))
+            {
+                //
+                // The client went away. There is no one left to resume the scan.
+                //
+                TRACE_LOG(warn, "Container scan aborted as the client connection was closed. "
+                    "ObjectContainerName={}, "
+                    "NumberObjects={}.",
+                    container_name,
+                    number_objects);
+
+                return;
+            }
+
+            page_buffer.clear();
+        }
+
+        status = cursor.next();
+    }
+
+    //
+    // More objects remain if the page budget was consumed with the cursor still
+    // valid, or if the scan failed midway; in both cases the client resumes after
+    // the last object it received. An empty token signals that the scan is complete.
+    //
+    std::string continuation_token;
+
+    if (status::failed(status) ||
+        cursor.is_valid())
+    {
+        continuation_token = container_cursor::encode_continuation_token(
+            last_object_id.empty() ? start_after_object_id : last_object_id);
+    }
+
+    //
+    // The status is emitted last, as only then is the outcome of the page known.
+    //
+    page_buffer += "],\"";
+    page_buffer += schemas::container_scan_request::continuation_token_key_tag;
+    page_buffer += "\":\"";
+    page_buffer += continuation_token;
+    page_buffer += "\",\"internal_status_code\":\"";
+    page_buffer += status.get_internal_status_code_string();
+    page_buffer += "\"}";
+    response_stream->send(page_buffer);
+
+    TRACE_LOG(info, "Container scan page completed. "
+        "ObjectContainerName={}, "
+        "NumberObjects={}, "
+        "PageSizeInBytes={}, "
+        "IsScanComplete={}, "
+        "Status={:#x}.",
+        container_name,
+        number_objects,
+        page_size_bytes,
+        continuation_token.empty(),
+        status);
+}
+
+shared_byte_stream
 object_management_service::get_object_from_frontline_cache(
     const std::string& object_id,
     const std::string& container_name)
@@ -258,6 +779,16 @@ object_management_service::get_object_from_frontline_cache(
         container_name);
 }
 
+bool
+object_management_service::is_object_absent_in_frontline_cache(
+    const std::string& object_id,
+    const std::string& container_name)
+{
+    return frontline_cache_.is_negative(
+        object_id,
+        container_name);
+}
+
 bool
 object_management_service::is_object_operation_optype_valid(
     const schemas::object_request_optype optype)
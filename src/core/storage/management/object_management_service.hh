@@ -17,7 +17,10 @@
 #include <memory>
 #include "../../status/status.hh"
 #include "../storage_configuration.hh"
+#include "inflight_operations_tracker.hh"
 #include "../../schemas/request-interfaces/object_request.hh"
+#include "../../schemas/request-interfaces/object_batch_request.hh"
+#include "../../schemas/request-interfaces/container_scan_request.hh"
 
 namespace pandora
 {
@@ -73,7 +76,8 @@ public:
         network::server_response_callback&& response_callback);
 
     //
-    // Enqueues the concurrent read request to the thread pool if successful.
+    // Enqueues the concurrent read request to the thread pool if successful,
+    // unless the request joins an in-flight read of the same object.
     //
     status::status_code
     orchestrate_concurrent_read_request(
@@ -81,17 +85,86 @@ public:
         std::shared_ptr<container> container,
         network::server_response_callback&& response_callback);
 
+    //
+    // Validates if an object batch request can be executed.
+    // Only the batch-wide parameters are validated; every object
+    // is validated individually once the batch is orchestrated.
+    //
+    status::status_code
+    validate_object_batch_request(
+        const schemas::object_batch_request& object_batch_request);
+
+    //
+    // Splits the objects of the batch by collocation and enqueues them to their
+    // IO dispatchers, so every collocation serves its share within a single write
+    // batch or multi-get in parallel. Objects which fail their validations, or hit the
+    // frontline cache for get operations, are completed without reaching the dispatchers.
+    // The response with the per-object statuses is provided once all objects complete.
+    //
+    void
+    orchestrate_concurrent_batch_request(
+        schemas::object_batch_request&& object_batch_request,
+        std::shared_ptr<container> container,
+        network::server_response_callback&& response_callback);
+
+    //
+    // Validates if a container scan request can be executed.
+    // On success, outputs the object ID to resume the scan after, decoded from the continuation token.
+    //
+    status::status_code
+    validate_container_scan_request(
+        const schemas::container_scan_request& container_scan_request,
+        std::string& start_after_object_id);
+
+    //
+    // Enqueues a container scan page to the read IO thread pool.
+    // The page is streamed back over the response stream as it is read from the storage engine.
+    //
+    void
+    orchestrate_concurrent_container_scan(
+        std::string&& start_after_object_id,
+        const std::uint32_t max_number_objects,
+        std::shared_ptr<container> container,
+        network::server_response_stream&& response_stream);
+
     //
     // Checks if an object is present in the frontline cache for rapid responses
     // without enqueuing a concurrent read operation delegation to the read IO thread pool.
     //
-    std::optional<byte_stream>
+    shared_byte_stream
     get_object_from_frontline_cache(
         const std::string& object_id,
         const std::string& container_name);
 
+    //
+    // Checks if an object is known to be absent by the frontline cache, so the
+    // miss can be answered without enqueuing a read to the read IO thread pool.
+    //
+    bool
+    is_object_absent_in_frontline_cache(
+        const std::string& object_id,
+        const std::string& container_name);
+
 private:
 
+    //
+    // Executes a container scan page on the calling thread.
+    // Streams the objects in key order until the page budget is consumed,
+    // and terminates the page with the continuation token and the final status.
+    //
+    void
+    execute_container_scan(
+        const std::string& start_after_object_id,
+        const std::uint32_t max_number_objects,
+        container& container,
+        network::server_response_stream& response_stream);
+
+    //
+    // Size in bytes at which the buffered part of a
+    // container scan page is flushed over the response stream.
+    //
+    static constexpr std::size_t k_container_scan_chunk_size_bytes = 64u * 1'024u;
+
     //
     // Validates the object request parameters.
     //
@@ -147,6 +220,11 @@ private:
     // Collocation resolver handle.
     //
     collocation_resolver& collocation_resolver_;
+
+    //
+    // Tracker of the in-flight object reads, shared by concurrent cache misses of an object.
+    //
+    inflight_operations_tracker inflight_operations_tracker_;
 };
 
 } // namespace storage.
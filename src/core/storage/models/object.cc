@@ -26,11 +26,24 @@ object::object(
       container_name_{std::move(container_name)}
 {}
 
+object::object(
+    std::string&& object_id,
+    std::string_view object_data,
+    std::shared_ptr<const void> object_data_keepalive,
+    std::string&& container_name)
+    : object_id_{std::move(object_id)},
+      container_name_{std::move(container_name)},
+      borrowed_object_data_{object_data},
+      object_data_keepalive_{std::move(object_data_keepalive)}
+{}
+
 object::object(
     object&& other)
     : object_id_{std::move(other.object_id_)},
       object_data_{std::move(other.object_data_)},
-      container_name_{std::move(other.container_name_)}
+      container_name_{std::move(other.container_name_)},
+      borrowed_object_data_{other.borrowed_object_data_},
+      object_data_keepalive_{std::move(other.object_data_keepalive_)}
 {}
 
 std::string&
@@ -39,10 +52,27 @@ object::get_object_id()
     return object_id_;
 }
 
-byte_stream&
-object::get_object_data()
+std::string_view
+object::get_object_data() const
 {
-    return object_data_;
+    //
+    // The view over owned data is always taken on demand,
+    // as moving the owning buffer may relocate small strings.
+    //
+    return object_data_keepalive_ != nullptr ?
+        borrowed_object_data_ :
+        std::string_view{object_data_};
+}
+
+byte_stream
+object::take_object_data()
+{
+    if (object_data_keepalive_ != nullptr)
+    {
+        return byte_stream{borrowed_object_data_};
+    }
+
+    return std::move(object_data_);
 }
 
 std::string&
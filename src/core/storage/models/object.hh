@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <memory>
+#include <string_view>
 #include "../../common/aliases.hh"
 
 namespace pandora::storage
@@ -31,6 +33,17 @@ public:
         byte_stream&& object_data,
         std::string&& container_name);
 
+    //
+    // Constructor for an object whose data is borrowed from a buffer owned elsewhere,
+    // such as the network request body. The keepalive holds the owner of the buffer
+    // for as long as the object lives, so the data does not need to be copied.
+    //
+    object(
+        std::string&& object_id,
+        std::string_view object_data,
+        std::shared_ptr<const void> object_data_keepalive,
+        std::string&& container_name);
+
     //
     // Move constructor.
     //
@@ -44,10 +57,17 @@ public:
     get_object_id();
 
     //
-    // Returns an immutable reference to the data stream.
+    // Returns a view over the data stream, either owned or borrowed.
     //
-    byte_stream&
-    get_object_data();
+    std::string_view
+    get_object_data() const;
+
+    //
+    // Takes the data stream out of the object. Owned data is moved out,
+    // while borrowed data is copied, as its buffer only lives as long as the object.
+    //
+    byte_stream
+    take_object_data();
 
     //
     // Returns an immutable reference to the associated container name.
@@ -71,6 +91,16 @@ private:
     // Owning buffer for the associated container name.
     //
     std::string container_name_;
+
+    //
+    // Borrowed data stream. Only used while the keepalive is held.
+    //
+    std::string_view borrowed_object_data_;
+
+    //
+    // Owner of the borrowed data stream buffer, if any.
+    //
+    std::shared_ptr<const void> object_data_keepalive_;
 };
 
 } // namespace pandora::storage.
\ No newline at end of file
@@ -0,0 +1,125 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'object_batch_context.cc'
+// Author: jcjuarez
+// Description:
+//      Shared completion state for the object
+//      IO tasks of a batch request.
+// ****************************************************
+
+#include "object_batch_context.hh"
+#include "../../network/server/server.hh"
+#include "../../common/response_utilities.hh"
+#include "../../schemas/request-interfaces/object_request.hh"
+#include "../../schemas/request-interfaces/object_batch_request.hh"
+
+namespace pandora::storage
+{
+
+object_batch_context::object_batch_context(
+    const std::size_t number_objects,
+    const bool includes_object_data,
+    network::server_response_callback&& response_callback)
+    : statuses_(number_objects, status::success),
+      objects_data_(includes_object_data ? number_objects : 0u),
+      number_pending_objects_{number_objects},
+      response_callback_{std::move(response_callback)}
+{}
+
+void
+object_batch_context::complete_object(
+    const std::size_t object_index,
+    const status::status_code status,
+    std::optional<std::string_view> object_data)
+{
+    statuses_[object_index] = status;
+
+    if (object_data.has_value() &&
+        !objects_data_.empty())
+    {
+        objects_data_[object_index].assign(*object_data);
+    }
+
+    //
+    // Every object owns its own slot, so only the completion count is shared.
+    // The release-acquire ordering makes all slots visible to the last completion.
+    //
+    if (number_pending_objects_.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+    {
+        send_batch_response();
+    }
+}
+
+void
+object_batch_context::send_batch_response()
+{
+    //
+    // The response is sized upfront for the status of every object plus their data.
+    //
+    constexpr std::size_t k_object_response_overhead_bytes = 64u;
+    std::size_t response_size_bytes = (statuses_.size() + 1u) * k_object_response_overhead_bytes;
+
+    for (const byte_stream& object_data : objects_data_)
+    {
+        response_size_bytes += object_data.size();
+    }
+
+    //
+    // The batch itself succeeded once all of its objects were processed;
+    // the outcome of every object is carried by its own status.
+    //
+    std::string response_body;
+    response_body.reserve(response_size_bytes);
+    response_body += "{\"internal_status_code\":\"";
+    response_body += status::success.get_internal_status_code_string();
+    response_body += "\",\"";
+    response_body += schemas::object_batch_request::objects_key_tag;
+    response_body += "\":[";
+
+    for (std::size_t index = 0u; index < statuses_.size(); ++index)
+    {
+        if (index > 0u)
+        {
+            response_body += ',';
+        }
+
+        if (!objects_data_.empty() &&
+            status::succeeded(statuses_[index]))
+        {
+            //
+            // Object data which is not valid UTF-8 fails its own object
+            // rather than being altered to fit in the JSON response.
+            //
+            if (!common::response_utilities::append_server_json_response(
+                response_body,
+                statuses_[index],
+                {{schemas::object_request::object_data_key_tag, objects_data_[index]}}))
+            {
+                common::response_utilities::append_server_json_response(
+                    response_body,
+                    status::object_data_not_json_representable);
+            }
+
+            continue;
+        }
+
+        common::response_utilities::append_server_json_response(
+            response_body,
+            statuses_[index]);
+    }
+
+    response_body += "]}";
+
+    network::server::send_json_response(
+        response_callback_,
+        status::success,
+        std::move(response_body));
+}
+
+} // namespace pandora::storage.
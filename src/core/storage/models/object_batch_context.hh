@@ -0,0 +1,85 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Storage
+// 'object_batch_context.hh'
+// Author: jcjuarez
+// Description:
+//      Shared completion state for the object
+//      IO tasks of a batch request.
+// ****************************************************
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include "../../status/status.hh"
+#include "../../common/aliases.hh"
+
+namespace pandora::storage
+{
+
+//
+// Collects the outcome of every object of a batch request, which may complete
+// on different IO threads, and replies to the client once the last one completes.
+//
+class object_batch_context
+{
+public:
+
+    //
+    // Constructor.
+    // The object data is only collected and returned for batches of get operations.
+    //
+    object_batch_context(
+        const std::size_t number_objects,
+        const bool includes_object_data,
+        network::server_response_callback&& response_callback);
+
+    //
+    // Completes an object of the batch with its final status, and its data for get operations.
+    // Every object index must be completed exactly once. This is a thread-safe operation.
+    //
+    void
+    complete_object(
+        const std::size_t object_index,
+        const status::status_code status,
+        std::optional<std::string_view> object_data = std::nullopt);
+
+private:
+
+    //
+    // Sends the per-object statuses back to the client, in the order of the request.
+    //
+    void
+    send_batch_response();
+
+    //
+    // Final status for every object of the batch.
+    //
+    std::vector<status::status_code> statuses_;
+
+    //
+    // Retrieved data for every object of the batch. Empty for write batches.
+    //
+    std::vector<byte_stream> objects_data_;
+
+    //
+    // Number of objects of the batch which have not completed yet.
+    //
+    std::atomic<std::size_t> number_pending_objects_;
+
+    //
+    // Callback on which to provide the response for the whole batch.
+    //
+    network::server_response_callback response_callback_;
+};
+
+} // namespace pandora::storage.
@@ -15,6 +15,10 @@
 // ****************************************************
 
 #include "object_io_task.hh"
+#include "object_batch_context.hh"
+#include "../management/inflight_operations_tracker.hh"
+#include "../../metrics/metrics_registry.hh"
+#include "../../network/server/server.hh"
 
 namespace pandora::storage
 {
@@ -28,7 +32,30 @@ object_io_task::object_io_task(
       object_request_{std::move(object_request)},
       container_{std::move(container)},
       response_callback_{std::move(response_callback)},
-      id_{common::generate_uuid()}
+      batch_context_{nullptr},
+      batch_index_{0u},
+      inflight_read_{nullptr},
+      creation_time_{std::chrono::steady_clock::now()},
+      deadline_{object_request_.get_deadline()},
+      id_{logger::context::get_request_id()}
+{}
+
+object_io_task::object_io_task(
+    const std::uint16_t collocation_index,
+    schemas::object_request&& object_request,
+    std::shared_ptr<container> container,
+    std::shared_ptr<object_batch_context> batch_context,
+    const std::size_t batch_index)
+    : collocation_index_{collocation_index},
+      object_request_{std::move(object_request)},
+      container_{std::move(container)},
+      response_callback_{nullptr},
+      batch_context_{std::move(batch_context)},
+      batch_index_{batch_index},
+      inflight_read_{nullptr},
+      creation_time_{std::chrono::steady_clock::now()},
+      deadline_{object_request_.get_deadline()},
+      id_{logger::context::get_request_id()}
 {}
 
 object_io_task::object_io_task(
@@ -37,7 +64,66 @@ object_io_task::object_io_task(
       object_request_{std::move(other.object_request_)},
       container_{std::move(other.container_)},
       response_callback_{std::move(other.response_callback_)},
-      id_{std::move(other.id_)}
+      batch_context_{std::move(other.batch_context_)},
+      batch_index_{other.batch_index_},
+      inflight_read_{std::move(other.inflight_read_)},
+      creation_time_{other.creation_time_},
+      deadline_{other.deadline_},
+      id_{other.id_}
 {}
 
+void
+object_io_task::complete(
+    const status::status_code status,
+    std::optional<std::string_view> object_data)
+{
+    //
+    // Operations reaching an IO task either bypass the frontline cache or missed it.
+    //
+    metrics::metrics_registry::record_object_operation(
+        object_request_.get_optype(),
+        object_request_.get_optype() == schemas::object_request_optype::get ?
+            metrics::cache_outcome::miss :
+            metrics::cache_outcome::none,
+        status,
+        object_request_.get_reception_time());
+
+    if (batch_context_ != nullptr)
+    {
+        batch_context_->complete_object(
+            batch_index_,
+            status,
+            object_data);
+
+        return;
+    }
+
+    //
+    // The object data is only part of the response for successful get operations.
+    //
+    network::server::send_object_response(
+        response_callback_,
+        status,
+        object_request_.is_binary_transport(),
+        status::succeeded(status) ? object_data : std::nullopt);
+
+    //
+    // Reply with the same outcome to the clients which joined the read of the object.
+    //
+    if (inflight_read_ != nullptr)
+    {
+        inflight_read_->complete(
+            status,
+            object_data);
+    }
+}
+
+bool
+object_io_task::is_expired(
+    const std::chrono::steady_clock::time_point now)
+{
+    return now >= deadline_ &&
+        (inflight_read_ == nullptr || inflight_read_->try_expire(now));
+}
+
 } // namespace pandora::storage.
\ No newline at end of file
@@ -16,14 +16,22 @@
 
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string_view>
 #include "container.hh"
+#include "../../status/status.hh"
 #include "../../common/aliases.hh"
-#include "../../common/uuid_utilities.hh"
+#include "../../logger/logging.hh"
 #include "../../schemas/request-interfaces/object_request.hh"
 
 namespace pandora::storage
 {
 
+class inflight_read;
+class object_batch_context;
+
 class object_io_task
 {
 public:
@@ -37,12 +45,42 @@ public:
         std::shared_ptr<container> container,
         network::server_response_callback&& response_callback);
 
+    //
+    // Constructor for an object of a batch request.
+    // The outcome is reported to the batch instead of directly to the client.
+    //
+    object_io_task(
+        const std::uint16_t collocation_index,
+        schemas::object_request&& object_request,
+        std::shared_ptr<container> container,
+        std::shared_ptr<object_batch_context> batch_context,
+        const std::size_t batch_index);
+
     //
     // Move constructor.
     //
     object_io_task(
         object_io_task&& other);
 
+    //
+    // Completes the operation with its final status, and its data for get operations.
+    // Replies to the client for single object requests, or reports to the batch otherwise.
+    //
+    void
+    complete(
+        const status::status_code status,
+        std::optional<std::string_view> object_data = std::nullopt);
+
+    //
+    // Checks whether the deadline of the operation has passed at the given time.
+    // Expired tasks are dropped by the IO dispatchers instead of being executed.
+    // A shared read only expires once every joined client has stopped waiting,
+    // and is then closed, so clients arriving afterwards start a new read.
+    //
+    bool
+    is_expired(
+        const std::chrono::steady_clock::time_point now);
+
     //
     // Contains the data for the object request.
     //
@@ -59,18 +97,47 @@ public:
     //
     network::server_response_callback response_callback_;
 
+    //
+    // Batch the task belongs to, if any.
+    //
+    std::shared_ptr<object_batch_context> batch_context_;
+
+    //
+    // Position of the object within its batch.
+    //
+    std::size_t batch_index_;
+
+    //
+    // Shared read of the object that concurrent cache misses joined, if any.
+    // Completed right after the task, so every joined client gets the same outcome.
+    //
+    std::shared_ptr<inflight_read> inflight_read_;
+
     //
     // Represents the collocation index corresponding for the operation.
     //
     const std::uint16_t collocation_index_;
 
+    //
+    // Time at which the task was created, right before being enqueued.
+    // Used for measuring the queue wait. The latency of the operation
+    // is measured from the reception of its request instead.
+    //
+    const std::chrono::steady_clock::time_point creation_time_;
+
+    //
+    // Time after which the client no longer waits for the outcome of the operation.
+    // Taken from the object request, and never reached if the client gave no deadline.
+    //
+    const std::chrono::steady_clock::time_point deadline_;
+
 private:
 
     //
-    // Unique ID for the object task.
-    // Generated upon construction.
+    // ID of the request which originated the object task.
+    // Taken from the logging context of the server thread upon construction.
     //
-    const boost::uuids::uuid id_;
+    const logger::request_id id_;
 };
 
 } // namespace pandora::storage.
\ No newline at end of file
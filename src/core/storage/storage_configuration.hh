@@ -19,6 +19,8 @@
 #include <thread>
 #include <cstdlib>
 #include <stdexcept>
+#include "cache/cache_eviction_policy.hh"
+#include "io/storage_engine_statistics.hh"
 
 namespace pandora
 {
@@ -40,13 +42,32 @@ struct storage_configuration
           max_object_id_size_bytes_{1'024u},
           max_object_data_size_bytes_{1'024u * 1'024u},
           max_number_containers_{10'000},
+          number_collocations_{8u},
           number_write_io_threads_{4u},
           number_read_io_threads_{std::thread::hardware_concurrency()},
           storage_engine_block_cache_size_mib_{512u},
+          storage_engine_hyper_clock_cache_enabled_{false},
+          storage_engine_write_buffer_manager_size_mib_{256u},
+          storage_engine_statistics_level_{storage_engine_statistics_level::except_detailed_timers},
+          storage_engine_number_background_threads_{std::thread::hardware_concurrency()},
           container_index_number_buckets_{8u},
           number_frontline_cache_shards_{8u},
           max_frontline_cache_shard_size_mib_{64u},
-          max_frontline_cache_shard_object_size_bytes{10 * 1'024u}
+          max_frontline_cache_shard_object_size_bytes{10 * 1'024u},
+          frontline_cache_eviction_policy_{cache_eviction_policy::lru},
+          frontline_cache_admission_enabled_{true},
+          frontline_cache_max_number_negative_entries_{0u},
+          frontline_cache_negative_entry_ttl_ms_{1'000u},
+          write_io_batch_max_number_tasks_{128u},
+          write_io_batch_max_size_bytes_{16u * 1'024u * 1'024u},
+          write_io_batch_max_wait_time_us_{0u},
+          write_io_queue_max_number_tasks_{65'536u},
+          write_io_queue_max_size_bytes_{256u * 1'024u * 1'024u},
+          read_io_batch_max_number_tasks_{32u},
+          read_io_batch_max_wait_time_us_{0u},
+          container_scan_max_number_objects_{1'000u},
+          container_scan_max_page_size_bytes_{4u * 1'024u * 1'024u},
+          max_number_objects_per_batch_{1'000u}
     {
         //
         // Set the core key-value store path with the default home directory path.
@@ -94,6 +115,13 @@ struct storage_configuration
     //
     std::uint32_t max_number_containers_;
 
+    //
+    // Number of collocations, each with its own data partition and write IO dispatcher thread.
+    // Must match the topology the data store was created with, as keys are routed
+    // to data partitions by this number. Changing it requires resharding the data store offline.
+    //
+    std::uint16_t number_collocations_;
+
     //
     // Number of threads for the write IO dispatcher thread pool.
     // Should ideally be a low number as to avoid oversubscribing the storage engine.
@@ -101,17 +129,44 @@ struct storage_configuration
     std::uint32_t number_write_io_threads_;
 
     //
-    // Number of threads for the read IO dispatcher thread pool.
+    // Number of threads for the read IO thread pool shared by all collocations.
     // The engine allows efficient retrieval with high concurrency,
-    // so the total number of logical cores is ideal.
+    // so the total number of logical cores is ideal. Capped to that number.
     //
     std::uint32_t number_read_io_threads_;
 
     //
     // Storage engine block cache size in MiB.
+    // The block cache is shared by all data partitions, so this is the total size for the process.
     //
     std::uint64_t storage_engine_block_cache_size_mib_;
 
+    //
+    // Whether the shared storage engine block cache uses the HyperClock implementation
+    // instead of the sharded LRU one. HyperClock lookups are lock-free, which scales better
+    // with highly concurrent reads at the cost of a less precise recency order.
+    //
+    bool storage_engine_hyper_clock_cache_enabled_;
+
+    //
+    // Total memtable memory in MiB for all data partitions.
+    // Memtable memory is charged against the shared block cache.
+    //
+    std::uint64_t storage_engine_write_buffer_manager_size_mib_;
+
+    //
+    // Level of the statistics collected by every data partition storage engine.
+    // Statistics are exposed through the administration endpoint.
+    //
+    storage_engine_statistics_level storage_engine_statistics_level_;
+
+    //
+    // Number of background threads for the storage engine flushes and
+    // compactions, shared by all data partitions. A quarter of them run flushes.
+    // Each partition may run its share of them as concurrent background jobs.
+    //
+    std::uint32_t storage_engine_number_background_threads_;
+
     //
     // Number of buckets for the container index.
     //
@@ -128,9 +183,97 @@ struct storage_configuration
     std::uint32_t max_frontline_cache_shard_size_mib_;
 
     //
-    // Maximum size for object entries inside each frontline cache shard instance.
+    // Maximum size for object entries inside each frontline cache shard instance,
+    // accounting for both the key and the object data.
     //
     std::uint32_t max_frontline_cache_shard_object_size_bytes;
+
+    //
+    // Eviction policy for the frontline cache shards.
+    // CLOCK allows cache hits to proceed concurrently under a shared lock.
+    //
+    cache_eviction_policy frontline_cache_eviction_policy_;
+
+    //
+    // Whether new objects go through the frequency-based admission filter of the frontline cache.
+    // When enabled, a new object is only admitted over an eviction victim that is accessed less often.
+    //
+    bool frontline_cache_admission_enabled_;
+
+    //
+    // Maximum number of negative entries for objects found absent in the storage engine
+    // inside each frontline cache shard instance. Zero disables negative caching.
+    //
+    std::uint32_t frontline_cache_max_number_negative_entries_;
+
+    //
+    // Time to live of the frontline cache negative entries in milliseconds.
+    // Writes invalidate the negative entry of their object, so this only
+    // bounds how long objects written outside of the server are reported absent.
+    //
+    std::uint32_t frontline_cache_negative_entry_ttl_ms_;
+
+    //
+    // Maximum number of write IO tasks to be group-committed
+    // by a write IO dispatcher into a single storage engine write batch.
+    //
+    std::uint32_t write_io_batch_max_number_tasks_;
+
+    //
+    // Maximum size in bytes of the write IO tasks group-committed by a write IO dispatcher
+    // into a single storage engine write batch. A task larger than it is committed alone.
+    //
+    std::uint64_t write_io_batch_max_size_bytes_;
+
+    //
+    // Maximum time in microseconds a write IO dispatcher waits for more tasks
+    // to arrive before committing a write batch. A value of zero only groups the
+    // tasks that accumulated while the previous write batch was being committed.
+    //
+    std::uint32_t write_io_batch_max_wait_time_us_;
+
+    //
+    // Maximum number of write IO tasks admitted into the queue of a write IO dispatcher
+    // and not yet completed. Further write operations on the collocation are rejected
+    // with a retryable status until the queue drains. A value of zero disables the limit.
+    //
+    std::uint32_t write_io_queue_max_number_tasks_;
+
+    //
+    // Maximum number of object ID and object data bytes held by the admitted and not yet
+    // completed write IO tasks of a write IO dispatcher. A value of zero disables the limit.
+    //
+    std::uint64_t write_io_queue_max_size_bytes_;
+
+    //
+    // Maximum number of pending read IO tasks of a collocation
+    // to be coalesced into a single storage engine multi-get.
+    //
+    std::uint32_t read_io_batch_max_number_tasks_;
+
+    //
+    // Maximum time in microseconds a read IO drain waits for more tasks of its
+    // collocation to arrive before issuing a multi-get. A value of zero only coalesces
+    // the tasks that accumulated while the drain was waiting for a read IO thread.
+    //
+    std::uint32_t read_io_batch_max_wait_time_us_;
+
+    //
+    // Maximum number of objects returned in a single container scan page.
+    // Client requests asking for more objects are capped to this value.
+    //
+    std::uint32_t container_scan_max_number_objects_;
+
+    //
+    // Maximum number of object bytes returned in a single container scan page.
+    // A page is closed with a continuation token once this budget is exceeded.
+    //
+    std::uint64_t container_scan_max_page_size_bytes_;
+
+    //
+    // Maximum number of objects accepted in a single batch request.
+    //
+    std::uint32_t max_number_objects_per_batch_;
 };
 
 } // namespace storage.
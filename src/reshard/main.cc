@@ -0,0 +1,22 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Reshard
+// 'main.cc'
+// Author: jcjuarez
+// Description:
+//      PandoraDB offline resharding entry point.
+//      Usage: pandora_reshard [config_file_path]
+// ****************************************************
+
+#include "../core/startup/system_init.hh"
+
+int main(int argc, char** argv)
+{
+   const std::vector<std::string> args(argv, argv + argc);
+   return pandora::init_resharding(args);
+}
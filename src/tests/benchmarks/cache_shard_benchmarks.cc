@@ -0,0 +1,435 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'cache_shard_benchmarks.cc'
+// Author: jcjuarez
+// Description:
+//      Benchmarks for the cache shard component
+//      against the std::map and std::list shard
+//      it replaced.
+// ****************************************************
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <optional>
+#include <benchmark/benchmark.h>
+#include "core/status/status.hh"
+#include "core/storage/cache/cache_shard.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+namespace
+{
+
+//
+// Number of distinct objects resident in the shards under benchmark.
+//
+constexpr std::size_t k_number_resident_objects = 16'384u;
+
+//
+// Size of the object data of every benchmarked object.
+//
+constexpr std::size_t k_object_data_size_bytes = 128u;
+
+//
+// Container name of every benchmarked object.
+//
+const std::string k_container_name = "BenchmarkContainer";
+
+//
+// Cache shard as it was before the flat hash table, kept as the baseline.
+// Keys are duplicated in the map and in the list nodes, every entry takes
+// two allocations and only the object data is accounted for.
+//
+class map_list_cache_shard
+{
+public:
+
+    map_list_cache_shard(
+        const std::size_t max_cache_shard_size_bytes,
+        const std::size_t max_object_size_bytes)
+        : max_cache_shard_size_bytes_{max_cache_shard_size_bytes},
+          max_object_size_bytes_{max_object_size_bytes},
+          current_cache_shard_size_bytes_{0u}
+    {}
+
+    status::status_code
+    put(
+        std::string&& object_id,
+        storage::byte_stream&& object_data,
+        std::string&& container_name)
+    {
+        const std::size_t object_data_size_bytes = object_data.size();
+        if (object_data_size_bytes > max_object_size_bytes_)
+        {
+            return status::object_data_size_exceeds_cache_limit;
+        }
+
+        std::pair<std::string, std::string> object_id_pair = std::make_pair(
+            std::move(container_name),
+            std::move(object_id));
+
+        std::lock_guard<std::mutex> lock {lock_};
+
+        auto map_object_iterator = lru_cache_map_.find(object_id_pair);
+        if (map_object_iterator != lru_cache_map_.end())
+        {
+            current_cache_shard_size_bytes_ -= map_object_iterator->second->second.size();
+            lru_doubly_linked_list_.erase(map_object_iterator->second);
+            lru_cache_map_.erase(map_object_iterator);
+        }
+
+        while ((current_cache_shard_size_bytes_ + object_data_size_bytes) > max_cache_shard_size_bytes_ &&
+               !lru_doubly_linked_list_.empty())
+        {
+            auto& oldest_object_in_list = lru_doubly_linked_list_.back();
+            current_cache_shard_size_bytes_ -= oldest_object_in_list.second.size();
+            lru_cache_map_.erase(oldest_object_in_list.first);
+            lru_doubly_linked_list_.pop_back();
+        }
+
+        lru_doubly_linked_list_.emplace_front(object_id_pair, std::move(object_data));
+        lru_cache_map_.emplace(object_id_pair, lru_doubly_linked_list_.begin());
+        current_cache_shard_size_bytes_ += object_data_size_bytes;
+
+        return status::success;
+    }
+
+    std::optional<storage::byte_stream>
+    get(
+        const std::string& object_id,
+        const std::string& container_name)
+    {
+        std::pair<std::string, std::string> object_id_pair = std::make_pair(
+            container_name,
+            object_id);
+
+        std::lock_guard<std::mutex> lock {lock_};
+
+        auto map_object_iterator = lru_cache_map_.find(object_id_pair);
+        if (map_object_iterator == lru_cache_map_.end())
+        {
+            return std::nullopt;
+        }
+
+        lru_doubly_linked_list_.splice(
+            lru_doubly_linked_list_.begin(),
+            lru_doubly_linked_list_,
+            map_object_iterator->second);
+
+        return std::make_optional<storage::byte_stream>(map_object_iterator->second->second);
+    }
+
+private:
+
+    const std::size_t max_cache_shard_size_bytes_;
+
+    const std::size_t max_object_size_bytes_;
+
+    std::size_t current_cache_shard_size_bytes_;
+
+    std::list<std::pair<std::pair<std::string, std::string>, storage::byte_stream>> lru_doubly_linked_list_;
+
+    std::map<std::pair<std::string, std::string>,
+        std::list<std::pair<std::pair<std::string, std::string>, storage::byte_stream>>::iterator> lru_cache_map_;
+
+    std::mutex lock_;
+};
+
+//
+// Generates the object IDs used across the benchmarks.
+//
+std::vector<std::string>
+generate_object_ids(
+    const std::size_t number_objects)
+{
+    std::vector<std::string> object_ids;
+    object_ids.reserve(number_objects);
+
+    for (std::size_t index = 0u; index < number_objects; ++index)
+    {
+        object_ids.emplace_back("BenchmarkObject" + std::to_string(index));
+    }
+
+    return object_ids;
+}
+
+//
+// Gets the shard size which fits the resident objects, keys included.
+//
+std::size_t
+get_resident_shard_size_bytes()
+{
+    return k_number_resident_objects * (k_container_name.size() + 32u + k_object_data_size_bytes);
+}
+
+//
+// Inserts an object into the current cache shard.
+//
+void
+put_object(
+    storage::cache_shard& shard,
+    const std::string& object_id,
+    const storage::byte_stream& object_data)
+{
+    shard.put(
+        storage::cache_shard::compute_key_hash(object_id, k_container_name),
+        std::string{object_id},
+        std::make_shared<const storage::byte_stream>(object_data),
+        std::string{k_container_name});
+}
+
+//
+// Inserts an object into the baseline cache shard.
+//
+void
+put_object(
+    map_list_cache_shard& shard,
+    const std::string& object_id,
+    const storage::byte_stream& object_data)
+{
+    shard.put(
+        std::string{object_id},
+        storage::byte_stream{object_data},
+        std::string{k_container_name});
+}
+
+//
+// Gets an object from the current cache shard.
+//
+bool
+get_object(
+    storage::cache_shard& shard,
+    const std::string& object_id)
+{
+    return shard.get(
+        storage::cache_shard::compute_key_hash(object_id, k_container_name),
+        object_id,
+        k_container_name) != nullptr;
+}
+
+//
+// Gets an object from the baseline cache shard.
+//
+bool
+get_object(
+    map_list_cache_shard& shard,
+    const std::string& object_id)
+{
+    return shard.get(
+        object_id,
+        k_container_name).has_value();
+}
+
+//
+// Creates a current cache shard with the given eviction policy, sized for the resident objects.
+//
+std::unique_ptr<storage::cache_shard>
+create_cache_shard(
+    const storage::cache_eviction_policy eviction_policy)
+{
+    return std::make_unique<storage::cache_shard>(
+        get_resident_shard_size_bytes(),
+        get_resident_shard_size_bytes(),
+        eviction_policy,
+        false /* admission_enabled */,
+        0u /* max_number_negative_entries */,
+        0u /* negative_entry_ttl_ms */);
+}
+
+//
+// Creates a baseline cache shard, sized for the resident objects.
+//
+std::unique_ptr<map_list_cache_shard>
+create_map_list_cache_shard()
+{
+    return std::make_unique<map_list_cache_shard>(
+        get_resident_shard_size_bytes(),
+        get_resident_shard_size_bytes());
+}
+
+//
+// Gets resident objects in a strided order, so consecutive gets do not hit the same entries.
+//
+template <typename shard_type>
+void
+benchmark_get_hits(
+    benchmark::State& state,
+    shard_type& shard)
+{
+    const std::vector<std::string> object_ids = generate_object_ids(k_number_resident_objects);
+    const storage::byte_stream object_data(k_object_data_size_bytes, 'x');
+
+    for (const std::string& object_id : object_ids)
+    {
+        put_object(shard, object_id, object_data);
+    }
+
+    std::size_t index = 0u;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(get_object(shard, object_ids[index]));
+        index = (index + 7u) % k_number_resident_objects;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+//
+// Inserts twice as many objects as the shard fits, so most puts evict an entry.
+//
+template <typename shard_type>
+void
+benchmark_put_with_eviction(
+    benchmark::State& state,
+    shard_type& shard)
+{
+    const std::vector<std::string> object_ids = generate_object_ids(2u * k_number_resident_objects);
+    const storage::byte_stream object_data(k_object_data_size_bytes, 'x');
+
+    std::size_t index = 0u;
+    for (auto _ : state)
+    {
+        put_object(shard, object_ids[index], object_data);
+        index = (index + 1u) % object_ids.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+//
+// Mixes gets with one put out of every eight operations.
+//
+template <typename shard_type>
+void
+benchmark_mixed_operations(
+    benchmark::State& state,
+    shard_type& shard)
+{
+    const std::vector<std::string> object_ids = generate_object_ids(2u * k_number_resident_objects);
+    const storage::byte_stream object_data(k_object_data_size_bytes, 'x');
+
+    for (std::size_t index = 0u; index < k_number_resident_objects; ++index)
+    {
+        put_object(shard, object_ids[index], object_data);
+    }
+
+    std::size_t index = 0u;
+    for (auto _ : state)
+    {
+        if (index % 8u == 0u)
+        {
+            put_object(shard, object_ids[index], object_data);
+        }
+        else
+        {
+            benchmark::DoNotOptimize(get_object(shard, object_ids[index]));
+        }
+
+        index = (index + 7u) % object_ids.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace.
+
+void
+map_list_shard_get_hits(
+    benchmark::State& state)
+{
+    std::unique_ptr<map_list_cache_shard> shard = create_map_list_cache_shard();
+    benchmark_get_hits(state, *shard);
+}
+
+void
+lru_shard_get_hits(
+    benchmark::State& state)
+{
+    std::unique_ptr<storage::cache_shard> shard = create_cache_shard(storage::cache_eviction_policy::lru);
+    benchmark_get_hits(state, *shard);
+}
+
+void
+clock_shard_get_hits(
+    benchmark::State& state)
+{
+    std::unique_ptr<storage::cache_shard> shard = create_cache_shard(storage::cache_eviction_policy::clock);
+    benchmark_get_hits(state, *shard);
+}
+
+void
+map_list_shard_put_with_eviction(
+    benchmark::State& state)
+{
+    std::unique_ptr<map_list_cache_shard> shard = create_map_list_cache_shard();
+    benchmark_put_with_eviction(state, *shard);
+}
+
+void
+lru_shard_put_with_eviction(
+    benchmark::State& state)
+{
+    std::unique_ptr<storage::cache_shard> shard = create_cache_shard(storage::cache_eviction_policy::lru);
+    benchmark_put_with_eviction(state, *shard);
+}
+
+void
+clock_shard_put_with_eviction(
+    benchmark::State& state)
+{
+    std::unique_ptr<storage::cache_shard> shard = create_cache_shard(storage::cache_eviction_policy::clock);
+    benchmark_put_with_eviction(state, *shard);
+}
+
+void
+map_list_shard_mixed_operations(
+    benchmark::State& state)
+{
+    std::unique_ptr<map_list_cache_shard> shard = create_map_list_cache_shard();
+    benchmark_mixed_operations(state, *shard);
+}
+
+void
+lru_shard_mixed_operations(
+    benchmark::State& state)
+{
+    std::unique_ptr<storage::cache_shard> shard = create_cache_shard(storage::cache_eviction_policy::lru);
+    benchmark_mixed_operations(state, *shard);
+}
+
+void
+clock_shard_mixed_operations(
+    benchmark::State& state)
+{
+    std::unique_ptr<storage::cache_shard> shard = create_cache_shard(storage::cache_eviction_policy::clock);
+    benchmark_mixed_operations(state, *shard);
+}
+
+BENCHMARK(map_list_shard_get_hits);
+BENCHMARK(lru_shard_get_hits);
+BENCHMARK(clock_shard_get_hits);
+BENCHMARK(map_list_shard_put_with_eviction);
+BENCHMARK(lru_shard_put_with_eviction);
+BENCHMARK(clock_shard_put_with_eviction);
+BENCHMARK(map_list_shard_mixed_operations);
+BENCHMARK(lru_shard_mixed_operations);
+BENCHMARK(clock_shard_mixed_operations);
+
+} // namespace tests.
+} // namespace pandora.
+
+BENCHMARK_MAIN();
@@ -41,6 +41,29 @@ public:
         const storage::byte_stream&),
         (override));
 
+    MOCK_METHOD(
+        status::status_code,
+        stage_object_insertion,
+        (storage::storage_engine_write_batch*,
+        storage::storage_engine_reference*,
+        const char*,
+        std::string_view),
+        (override));
+
+    MOCK_METHOD(
+        status::status_code,
+        stage_object_removal,
+        (storage::storage_engine_write_batch*,
+        storage::storage_engine_reference*,
+        const char*),
+        (override));
+
+    MOCK_METHOD(
+        status::status_code,
+        commit_write_batch,
+        (storage::storage_engine_write_batch*),
+        (override));
+
     MOCK_METHOD(
         status::status_code,
         get_object,
@@ -49,6 +72,24 @@ public:
         storage::byte_stream*),
         (override));
 
+    MOCK_METHOD(
+        status::status_code,
+        get_objects,
+        (std::span<storage::storage_engine_reference* const>,
+        std::span<const char* const>,
+        std::span<storage::byte_stream>,
+        std::span<status::status_code>),
+        (override));
+
+    MOCK_METHOD(
+        status::status_code,
+        get_objects_pinned,
+        (std::span<storage::storage_engine_reference* const>,
+        std::span<const char* const>,
+        std::span<storage::pinned_byte_stream>,
+        std::span<status::status_code>),
+        (override));
+
     MOCK_METHOD(
         status::status_code,
         create_container,
@@ -58,9 +99,9 @@ public:
 
     MOCK_METHOD(
         status::status_code,
-        get_all_objects_from_container,
+        create_object_iterator,
         ((storage::storage_engine_reference*),
-        (std::unordered_map<std::string, storage::byte_stream>*)),
+        (std::unique_ptr<storage::storage_engine_iterator>*)),
         (override));
 
     MOCK_METHOD(
@@ -87,6 +128,12 @@ public:
         remove_container,
         (storage::storage_engine_reference * ),
         (override));
+
+    MOCK_METHOD(
+        storage::storage_engine_statistics,
+        get_engine_statistics,
+        (std::span<storage::storage_engine_reference* const>),
+        (override));
 };
 
 } // namespace tests.
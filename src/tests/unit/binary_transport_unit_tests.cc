@@ -0,0 +1,141 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'binary_transport_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the binary transport of
+//      single object requests and responses.
+// ****************************************************
+
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+#include <drogon/drogon.h>
+#include "core/status/status.hh"
+#include "core/network/server/server.hh"
+#include "core/schemas/request-interfaces/object_request.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+//
+// Sends an object response and captures it.
+//
+drogon::HttpResponsePtr
+capture_object_response(
+    const status::status_code& status,
+    const bool is_binary_transport,
+    std::string_view object_data)
+{
+    drogon::HttpResponsePtr captured_response;
+    network::server::send_object_response(
+        [&captured_response](const drogon::HttpResponsePtr& response) { captured_response = response; },
+        status,
+        is_binary_transport,
+        object_data);
+
+    return captured_response;
+}
+
+TEST(
+    binary_transport_unit_tests,
+    binary_request_reads_parameters_out_of_band)
+{
+    //
+    // The object data is arbitrary bytes, including ones which are not valid UTF-8.
+    //
+    const std::string object_data{"a\0\xff" "b", 4u};
+    auto request = drogon::HttpRequest::newHttpRequest();
+    request->setMethod(drogon::Post);
+    request->setContentTypeCode(drogon::CT_APPLICATION_OCTET_STREAM);
+    request->setParameter(schemas::object_request::container_name_key_tag, "Container");
+    request->addHeader(schemas::object_request::object_id_header_tag, "Object");
+    request->setBody(object_data);
+
+    schemas::object_request object_request{request};
+
+    EXPECT_TRUE(object_request.is_binary_transport());
+    EXPECT_EQ(object_request.get_optype(), schemas::object_request_optype::insert);
+    EXPECT_EQ(object_request.get_container_name(), "Container");
+    EXPECT_EQ(object_request.get_object_id(), "Object");
+    EXPECT_EQ(object_request.get_object_data(), object_data);
+}
+
+TEST(
+    binary_transport_unit_tests,
+    query_parameters_take_precedence_over_headers)
+{
+    auto request = drogon::HttpRequest::newHttpRequest();
+    request->setMethod(drogon::Get);
+    request->addHeader("accept", schemas::object_request::binary_transport_media_type);
+    request->setParameter(schemas::object_request::object_id_key_tag, "QueryObject");
+    request->addHeader(schemas::object_request::object_id_header_tag, "HeaderObject");
+    request->addHeader(schemas::object_request::container_name_header_tag, "Container");
+
+    schemas::object_request object_request{request};
+
+    EXPECT_TRUE(object_request.is_binary_transport());
+    EXPECT_EQ(object_request.get_object_id(), "QueryObject");
+    EXPECT_EQ(object_request.get_container_name(), "Container");
+}
+
+TEST(
+    binary_transport_unit_tests,
+    accept_header_selects_the_transport)
+{
+    auto binary_request = drogon::HttpRequest::newHttpRequest();
+    binary_request->setMethod(drogon::Get);
+    binary_request->addHeader("accept", "application/json, application/octet-stream");
+
+    auto json_request = drogon::HttpRequest::newHttpRequest();
+    json_request->setMethod(drogon::Get);
+    json_request->addHeader("accept", "application/json");
+
+    EXPECT_TRUE(schemas::object_request{binary_request}.is_binary_transport());
+    EXPECT_FALSE(schemas::object_request{json_request}.is_binary_transport());
+}
+
+TEST(
+    binary_transport_unit_tests,
+    binary_response_carries_the_raw_object_data)
+{
+    const std::string object_data{"a\0\xff" "b", 4u};
+    const drogon::HttpResponsePtr response = capture_object_response(
+        status::success,
+        true /* is_binary_transport */,
+        object_data);
+
+    ASSERT_NE(response, nullptr);
+    EXPECT_EQ(response->contentType(), drogon::CT_APPLICATION_OCTET_STREAM);
+    EXPECT_EQ(response->getHeader(network::server::internal_status_code_header_tag), "0x0");
+    EXPECT_EQ(std::string{response->getBody()}, object_data);
+}
+
+TEST(
+    binary_transport_unit_tests,
+    json_response_replaces_invalid_utf8)
+{
+    //
+    // A value stored over the binary transport can still be read over the JSON transport.
+    //
+    const drogon::HttpResponsePtr response = capture_object_response(
+        status::success,
+        false /* is_binary_transport */,
+        "a\xff" "b");
+
+    ASSERT_NE(response, nullptr);
+    EXPECT_EQ(
+        std::string{response->getBody()},
+        "{\"internal_status_code\":\"0x0\",\"object_data\":\"a\xef\xbf\xbd" "b\"}");
+}
+
+} // namespace tests.
+} // namespace pandora.
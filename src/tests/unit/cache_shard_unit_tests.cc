@@ -0,0 +1,730 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'cache_shard_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the cache shard component.
+// ****************************************************
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../core/status/status.hh"
+#include "core/storage/cache/cache_shard.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+class cache_shard_unit_tests : public testing::Test
+{
+protected:
+
+    //
+    // Inserts an object into the given cache shard.
+    //
+    static
+    status::status_code
+    put(
+        storage::cache_shard& shard,
+        const std::string& object_id,
+        const std::string& object_data,
+        const std::string& container_name)
+    {
+        return shard.put(
+            storage::cache_shard::compute_key_hash(object_id, container_name),
+            std::string{object_id},
+            std::make_shared<const storage::byte_stream>(object_data),
+            std::string{container_name});
+    }
+
+    //
+    // Fills an object into the given cache shard with the given fill version.
+    //
+    static
+    status::status_code
+    fill(
+        storage::cache_shard& shard,
+        const std::string& object_id,
+        const std::string& object_data,
+        const std::string& container_name,
+        const std::uint64_t fill_version)
+    {
+        return shard.fill(
+            storage::cache_shard::compute_key_hash(object_id, container_name),
+            std::string{object_id},
+            std::make_shared<const storage::byte_stream>(object_data),
+            std::string{container_name},
+            fill_version);
+    }
+
+    //
+    // Gets the current version of an object in the given cache shard.
+    //
+    static
+    std::uint64_t
+    get_version(
+        storage::cache_shard& shard,
+        const std::string& object_id,
+        const std::string& container_name)
+    {
+        return shard.get_version(
+            storage::cache_shard::compute_key_hash(object_id, container_name));
+    }
+
+    //
+    // Records an object as absent in the given cache shard with the given fill version.
+    //
+    static
+    status::status_code
+    fill_negative(
+        storage::cache_shard& shard,
+        const std::string& object_id,
+        const std::string& container_name,
+        const std::uint64_t fill_version,
+        const std::chrono::steady_clock::time_point now)
+    {
+        return shard.fill_negative(
+            storage::cache_shard::compute_key_hash(object_id, container_name),
+            object_id,
+            container_name,
+            fill_version,
+            now);
+    }
+
+    //
+    // Checks whether an object is recorded as absent in the given cache shard.
+    //
+    static
+    bool
+    is_negative(
+        storage::cache_shard& shard,
+        const std::string& object_id,
+        const std::string& container_name,
+        const std::chrono::steady_clock::time_point now)
+    {
+        return shard.is_negative(
+            storage::cache_shard::compute_key_hash(object_id, container_name),
+            object_id,
+            container_name,
+            now);
+    }
+
+    //
+    // Gets an object from the given cache shard.
+    //
+    static
+    storage::shared_byte_stream
+    get(
+        storage::cache_shard& shard,
+        const std::string& object_id,
+        const std::string& container_name)
+    {
+        return shard.get(
+            storage::cache_shard::compute_key_hash(object_id, container_name),
+            object_id,
+            container_name);
+    }
+};
+
+TEST_F(
+    cache_shard_unit_tests,
+    put_and_get_success)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+    EXPECT_EQ(
+        put(shard, "Object", "Data", "Container"),
+        status::success);
+
+    const storage::shared_byte_stream object_data = get(shard, "Object", "Container");
+    ASSERT_NE(object_data, nullptr);
+    EXPECT_EQ(*object_data, "Data");
+    EXPECT_EQ(get(shard, "MissingObject", "Container"), nullptr);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    same_object_id_across_containers)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+    EXPECT_EQ(
+        put(shard, "Object", "Data1", "Container1"),
+        status::success);
+    EXPECT_EQ(
+        put(shard, "Object", "Data2", "Container2"),
+        status::success);
+
+    //
+    // Keys with the same concatenation but different container boundaries must not collide.
+    //
+    EXPECT_EQ(
+        put(shard, "ainer1Object", "Data3", "Cont"),
+        status::success);
+
+    EXPECT_EQ(*get(shard, "Object", "Container1"), "Data1");
+    EXPECT_EQ(*get(shard, "Object", "Container2"), "Data2");
+    EXPECT_EQ(*get(shard, "ainer1Object", "Cont"), "Data3");
+    EXPECT_EQ(shard.get_number_entries(), 3u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    put_overwrites_existing_object)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+    EXPECT_EQ(
+        put(shard, "Object", "Data", "Container"),
+        status::success);
+    EXPECT_EQ(
+        put(shard, "Object", "LongerData", "Container"),
+        status::success);
+
+    EXPECT_EQ(*get(shard, "Object", "Container"), "LongerData");
+    EXPECT_EQ(shard.get_number_entries(), 1u);
+    EXPECT_EQ(shard.get_size_bytes(), std::string{"ContainerObjectLongerData"}.size());
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    get_shares_buffer_beyond_eviction)
+{
+    storage::cache_shard shard{8u, 8u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+    EXPECT_EQ(put(shard, "O1", "Data", "C1"), status::success);
+
+    //
+    // Hits share the same immutable buffer, which outlives the eviction of its entry.
+    //
+    const storage::shared_byte_stream object_data = get(shard, "O1", "C1");
+    ASSERT_NE(object_data, nullptr);
+    EXPECT_EQ(object_data.get(), get(shard, "O1", "C1").get());
+
+    EXPECT_EQ(put(shard, "O2", "Data", "C1"), status::success);
+    EXPECT_EQ(nullptr, get(shard, "O1", "C1"));
+    EXPECT_EQ(*object_data, "Data");
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    put_object_exceeds_size_limit)
+{
+    storage::cache_shard shard{1'024u, 4u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+    EXPECT_EQ(
+        put(shard, "Object", "LargeData", "Container"),
+        status::object_data_size_exceeds_cache_limit);
+    EXPECT_EQ(get(shard, "Object", "Container"), nullptr);
+    EXPECT_EQ(shard.get_size_bytes(), 0u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    put_key_counts_towards_size_limit)
+{
+    //
+    // The limit applies to the key plus the object data, as accounted for the entry.
+    //
+    storage::cache_shard shard{1'024u, 8u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+    EXPECT_EQ(put(shard, "O1", "Data", "C1"), status::success);
+    EXPECT_EQ(
+        put(shard, "Object", "Data", "Container"),
+        status::object_data_size_exceeds_cache_limit);
+    EXPECT_EQ(get(shard, "Object", "Container"), nullptr);
+    EXPECT_EQ(shard.get_size_bytes(), 8u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    eviction_follows_lru_order)
+{
+    //
+    // Each entry accounts for 4 bytes of key plus 4 bytes
+    // of object data, so the shard fits exactly three entries.
+    //
+    storage::cache_shard shard{24u, 8u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+    EXPECT_EQ(put(shard, "O1", "Data", "C1"), status::success);
+    EXPECT_EQ(put(shard, "O2", "Data", "C1"), status::success);
+    EXPECT_EQ(put(shard, "O3", "Data", "C1"), status::success);
+    EXPECT_EQ(shard.get_size_bytes(), 24u);
+
+    //
+    // Touch the oldest entry so the second one becomes the eviction victim.
+    //
+    EXPECT_NE(nullptr, get(shard, "O1", "C1"));
+    EXPECT_EQ(put(shard, "O4", "Data", "C1"), status::success);
+
+    EXPECT_NE(nullptr, get(shard, "O1", "C1"));
+    EXPECT_EQ(nullptr, get(shard, "O2", "C1"));
+    EXPECT_NE(nullptr, get(shard, "O3", "C1"));
+    EXPECT_NE(nullptr, get(shard, "O4", "C1"));
+    EXPECT_EQ(shard.get_number_entries(), 3u);
+    EXPECT_EQ(shard.get_size_bytes(), 24u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    churn_keeps_table_consistent)
+{
+    //
+    // Insert far more objects than the shard can hold to exercise
+    // table growth, slot deletion and entry reuse under eviction.
+    //
+    constexpr std::size_t k_number_objects = 10'000u;
+    constexpr std::size_t k_number_resident_objects = 64u;
+    const std::size_t entry_size_bytes = std::string{"Container"}.size() + 10u + 8u;
+    storage::cache_shard shard{k_number_resident_objects * entry_size_bytes, entry_size_bytes, storage::cache_eviction_policy::lru, false, 0u, 0u};
+
+    for (std::size_t index = 0u; index < k_number_objects; ++index)
+    {
+        const std::string object_id = std::to_string(1'000'000'000u + index);
+        EXPECT_EQ(
+            put(shard, object_id, "Data" + std::to_string(1'000u + (index % 1'000u)), "Container"),
+            status::success);
+    }
+
+    EXPECT_EQ(shard.get_number_entries(), k_number_resident_objects);
+    EXPECT_EQ(shard.get_size_bytes(), k_number_resident_objects * entry_size_bytes);
+
+    for (std::size_t index = 0u; index < k_number_objects; ++index)
+    {
+        const std::string object_id = std::to_string(1'000'000'000u + index);
+        EXPECT_EQ(
+            get(shard, object_id, "Container") != nullptr,
+            index >= k_number_objects - k_number_resident_objects);
+    }
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    clock_eviction_gives_referenced_entries_second_chance)
+{
+    storage::cache_shard shard{24u, 8u, storage::cache_eviction_policy::clock, false, 0u, 0u};
+    EXPECT_EQ(put(shard, "O1", "Data", "C1"), status::success);
+    EXPECT_EQ(put(shard, "O2", "Data", "C1"), status::success);
+    EXPECT_EQ(put(shard, "O3", "Data", "C1"), status::success);
+
+    //
+    // Reference the oldest entry so the hand skips it and evicts the next unreferenced one.
+    //
+    EXPECT_NE(nullptr, get(shard, "O1", "C1"));
+    EXPECT_EQ(put(shard, "O4", "Data", "C1"), status::success);
+
+    EXPECT_EQ(nullptr, get(shard, "O2", "C1"));
+    EXPECT_NE(nullptr, get(shard, "O1", "C1"));
+    EXPECT_NE(nullptr, get(shard, "O3", "C1"));
+    EXPECT_NE(nullptr, get(shard, "O4", "C1"));
+    EXPECT_EQ(shard.get_number_entries(), 3u);
+    EXPECT_EQ(shard.get_size_bytes(), 24u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    clock_concurrent_hits_and_insertions)
+{
+    //
+    // Readers hit under the shared lock while a writer keeps evicting entries.
+    //
+    storage::cache_shard shard{32u * 16u, 32u, storage::cache_eviction_policy::clock, false, 0u, 0u};
+    for (std::size_t index = 0u; index < 16u; ++index)
+    {
+        EXPECT_EQ(put(shard, "Hot" + std::to_string(index), "HotData", "C1"), status::success);
+    }
+
+    std::vector<std::jthread> readers;
+    for (std::size_t reader = 0u; reader < 4u; ++reader)
+    {
+        readers.emplace_back(
+            [&shard]()
+            {
+                for (std::size_t iteration = 0u; iteration < 10'000u; ++iteration)
+                {
+                    const storage::shared_byte_stream object_data =
+                        get(shard, "Hot" + std::to_string(iteration % 16u), "C1");
+
+                    if (object_data != nullptr)
+                    {
+                        EXPECT_EQ(*object_data, "HotData");
+                    }
+                }
+            });
+    }
+
+    for (std::size_t index = 0u; index < 10'000u; ++index)
+    {
+        EXPECT_EQ(put(shard, "Cold" + std::to_string(index), "ColdData", "C1"), status::success);
+    }
+
+    readers.clear();
+    EXPECT_LE(shard.get_size_bytes(), 32u * 16u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    admission_rejects_one_hit_wonders)
+{
+    storage::cache_shard shard{16u, 16u, storage::cache_eviction_policy::lru, true, 0u, 0u};
+    EXPECT_EQ(put(shard, "O1", "Data", "C1"), status::success);
+    EXPECT_EQ(put(shard, "O2", "Data", "C1"), status::success);
+
+    //
+    // Make the resident objects popular.
+    //
+    for (std::size_t iteration = 0u; iteration < 4u; ++iteration)
+    {
+        EXPECT_NE(nullptr, get(shard, "O1", "C1"));
+        EXPECT_NE(nullptr, get(shard, "O2", "C1"));
+    }
+
+    //
+    // A scanned object seen once cannot displace a popular one.
+    //
+    EXPECT_EQ(nullptr, get(shard, "Scan", "C1"));
+    EXPECT_EQ(put(shard, "Scan", "Data", "C1"), status::cache_admission_rejected);
+    EXPECT_NE(nullptr, get(shard, "O1", "C1"));
+    EXPECT_NE(nullptr, get(shard, "O2", "C1"));
+
+    //
+    // Updates of resident objects bypass the admission filter.
+    //
+    EXPECT_EQ(put(shard, "O1", "New!", "C1"), status::success);
+    EXPECT_EQ(*get(shard, "O1", "C1"), "New!");
+
+    const storage::cache_statistics statistics = shard.get_statistics();
+    EXPECT_EQ(statistics.rejections_, 1u);
+    EXPECT_EQ(statistics.admissions_, 2u);
+    EXPECT_EQ(statistics.misses_, 1u);
+    EXPECT_EQ(statistics.hits_, 11u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    admission_accepts_popular_objects)
+{
+    storage::cache_shard shard{16u, 16u, storage::cache_eviction_policy::lru, true, 0u, 0u};
+    EXPECT_EQ(put(shard, "O1", "Data", "C1"), status::success);
+    EXPECT_EQ(put(shard, "O2", "Data", "C1"), status::success);
+
+    //
+    // Repeated misses make the new object more popular than the victim.
+    //
+    for (std::size_t iteration = 0u; iteration < 3u; ++iteration)
+    {
+        EXPECT_EQ(nullptr, get(shard, "O3", "C1"));
+    }
+
+    EXPECT_EQ(put(shard, "O3", "Data", "C1"), status::success);
+    EXPECT_NE(nullptr, get(shard, "O3", "C1"));
+    EXPECT_EQ(shard.get_number_entries(), 2u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    clock_admission_evicts_the_compared_victim)
+{
+    storage::cache_shard shard{16u, 16u, storage::cache_eviction_policy::clock, true, 0u, 0u};
+    EXPECT_EQ(put(shard, "O1", "Data", "C1"), status::success);
+    EXPECT_EQ(put(shard, "O2", "Data", "C1"), status::success);
+
+    //
+    // Reference both entries, so the hand clears both bits and wraps around to the
+    // first one. Only the second one is popular, so the first one is the victim compared against.
+    //
+    EXPECT_NE(nullptr, get(shard, "O1", "C1"));
+    for (std::size_t iteration = 0u; iteration < 6u; ++iteration)
+    {
+        EXPECT_NE(nullptr, get(shard, "O2", "C1"));
+    }
+
+    //
+    // A scanned object is rejected, and the victim stays next in line.
+    //
+    EXPECT_EQ(put(shard, "Scan", "Data", "C1"), status::cache_admission_rejected);
+
+    for (std::size_t iteration = 0u; iteration < 3u; ++iteration)
+    {
+        EXPECT_EQ(nullptr, get(shard, "O3", "C1"));
+    }
+
+    //
+    // The admitted object must evict the victim it was compared against, not the popular entry.
+    //
+    EXPECT_EQ(put(shard, "O3", "Data", "C1"), status::success);
+    EXPECT_EQ(nullptr, get(shard, "O1", "C1"));
+    EXPECT_NE(nullptr, get(shard, "O2", "C1"));
+    EXPECT_NE(nullptr, get(shard, "O3", "C1"));
+    EXPECT_EQ(shard.get_number_entries(), 2u);
+    EXPECT_EQ(shard.get_size_bytes(), 16u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    remove_evicts_object)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+    EXPECT_EQ(put(shard, "Object", "Data", "Container"), status::success);
+    EXPECT_EQ(put(shard, "Object", "Data", "OtherContainer"), status::success);
+
+    shard.remove(
+        storage::cache_shard::compute_key_hash("Object", "Container"),
+        "Object",
+        "Container");
+
+    EXPECT_EQ(get(shard, "Object", "Container"), nullptr);
+    EXPECT_NE(get(shard, "Object", "OtherContainer"), nullptr);
+    EXPECT_EQ(shard.get_number_entries(), 1u);
+    EXPECT_EQ(shard.get_size_bytes(), std::string{"OtherContainerObjectData"}.size());
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    fill_succeeds_without_concurrent_modification)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+    const std::uint64_t fill_version = get_version(shard, "Object", "Container");
+    EXPECT_EQ(fill(shard, "Object", "Data", "Container", fill_version), status::success);
+
+    const storage::shared_byte_stream object_data = get(shard, "Object", "Container");
+    ASSERT_NE(object_data, nullptr);
+    EXPECT_EQ(*object_data, "Data");
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    fill_superseded_by_put)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+
+    //
+    // A read takes its fill version and reads the old value, then a write lands.
+    //
+    const std::uint64_t fill_version = get_version(shard, "Object", "Container");
+    EXPECT_EQ(put(shard, "Object", "NewData", "Container"), status::success);
+    EXPECT_EQ(
+        fill(shard, "Object", "OldData", "Container", fill_version),
+        status::cache_fill_superseded);
+
+    const storage::shared_byte_stream object_data = get(shard, "Object", "Container");
+    ASSERT_NE(object_data, nullptr);
+    EXPECT_EQ(*object_data, "NewData");
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    fill_superseded_by_remove)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+
+    //
+    // A read takes its fill version and reads the value, then a removal lands.
+    //
+    const std::uint64_t fill_version = get_version(shard, "Object", "Container");
+    shard.remove(
+        storage::cache_shard::compute_key_hash("Object", "Container"),
+        "Object",
+        "Container");
+
+    EXPECT_EQ(
+        fill(shard, "Object", "Data", "Container", fill_version),
+        status::cache_fill_superseded);
+    EXPECT_EQ(get(shard, "Object", "Container"), nullptr);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    oversized_put_invalidates_existing_object)
+{
+    storage::cache_shard shard{1'024u, 32u, storage::cache_eviction_policy::lru, false, 0u, 0u};
+    EXPECT_EQ(put(shard, "Object", "Data", "Container"), status::success);
+    EXPECT_EQ(
+        put(shard, "Object", "DataExceedingLimit", "Container"),
+        status::object_data_size_exceeds_cache_limit);
+
+    EXPECT_EQ(get(shard, "Object", "Container"), nullptr);
+    EXPECT_EQ(shard.get_number_entries(), 0u);
+    EXPECT_EQ(shard.get_size_bytes(), 0u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    negative_entry_expires)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 4u, 100u};
+    const auto now = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(
+        fill_negative(shard, "Object", "Container", get_version(shard, "Object", "Container"), now),
+        status::success);
+
+    EXPECT_TRUE(is_negative(shard, "Object", "Container", now));
+    EXPECT_TRUE(is_negative(shard, "Object", "Container", now + std::chrono::milliseconds(99u)));
+    EXPECT_FALSE(is_negative(shard, "Object", "Container", now + std::chrono::milliseconds(100u)));
+    EXPECT_FALSE(is_negative(shard, "Other", "Container", now));
+    EXPECT_EQ(shard.get_statistics().negative_hits_, 2u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    negative_entry_invalidated_by_put)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 4u, 1'000u};
+    const auto now = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(
+        fill_negative(shard, "Object", "Container", get_version(shard, "Object", "Container"), now),
+        status::success);
+    EXPECT_EQ(put(shard, "Object", "Data", "Container"), status::success);
+
+    EXPECT_FALSE(is_negative(shard, "Object", "Container", now));
+    EXPECT_EQ(*get(shard, "Object", "Container"), "Data");
+    EXPECT_EQ(shard.get_number_negative_entries(), 0u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    negative_entry_invalidated_by_remove)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 4u, 1'000u};
+    const auto now = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(
+        fill_negative(shard, "Object", "Container", get_version(shard, "Object", "Container"), now),
+        status::success);
+    shard.remove(
+        storage::cache_shard::compute_key_hash("Object", "Container"),
+        "Object",
+        "Container");
+
+    EXPECT_FALSE(is_negative(shard, "Object", "Container", now));
+    EXPECT_EQ(shard.get_number_negative_entries(), 0u);
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    negative_fill_superseded_by_put)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 4u, 1'000u};
+    const auto now = std::chrono::steady_clock::now();
+
+    //
+    // A read takes its fill version and finds no object, then a write lands.
+    //
+    const std::uint64_t fill_version = get_version(shard, "Object", "Container");
+    EXPECT_EQ(put(shard, "Object", "Data", "Container"), status::success);
+
+    EXPECT_EQ(
+        fill_negative(shard, "Object", "Container", fill_version, now),
+        status::cache_fill_superseded);
+    EXPECT_FALSE(is_negative(shard, "Object", "Container", now));
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    negative_entries_are_bounded)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 2u, 1'000u};
+    const auto now = std::chrono::steady_clock::now();
+
+    for (const std::string object_id : {"O1", "O2", "O3"})
+    {
+        EXPECT_EQ(
+            fill_negative(shard, object_id, "Container", get_version(shard, object_id, "Container"), now),
+            status::success);
+    }
+
+    EXPECT_EQ(shard.get_number_negative_entries(), 2u);
+    EXPECT_FALSE(is_negative(shard, "O1", "Container", now));
+    EXPECT_TRUE(is_negative(shard, "O2", "Container", now));
+    EXPECT_TRUE(is_negative(shard, "O3", "Container", now));
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    expired_negative_entries_are_evicted)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 4u, 100u};
+    const auto now = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(
+        fill_negative(shard, "O1", "Container", get_version(shard, "O1", "Container"), now),
+        status::success);
+    EXPECT_EQ(
+        fill_negative(
+            shard,
+            "O2",
+            "Container",
+            get_version(shard, "O2", "Container"),
+            now + std::chrono::milliseconds(100u)),
+        status::success);
+
+    EXPECT_EQ(shard.get_number_negative_entries(), 1u);
+    EXPECT_TRUE(is_negative(shard, "O2", "Container", now + std::chrono::milliseconds(100u)));
+}
+
+TEST_F(
+    cache_shard_unit_tests,
+    expiry_of_stale_negative_records_keeps_refreshed_entries)
+{
+    storage::cache_shard shard{1'024u, 128u, storage::cache_eviction_policy::lru, false, 4u, 100u};
+    const auto now = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(
+        fill_negative(shard, "O1", "Container", get_version(shard, "O1", "Container"), now),
+        status::success);
+    EXPECT_EQ(
+        fill_negative(
+            shard,
+            "O2",
+            "Container",
+            get_version(shard, "O2", "Container"),
+            now + std::chrono::milliseconds(10u)),
+        status::success);
+
+    //
+    // Refreshing the first entry, and invalidating and filling the second one again,
+    // leaves the records of their first fills behind in the queue.
+    //
+    shard.remove(
+        storage::cache_shard::compute_key_hash("O2", "Container"),
+        "O2",
+        "Container");
+    EXPECT_EQ(
+        fill_negative(
+            shard,
+            "O1",
+            "Container",
+            get_version(shard, "O1", "Container"),
+            now + std::chrono::milliseconds(50u)),
+        status::success);
+    EXPECT_EQ(
+        fill_negative(
+            shard,
+            "O2",
+            "Container",
+            get_version(shard, "O2", "Container"),
+            now + std::chrono::milliseconds(60u)),
+        status::success);
+
+    //
+    // The stale records expire on the next fill, which must not evict the entries they no longer track.
+    //
+    const auto later = now + std::chrono::milliseconds(120u);
+    EXPECT_EQ(
+        fill_negative(shard, "O3", "Container", get_version(shard, "O3", "Container"), later),
+        status::success);
+
+    EXPECT_TRUE(is_negative(shard, "O1", "Container", later));
+    EXPECT_TRUE(is_negative(shard, "O2", "Container", later));
+    EXPECT_TRUE(is_negative(shard, "O3", "Container", later));
+    EXPECT_EQ(shard.get_number_negative_entries(), 3u);
+}
+
+} // namespace tests.
+} // namespace pandora.
@@ -0,0 +1,322 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'collocation_topology_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the collocation topology
+//      marker and the resharding recovery.
+// ****************************************************
+
+#include <string>
+#include <fstream>
+#include <optional>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include "core/status/status.hh"
+#include "core/startup/collocation_builder.hh"
+#include "core/startup/collocation_resharder.hh"
+#include "core/storage/io/collocation_topology.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+class collocation_topology_unit_tests : public testing::Test
+{
+protected:
+
+    void
+    SetUp() override
+    {
+        kv_store_path_ = (std::filesystem::temp_directory_path() /
+            ("pandora_collocation_topology_" +
+             std::string{testing::UnitTest::GetInstance()->current_test_info()->name()})).string();
+        std::filesystem::remove_all(kv_store_path_);
+        std::filesystem::create_directories(kv_store_path_);
+    }
+
+    void
+    TearDown() override
+    {
+        std::filesystem::remove_all(kv_store_path_);
+    }
+
+    //
+    // Writes a file with the given contents, creating its parent directories.
+    //
+    static
+    void
+    write_file(
+        const std::string& path,
+        const std::string& contents)
+    {
+        std::filesystem::create_directories(std::filesystem::path{path}.parent_path());
+        std::ofstream file{path, std::ios::trunc};
+        file << contents;
+    }
+
+    //
+    // Reads the contents of a file, or an empty string if it does not exist.
+    //
+    static
+    std::string
+    read_file(
+        const std::string& path)
+    {
+        std::ifstream file{path};
+        return std::string{
+            std::istreambuf_iterator<char>{file},
+            std::istreambuf_iterator<char>{}};
+    }
+
+    //
+    // Gets the path of a structured data partition under the given directory.
+    //
+    static
+    std::string
+    get_partition_path(
+        const std::string& directory_path,
+        const std::uint16_t collocation_index)
+    {
+        return directory_path + "/" +
+            storage::collocation_builder::k_structured_partition_prefix + "-" +
+            std::to_string(collocation_index);
+    }
+
+    //
+    // Gets the path of the metadata partition for the given number of collocations.
+    //
+    std::string
+    get_metadata_partition_path(
+        const std::uint16_t number_collocations) const
+    {
+        return kv_store_path_ + "/" +
+            storage::collocation_builder::k_metadata_partition_prefix + "-" +
+            std::to_string(number_collocations);
+    }
+
+    //
+    // Reads the persisted number of collocations of the test data store.
+    //
+    std::optional<std::uint16_t>
+    read_number_collocations() const
+    {
+        std::optional<std::uint16_t> number_collocations;
+        EXPECT_EQ(
+            storage::collocation_topology::read_number_collocations(kv_store_path_, number_collocations),
+            status::success);
+
+        return number_collocations;
+    }
+
+    //
+    // Core key-value store path of the test data store.
+    //
+    std::string kv_store_path_;
+};
+
+TEST_F(
+    collocation_topology_unit_tests,
+    new_data_store_has_no_topology)
+{
+    EXPECT_FALSE(read_number_collocations().has_value());
+}
+
+TEST_F(
+    collocation_topology_unit_tests,
+    persisted_topology_is_read_back)
+{
+    EXPECT_EQ(
+        storage::collocation_topology::persist_number_collocations(kv_store_path_, 12u),
+        status::success);
+    EXPECT_EQ(read_number_collocations(), 12u);
+    EXPECT_FALSE(std::filesystem::exists(kv_store_path_ + "/TOPOLOGY.tmp"));
+}
+
+TEST_F(
+    collocation_topology_unit_tests,
+    legacy_data_store_uses_legacy_topology)
+{
+    //
+    // Data stores created before the marker have the metadata partition after the legacy collocations.
+    //
+    std::filesystem::create_directories(
+        get_metadata_partition_path(storage::collocation_topology::k_legacy_number_collocations));
+
+    EXPECT_EQ(read_number_collocations(), storage::collocation_topology::k_legacy_number_collocations);
+}
+
+TEST_F(
+    collocation_topology_unit_tests,
+    out_of_range_topology_is_rejected)
+{
+    for (const std::string marker_contents : {"0\n", "-1\n", "65535\n", "70000\n", "Invalid\n"})
+    {
+        write_file(kv_store_path_ + "/TOPOLOGY", marker_contents);
+
+        std::optional<std::uint16_t> number_collocations;
+        EXPECT_EQ(
+            storage::collocation_topology::read_number_collocations(kv_store_path_, number_collocations),
+            status::collocation_topology_marker_failed) << marker_contents;
+    }
+
+    EXPECT_TRUE(storage::collocation_topology::is_valid_number_collocations(1));
+    EXPECT_TRUE(storage::collocation_topology::is_valid_number_collocations(
+        storage::collocation_topology::k_max_number_collocations));
+    EXPECT_FALSE(storage::collocation_topology::is_valid_number_collocations(0));
+    EXPECT_FALSE(storage::collocation_topology::is_valid_number_collocations(65'536));
+}
+
+TEST_F(
+    collocation_topology_unit_tests,
+    validation_persists_first_topology_and_rejects_changes)
+{
+    EXPECT_EQ(
+        storage::collocation_topology::validate_number_collocations(kv_store_path_, 4u),
+        status::success);
+    EXPECT_EQ(read_number_collocations(), 4u);
+
+    EXPECT_EQ(
+        storage::collocation_topology::validate_number_collocations(kv_store_path_, 4u),
+        status::success);
+    EXPECT_EQ(
+        storage::collocation_topology::validate_number_collocations(kv_store_path_, 6u),
+        status::collocation_topology_mismatch);
+}
+
+TEST_F(
+    collocation_topology_unit_tests,
+    resharding_intent_is_read_back_and_removed)
+{
+    std::optional<storage::resharding_intent> resharding_intent;
+    EXPECT_EQ(
+        storage::collocation_topology::read_resharding_intent(kv_store_path_, resharding_intent),
+        status::success);
+    EXPECT_FALSE(resharding_intent.has_value());
+
+    EXPECT_EQ(
+        storage::collocation_topology::persist_resharding_intent(kv_store_path_, {2u, 3u}),
+        status::success);
+    EXPECT_EQ(
+        storage::collocation_topology::read_resharding_intent(kv_store_path_, resharding_intent),
+        status::success);
+    ASSERT_TRUE(resharding_intent.has_value());
+    EXPECT_EQ(resharding_intent->source_number_collocations_, 2u);
+    EXPECT_EQ(resharding_intent->target_number_collocations_, 3u);
+
+    EXPECT_EQ(
+        storage::collocation_topology::remove_resharding_intent(kv_store_path_),
+        status::success);
+    EXPECT_EQ(
+        storage::collocation_topology::read_resharding_intent(kv_store_path_, resharding_intent),
+        status::success);
+    EXPECT_FALSE(resharding_intent.has_value());
+}
+
+TEST_F(
+    collocation_topology_unit_tests,
+    recovery_without_intent_leaves_data_store_unchanged)
+{
+    storage::storage_configuration storage_configuration;
+    storage_configuration.kv_store_path_ = kv_store_path_;
+    storage_configuration.number_collocations_ = 3u;
+    write_file(get_partition_path(kv_store_path_, 0u) + "/DATA", "Source0");
+    EXPECT_EQ(
+        storage::collocation_topology::persist_number_collocations(kv_store_path_, 1u),
+        status::success);
+
+    storage::collocation_resharder collocation_resharder{storage_configuration};
+    EXPECT_EQ(collocation_resharder.recover_interrupted_resharding(), status::success);
+
+    EXPECT_EQ(read_file(get_partition_path(kv_store_path_, 0u) + "/DATA"), "Source0");
+    EXPECT_EQ(read_number_collocations(), 1u);
+}
+
+TEST_F(
+    collocation_topology_unit_tests,
+    recovery_rolls_interrupted_swap_forward)
+{
+    storage::storage_configuration storage_configuration;
+    storage_configuration.kv_store_path_ = kv_store_path_;
+    storage_configuration.number_collocations_ = 3u;
+    const std::string staging_path = kv_store_path_ + "/reshard-staging";
+    const std::string backup_path = kv_store_path_ + "/reshard-backup";
+
+    //
+    // Reproduce a crash from resharding 2 into 3 collocations, after the first source data
+    // partition was moved into the backup directory and the first staged one was moved in its place.
+    //
+    write_file(get_partition_path(backup_path, 0u) + "/DATA", "Source0");
+    write_file(get_partition_path(kv_store_path_, 1u) + "/DATA", "Source1");
+    write_file(get_partition_path(kv_store_path_, 0u) + "/DATA", "Target0");
+    write_file(get_partition_path(staging_path, 1u) + "/DATA", "Target1");
+    write_file(get_partition_path(staging_path, 2u) + "/DATA", "Target2");
+    write_file(get_metadata_partition_path(2u) + "/DATA", "Metadata");
+    EXPECT_EQ(
+        storage::collocation_topology::persist_number_collocations(kv_store_path_, 2u),
+        status::success);
+    EXPECT_EQ(
+        storage::collocation_topology::persist_resharding_intent(kv_store_path_, {2u, 3u}),
+        status::success);
+
+    storage::collocation_resharder collocation_resharder{storage_configuration};
+    EXPECT_EQ(collocation_resharder.recover_interrupted_resharding(), status::success);
+
+    EXPECT_EQ(read_file(get_partition_path(kv_store_path_, 0u) + "/DATA"), "Target0");
+    EXPECT_EQ(read_file(get_partition_path(kv_store_path_, 1u) + "/DATA"), "Target1");
+    EXPECT_EQ(read_file(get_partition_path(kv_store_path_, 2u) + "/DATA"), "Target2");
+    EXPECT_EQ(read_file(get_partition_path(backup_path, 0u) + "/DATA"), "Source0");
+    EXPECT_EQ(read_file(get_partition_path(backup_path, 1u) + "/DATA"), "Source1");
+    EXPECT_EQ(read_file(get_metadata_partition_path(3u) + "/DATA"), "Metadata");
+    EXPECT_FALSE(std::filesystem::exists(get_metadata_partition_path(2u)));
+    EXPECT_FALSE(std::filesystem::exists(staging_path));
+    EXPECT_EQ(read_number_collocations(), 3u);
+
+    std::optional<storage::resharding_intent> resharding_intent;
+    EXPECT_EQ(
+        storage::collocation_topology::read_resharding_intent(kv_store_path_, resharding_intent),
+        status::success);
+    EXPECT_FALSE(resharding_intent.has_value());
+}
+
+TEST_F(
+    collocation_topology_unit_tests,
+    recovery_keeps_intent_if_staged_partition_is_missing)
+{
+    storage::storage_configuration storage_configuration;
+    storage_configuration.kv_store_path_ = kv_store_path_;
+    storage_configuration.number_collocations_ = 2u;
+
+    //
+    // The only staged data partition is gone, so the swap cannot be completed.
+    //
+    write_file(get_partition_path(kv_store_path_, 0u) + "/DATA", "Source0");
+    write_file(get_metadata_partition_path(1u) + "/DATA", "Metadata");
+    EXPECT_EQ(
+        storage::collocation_topology::persist_number_collocations(kv_store_path_, 1u),
+        status::success);
+    EXPECT_EQ(
+        storage::collocation_topology::persist_resharding_intent(kv_store_path_, {1u, 2u}),
+        status::success);
+
+    storage::collocation_resharder collocation_resharder{storage_configuration};
+    EXPECT_EQ(collocation_resharder.recover_interrupted_resharding(), status::collocation_resharding_failed);
+
+    EXPECT_EQ(read_number_collocations(), 1u);
+
+    std::optional<storage::resharding_intent> resharding_intent;
+    EXPECT_EQ(
+        storage::collocation_topology::read_resharding_intent(kv_store_path_, resharding_intent),
+        status::success);
+    EXPECT_TRUE(resharding_intent.has_value());
+}
+
+} // namespace tests.
+} // namespace pandora.
@@ -0,0 +1,233 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'container_cursor_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the container cursor component.
+// ****************************************************
+
+#include <map>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "core/storage/io/container_cursor.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+//
+// Storage engine iterator over an in-memory sorted map,
+// standing in for the iterator of a single collocation.
+//
+class map_object_iterator : public rocksdb::Iterator
+{
+public:
+
+    map_object_iterator(
+        std::map<std::string, std::string> objects,
+        const bool fail_on_exhaustion = false)
+        : objects_{std::move(objects)},
+          position_{objects_.end()},
+          fail_on_exhaustion_{fail_on_exhaustion}
+    {}
+
+    bool
+    Valid() const override
+    {
+        return position_ != objects_.end();
+    }
+
+    void
+    SeekToFirst() override
+    {
+        position_ = objects_.begin();
+    }
+
+    void
+    SeekToLast() override
+    {
+        position_ = objects_.empty() ? objects_.end() : std::prev(objects_.end());
+    }
+
+    void
+    Seek(
+        const rocksdb::Slice& target) override
+    {
+        position_ = objects_.lower_bound(target.ToString());
+    }
+
+    void
+    SeekForPrev(
+        const rocksdb::Slice& target) override
+    {
+        position_ = objects_.upper_bound(target.ToString());
+        position_ = position_ == objects_.begin() ? objects_.end() : std::prev(position_);
+    }
+
+    void
+    Next() override
+    {
+        ++position_;
+    }
+
+    void
+    Prev() override
+    {
+        position_ = position_ == objects_.begin() ? objects_.end() : std::prev(position_);
+    }
+
+    rocksdb::Slice
+    key() const override
+    {
+        return position_->first;
+    }
+
+    rocksdb::Slice
+    value() const override
+    {
+        return position_->second;
+    }
+
+    rocksdb::Status
+    status() const override
+    {
+        return fail_on_exhaustion_ && !Valid() ?
+            rocksdb::Status::IOError() :
+            rocksdb::Status::OK();
+    }
+
+private:
+
+    std::map<std::string, std::string> objects_;
+
+    std::map<std::string, std::string>::const_iterator position_;
+
+    const bool fail_on_exhaustion_;
+};
+
+//
+// Creates a cursor over the given per-collocation object sets.
+//
+storage::container_cursor
+create_cursor(
+    std::vector<std::map<std::string, std::string>> collocations)
+{
+    std::vector<std::unique_ptr<storage::storage_engine_iterator>> object_iterators;
+    for (auto& objects : collocations)
+    {
+        object_iterators.emplace_back(std::make_unique<map_object_iterator>(std::move(objects)));
+    }
+
+    return storage::container_cursor{std::move(object_iterators)};
+}
+
+//
+// Drains the cursor and returns the visited object IDs.
+//
+std::vector<std::string>
+drain_cursor(
+    storage::container_cursor& cursor)
+{
+    std::vector<std::string> object_ids;
+    while (cursor.is_valid())
+    {
+        object_ids.emplace_back(cursor.get_object_id());
+        EXPECT_EQ(cursor.next(), status::success);
+    }
+
+    return object_ids;
+}
+
+TEST(
+    container_cursor_unit_tests,
+    merges_collocations_in_key_order)
+{
+    storage::container_cursor cursor = create_cursor({
+        {{"b", "2"}, {"e", "5"}},
+        {},
+        {{"a", "1"}, {"d", "4"}},
+        {{"c", "3"}}});
+
+    ASSERT_EQ(cursor.seek(""), status::success);
+    ASSERT_TRUE(cursor.is_valid());
+    EXPECT_EQ(cursor.get_object_id(), "a");
+    EXPECT_EQ(cursor.get_object_data(), "1");
+
+    const std::vector<std::string> expected_object_ids{"a", "b", "c", "d", "e"};
+    EXPECT_EQ(drain_cursor(cursor), expected_object_ids);
+}
+
+TEST(
+    container_cursor_unit_tests,
+    seek_resumes_after_object_id)
+{
+    storage::container_cursor cursor = create_cursor({
+        {{"b", "2"}, {"e", "5"}},
+        {{"a", "1"}, {"d", "4"}}});
+
+    //
+    // The continuation point itself is excluded, and it
+    // does not need to exist in the container anymore.
+    //
+    ASSERT_EQ(cursor.seek("b"), status::success);
+    const std::vector<std::string> expected_after_existing{"d", "e"};
+    EXPECT_EQ(drain_cursor(cursor), expected_after_existing);
+
+    ASSERT_EQ(cursor.seek("c"), status::success);
+    const std::vector<std::string> expected_after_missing{"d", "e"};
+    EXPECT_EQ(drain_cursor(cursor), expected_after_missing);
+
+    ASSERT_EQ(cursor.seek("e"), status::success);
+    EXPECT_FALSE(cursor.is_valid());
+}
+
+TEST(
+    container_cursor_unit_tests,
+    iterator_failure_fails_traversal)
+{
+    std::vector<std::unique_ptr<storage::storage_engine_iterator>> object_iterators;
+    object_iterators.emplace_back(std::make_unique<map_object_iterator>(
+        std::map<std::string, std::string>{{"a", "1"}},
+        true /* fail_on_exhaustion */));
+    object_iterators.emplace_back(std::make_unique<map_object_iterator>(
+        std::map<std::string, std::string>{{"b", "2"}}));
+    storage::container_cursor cursor{std::move(object_iterators)};
+
+    ASSERT_EQ(cursor.seek(""), status::success);
+    ASSERT_TRUE(cursor.is_valid());
+    EXPECT_EQ(cursor.get_object_id(), "a");
+    EXPECT_EQ(cursor.next(), status::objects_retrieval_from_container_failed);
+    EXPECT_FALSE(cursor.is_valid());
+}
+
+TEST(
+    container_cursor_unit_tests,
+    continuation_token_round_trips)
+{
+    const std::string object_id{"object\x00\xff/1", 10u};
+    const std::string continuation_token = storage::container_cursor::encode_continuation_token(object_id);
+    EXPECT_EQ(continuation_token, "6f626a65637400ff2f31");
+
+    std::string decoded_object_id;
+    ASSERT_TRUE(storage::container_cursor::decode_continuation_token(continuation_token, decoded_object_id));
+    EXPECT_EQ(decoded_object_id, object_id);
+
+    ASSERT_TRUE(storage::container_cursor::decode_continuation_token("", decoded_object_id));
+    EXPECT_TRUE(decoded_object_id.empty());
+
+    EXPECT_FALSE(storage::container_cursor::decode_continuation_token("abc", decoded_object_id));
+    EXPECT_FALSE(storage::container_cursor::decode_continuation_token("zz", decoded_object_id));
+    EXPECT_FALSE(storage::container_cursor::decode_continuation_token("AB", decoded_object_id));
+}
+
+} // namespace tests.
+} // namespace pandora.
@@ -0,0 +1,192 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'engine_statistics_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the collection and the
+//      export of the storage engine statistics.
+// ****************************************************
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <rocksdb/db.h>
+#include <rocksdb/options.h>
+#include <rocksdb/statistics.h>
+#include "core/status/status.hh"
+#include "core/network/endpoints/admin.hh"
+#include "core/storage/io/storage_engine.hh"
+#include "core/storage/io/storage_engine_statistics.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+class engine_statistics_unit_tests : public testing::Test
+{
+protected:
+
+    void
+    SetUp() override
+    {
+        partition_path_ = (std::filesystem::temp_directory_path() /
+            ("pandora_engine_statistics_" +
+             std::string{testing::UnitTest::GetInstance()->current_test_info()->name()})).string();
+        std::filesystem::remove_all(partition_path_);
+    }
+
+    void
+    TearDown() override
+    {
+        std::filesystem::remove_all(partition_path_);
+    }
+
+    //
+    // Finds the value of a property within the given {Name, Value} pairs.
+    //
+    template <typename value_type>
+    static
+    std::optional<value_type>
+    find_property(
+        const std::vector<std::pair<std::string, value_type>>& properties,
+        const std::string& property_name)
+    {
+        const auto property_iterator = std::find_if(
+            properties.begin(),
+            properties.end(),
+            [&property_name](const std::pair<std::string, value_type>& property)
+            {
+                return property.first == property_name;
+            });
+
+        if (property_iterator == properties.end())
+        {
+            return std::nullopt;
+        }
+
+        return property_iterator->second;
+    }
+
+    //
+    // Directory of the storage engine instance of the test.
+    //
+    std::string partition_path_;
+};
+
+TEST_F(
+    engine_statistics_unit_tests,
+    storage_engine_reports_instance_and_container_statistics)
+{
+    rocksdb::Options options;
+    options.create_if_missing = true;
+    options.statistics = rocksdb::CreateDBStatistics();
+
+    rocksdb::DB* persistent_store = nullptr;
+    ASSERT_TRUE(rocksdb::DB::Open(options, partition_path_, &persistent_store).ok());
+
+    //
+    // The default column family is never registered, so it stands for a reference not approved for the engine.
+    //
+    storage::storage_engine_reference* unapproved_reference = persistent_store->DefaultColumnFamily();
+
+    storage::storage_engine storage_engine;
+    storage_engine.set_persistent_store(0u, std::unique_ptr<rocksdb::DB>{persistent_store});
+
+    storage::storage_engine_reference* container_reference = nullptr;
+    ASSERT_EQ(storage_engine.create_container("Container", &container_reference), status::success);
+    storage_engine.register_approved_engine_references({container_reference});
+    ASSERT_EQ(storage_engine.insert_object(container_reference, "Object", "Data"), status::success);
+
+    std::vector<storage::storage_engine_reference*> container_references{container_reference, unapproved_reference};
+    const storage::storage_engine_statistics engine_statistics =
+        storage_engine.get_engine_statistics(container_references);
+
+    EXPECT_EQ(find_property(engine_statistics.properties_, "rocksdb.estimate-num-keys"), "1");
+    EXPECT_TRUE(find_property(engine_statistics.properties_, "rocksdb.is-write-stopped").has_value());
+    EXPECT_EQ(find_property(engine_statistics.tickers_, "rocksdb.number.keys.written"), 1u);
+
+    for (const storage::storage_engine_histogram_statistics& histogram : engine_statistics.histograms_)
+    {
+        EXPECT_GT(histogram.count_, 0u) << histogram.name_;
+    }
+
+    ASSERT_EQ(engine_statistics.containers_.size(), 1u);
+    EXPECT_EQ(engine_statistics.containers_[0].container_name_, "Container");
+    EXPECT_EQ(find_property(engine_statistics.containers_[0].properties_, "rocksdb.estimate-num-keys"), "1");
+
+    EXPECT_EQ(storage_engine.close_container_storage_engine_reference(container_reference), status::success);
+}
+
+TEST_F(
+    engine_statistics_unit_tests,
+    storage_engine_without_statistics_reports_properties_only)
+{
+    rocksdb::Options options;
+    options.create_if_missing = true;
+
+    rocksdb::DB* persistent_store = nullptr;
+    ASSERT_TRUE(rocksdb::DB::Open(options, partition_path_, &persistent_store).ok());
+
+    storage::storage_engine storage_engine;
+    storage_engine.set_persistent_store(0u, std::unique_ptr<rocksdb::DB>{persistent_store});
+
+    const storage::storage_engine_statistics engine_statistics = storage_engine.get_engine_statistics({});
+
+    EXPECT_TRUE(find_property(engine_statistics.properties_, "rocksdb.estimate-num-keys").has_value());
+    EXPECT_TRUE(engine_statistics.tickers_.empty());
+    EXPECT_TRUE(engine_statistics.histograms_.empty());
+    EXPECT_TRUE(engine_statistics.containers_.empty());
+}
+
+TEST_F(
+    engine_statistics_unit_tests,
+    admin_appends_statistics_as_json_fields)
+{
+    storage::storage_engine_statistics engine_statistics;
+    engine_statistics.properties_ = {{"rocksdb.estimate-num-keys", "12"}, {"rocksdb.dbstats.interval", "a\"b"}};
+    engine_statistics.tickers_ = {{"rocksdb.block.cache.hit", 3u}, {"rocksdb.block.cache.miss", 4u}};
+    engine_statistics.histograms_ = {{"rocksdb.db.get.micros", 5u, 1.5, 2.5, 3.5, 4.0}};
+    engine_statistics.containers_ = {
+        {"Container", {{"rocksdb.estimate-num-keys", "7"}}},
+        {"Empty", {}}};
+
+    std::string response_body;
+    network::endpoints::admin::append_engine_statistics(response_body, engine_statistics);
+
+    EXPECT_EQ(
+        response_body,
+        "\"properties\":{\"rocksdb.estimate-num-keys\":\"12\",\"rocksdb.dbstats.interval\":\"a\\\"b\"},"
+        "\"tickers\":{\"rocksdb.block.cache.hit\":3,\"rocksdb.block.cache.miss\":4},"
+        "\"histograms\":{\"rocksdb.db.get.micros\":"
+            "{\"count\":5,\"median\":1.5,\"percentile_95\":2.5,\"percentile_99\":3.5,\"max\":4}},"
+        "\"containers\":["
+            "{\"container_name\":\"Container\",\"properties\":{\"rocksdb.estimate-num-keys\":\"7\"}},"
+            "{\"container_name\":\"Empty\",\"properties\":{}}]");
+}
+
+TEST_F(
+    engine_statistics_unit_tests,
+    admin_appends_empty_statistics)
+{
+    std::string response_body;
+    network::endpoints::admin::append_engine_statistics(response_body, storage::storage_engine_statistics{});
+
+    EXPECT_EQ(
+        response_body,
+        "\"properties\":{},\"tickers\":{},\"histograms\":{},\"containers\":[]");
+}
+
+} // namespace tests.
+} // namespace pandora.
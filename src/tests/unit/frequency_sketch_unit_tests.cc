@@ -0,0 +1,77 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'frequency_sketch_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the frequency sketch component.
+// ****************************************************
+
+#include <gtest/gtest.h>
+#include "core/storage/cache/frequency_sketch.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+TEST(
+    frequency_sketch_unit_tests,
+    estimate_follows_recorded_accesses)
+{
+    storage::frequency_sketch sketch{1'024u};
+    EXPECT_EQ(sketch.estimate_frequency(1u), 0u);
+
+    for (std::size_t iteration = 0u; iteration < 5u; ++iteration)
+    {
+        sketch.record_access(1u);
+    }
+
+    sketch.record_access(2u);
+    EXPECT_EQ(sketch.estimate_frequency(1u), 5u);
+    EXPECT_EQ(sketch.estimate_frequency(2u), 1u);
+}
+
+TEST(
+    frequency_sketch_unit_tests,
+    estimate_saturates)
+{
+    storage::frequency_sketch sketch{1'024u};
+    for (std::size_t iteration = 0u; iteration < 100u; ++iteration)
+    {
+        sketch.record_access(1u);
+    }
+
+    EXPECT_EQ(sketch.estimate_frequency(1u), 15u);
+}
+
+TEST(
+    frequency_sketch_unit_tests,
+    aging_halves_counters)
+{
+    //
+    // The sketch ages after ten times the expected number of entries.
+    //
+    constexpr std::size_t k_expected_number_entries = 64u;
+    storage::frequency_sketch sketch{k_expected_number_entries};
+    for (std::size_t iteration = 0u; iteration < 8u; ++iteration)
+    {
+        sketch.record_access(1u);
+    }
+
+    for (std::size_t iteration = 8u; iteration < k_expected_number_entries * 10u; ++iteration)
+    {
+        sketch.record_access(2u);
+    }
+
+    EXPECT_EQ(sketch.estimate_frequency(1u), 4u);
+    EXPECT_EQ(sketch.estimate_frequency(2u), 7u);
+}
+
+} // namespace tests.
+} // namespace pandora.
@@ -0,0 +1,192 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'inflight_operations_tracker_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the in-flight operations tracker component.
+// ****************************************************
+
+#include <gtest/gtest.h>
+#include "core/storage/management/inflight_operations_tracker.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+TEST(
+    inflight_operations_tracker_unit_tests,
+    concurrent_misses_share_a_single_read)
+{
+    storage::inflight_operations_tracker tracker;
+    std::uint32_t number_responses = 0u;
+    const auto reception_time = std::chrono::steady_clock::now();
+    const auto deadline = reception_time;
+    network::server_response_callback first_response_callback =
+        [&number_responses](const drogon::HttpResponsePtr&) { ++number_responses; };
+    network::server_response_callback second_response_callback = first_response_callback;
+
+    std::shared_ptr<storage::inflight_read> first_read = tracker.join_or_start_read(
+        "container",
+        "object",
+        1u,
+        deadline,
+        reception_time,
+        false,
+        first_response_callback);
+    std::shared_ptr<storage::inflight_read> second_read = tracker.join_or_start_read(
+        "container",
+        "object",
+        1u,
+        deadline + std::chrono::seconds(5u),
+        reception_time,
+        false,
+        second_response_callback);
+
+    ASSERT_NE(first_read, nullptr);
+    EXPECT_EQ(second_read, nullptr);
+    EXPECT_EQ(first_read->get_deadline(), deadline + std::chrono::seconds(5u));
+
+    first_read->complete(status::success, "object_data");
+
+    EXPECT_EQ(number_responses, 1u);
+}
+
+TEST(
+    inflight_operations_tracker_unit_tests,
+    misses_after_a_write_start_a_new_read)
+{
+    storage::inflight_operations_tracker tracker;
+    std::uint32_t number_responses = 0u;
+    const auto reception_time = std::chrono::steady_clock::now();
+    const auto deadline = reception_time;
+    network::server_response_callback first_response_callback =
+        [&number_responses](const drogon::HttpResponsePtr&) { ++number_responses; };
+    network::server_response_callback second_response_callback = first_response_callback;
+    network::server_response_callback third_response_callback = first_response_callback;
+
+    std::shared_ptr<storage::inflight_read> first_read = tracker.join_or_start_read(
+        "container", "object", 1u, deadline, reception_time, false, first_response_callback);
+    std::shared_ptr<storage::inflight_read> second_read = tracker.join_or_start_read(
+        "container", "object", 2u, deadline, reception_time, false, second_response_callback);
+
+    ASSERT_NE(first_read, nullptr);
+    ASSERT_NE(second_read, nullptr);
+
+    //
+    // Completing the superseded read must keep its successor joinable.
+    //
+    first_read->complete(status::success, "stale_object_data");
+
+    EXPECT_EQ(tracker.join_or_start_read(
+        "container", "object", 2u, deadline, reception_time, false, third_response_callback), nullptr);
+
+    second_read->complete(status::success, "object_data");
+
+    EXPECT_EQ(number_responses, 1u);
+}
+
+TEST(
+    inflight_operations_tracker_unit_tests,
+    misses_after_completion_start_a_new_read)
+{
+    storage::inflight_operations_tracker tracker;
+    const auto reception_time = std::chrono::steady_clock::now();
+    const auto deadline = reception_time;
+    network::server_response_callback first_response_callback = [](const drogon::HttpResponsePtr&) {};
+    network::server_response_callback second_response_callback = first_response_callback;
+
+    std::shared_ptr<storage::inflight_read> first_read = tracker.join_or_start_read(
+        "container", "object", 1u, deadline, reception_time, false, first_response_callback);
+
+    ASSERT_NE(first_read, nullptr);
+
+    first_read->complete(status::success, "object_data");
+
+    EXPECT_NE(tracker.join_or_start_read(
+        "container", "object", 1u, deadline, reception_time, false, second_response_callback), nullptr);
+}
+
+TEST(
+    inflight_operations_tracker_unit_tests,
+    misses_after_expiry_start_a_new_read)
+{
+    storage::inflight_operations_tracker tracker;
+    std::uint32_t number_expired_responses = 0u;
+    std::uint32_t number_late_responses = 0u;
+    const auto reception_time = std::chrono::steady_clock::now();
+    const auto deadline = reception_time;
+    network::server_response_callback first_response_callback = [](const drogon::HttpResponsePtr&) {};
+    network::server_response_callback second_response_callback =
+        [&number_expired_responses](const drogon::HttpResponsePtr&) { ++number_expired_responses; };
+    network::server_response_callback late_response_callback =
+        [&number_late_responses](const drogon::HttpResponsePtr&) { ++number_late_responses; };
+
+    std::shared_ptr<storage::inflight_read> first_read = tracker.join_or_start_read(
+        "container", "object", 1u, deadline, reception_time, false, first_response_callback);
+    EXPECT_EQ(tracker.join_or_start_read(
+        "container", "object", 1u, deadline, reception_time, false, second_response_callback), nullptr);
+
+    ASSERT_NE(first_read, nullptr);
+
+    //
+    // Once the dispatcher decides the read expired, a client arriving before the read
+    // completes must start its own read instead of inheriting the expiry of the others.
+    //
+    EXPECT_TRUE(first_read->try_expire(deadline));
+
+    std::shared_ptr<storage::inflight_read> late_read = tracker.join_or_start_read(
+        "container", "object", 1u, deadline + std::chrono::seconds(5u), reception_time, false, late_response_callback);
+
+    ASSERT_NE(late_read, nullptr);
+
+    first_read->complete(status::deadline_exceeded, std::nullopt);
+
+    EXPECT_EQ(number_expired_responses, 1u);
+    EXPECT_EQ(number_late_responses, 0u);
+
+    //
+    // Completing the expired read must keep its successor joinable.
+    //
+    network::server_response_callback third_response_callback = late_response_callback;
+    EXPECT_EQ(tracker.join_or_start_read(
+        "container", "object", 1u, deadline, reception_time, false, third_response_callback), nullptr);
+
+    late_read->complete(status::success, "object_data");
+
+    EXPECT_EQ(number_late_responses, 1u);
+}
+
+TEST(
+    inflight_operations_tracker_unit_tests,
+    joined_clients_keep_the_read_from_expiring)
+{
+    storage::inflight_operations_tracker tracker;
+    std::uint32_t number_responses = 0u;
+    const auto reception_time = std::chrono::steady_clock::now();
+    const auto deadline = reception_time;
+    network::server_response_callback first_response_callback = [](const drogon::HttpResponsePtr&) {};
+    network::server_response_callback second_response_callback =
+        [&number_responses](const drogon::HttpResponsePtr&) { ++number_responses; };
+
+    std::shared_ptr<storage::inflight_read> first_read = tracker.join_or_start_read(
+        "container", "object", 1u, deadline, reception_time, false, first_response_callback);
+    EXPECT_EQ(tracker.join_or_start_read(
+        "container", "object", 1u, deadline + std::chrono::seconds(5u), reception_time, false, second_response_callback), nullptr);
+
+    ASSERT_NE(first_read, nullptr);
+    EXPECT_FALSE(first_read->try_expire(deadline));
+
+    first_read->complete(status::success, "object_data");
+
+    EXPECT_EQ(number_responses, 1u);
+}
+
+} // namespace tests.
+} // namespace pandora.
@@ -0,0 +1,236 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'io_dispatcher_fixture.hh'
+// Author: jcjuarez
+// Description:
+//      Test fixture running the IO dispatchers
+//      against a single data partition backed
+//      by a temporary storage engine instance.
+// ****************************************************
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <drogon/drogon.h>
+#include <rocksdb/db.h>
+#include <rocksdb/options.h>
+#include <rocksdb/statistics.h>
+#include "core/status/status.hh"
+#include "core/storage/models/container.hh"
+#include "core/storage/cache/cache_accessor.hh"
+#include "core/storage/cache/frontline_cache.hh"
+#include "core/storage/index/container_index.hh"
+#include "core/storage/io/storage_engine.hh"
+#include "core/storage/io/data_partition_table.hh"
+#include "core/storage/io/data_partition_provider.hh"
+#include "core/storage/models/object_io_task.hh"
+#include "core/storage/models/object_batch_context.hh"
+#include "core/schemas/request-interfaces/object_request.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+//
+// Runs the IO dispatchers against the "Container" object container
+// of a single data partition, created from scratch for every test.
+//
+class io_dispatcher_fixture : public testing::Test
+{
+protected:
+
+    void
+    SetUp() override
+    {
+        storage_configuration_.kv_store_path_ = (std::filesystem::temp_directory_path() /
+            ("pandora_io_dispatcher_" +
+             std::string{testing::UnitTest::GetInstance()->current_test_info()->name()})).string();
+        std::filesystem::remove_all(storage_configuration_.kv_store_path_);
+
+        rocksdb::Options options;
+        options.create_if_missing = true;
+        options.statistics = statistics_;
+
+        rocksdb::DB* persistent_store = nullptr;
+        ASSERT_TRUE(rocksdb::DB::Open(options, storage_configuration_.kv_store_path_, &persistent_store).ok());
+
+        std::unique_ptr<storage::storage_engine> storage_engine = create_storage_engine();
+        storage_engine->set_persistent_store(0u, std::unique_ptr<rocksdb::DB>{persistent_store});
+
+        storage::storage_engine_reference* container_reference = nullptr;
+        ASSERT_EQ(storage_engine->create_container("Container", &container_reference), status::success);
+        storage_engine->register_approved_engine_references({container_reference});
+        storage_engine_ = storage_engine.get();
+
+        auto data_partition_table = std::make_unique<storage::data_partition_table>();
+        data_partition_table->append_partition(
+            "DataPartition",
+            0u,
+            storage_configuration_,
+            std::move(storage_engine),
+            nullptr);
+        data_partition_provider_ = std::make_unique<storage::data_partition_provider>(std::move(data_partition_table));
+
+        container_ = std::make_shared<storage::container>(
+            storage::container::create_container_persistent_metadata("Container"),
+            std::vector<storage::container_instance>{{0u, *storage_engine_, container_reference}});
+
+        //
+        // Index the object container, so the completed operations update the frontline cache.
+        //
+        ASSERT_EQ(
+            container_index_.insert_container(
+                storage::container::create_container_persistent_metadata("Container"),
+                {{0u, *storage_engine_, container_reference}}),
+            status::success);
+    }
+
+    void
+    TearDown() override
+    {
+        container_.reset();
+        data_partition_provider_.reset();
+        std::filesystem::remove_all(storage_configuration_.kv_store_path_);
+    }
+
+    //
+    // Creates the storage engine of the test data partition.
+    // Overridden by the tests which need to inject storage engine failures.
+    //
+    virtual
+    std::unique_ptr<storage::storage_engine>
+    create_storage_engine()
+    {
+        return std::make_unique<storage::storage_engine>();
+    }
+
+    //
+    // Creates the IO task of an object of a batch request on the test container.
+    //
+    storage::object_io_task
+    create_object_io_task(
+        const std::string& object_id,
+        const std::string& object_data,
+        const schemas::object_request_optype optype,
+        const std::chrono::steady_clock::time_point deadline,
+        std::shared_ptr<storage::object_batch_context> batch_context,
+        const std::size_t batch_index)
+    {
+        return storage::object_io_task{
+            0u,
+            schemas::object_request{
+                std::string{object_id},
+                storage::byte_stream{object_data},
+                "Container",
+                optype,
+                deadline,
+                std::chrono::steady_clock::now()},
+            container_,
+            std::move(batch_context),
+            batch_index};
+    }
+
+    //
+    // Creates a batch context which hands the body of its response over to the given promise.
+    //
+    static
+    std::shared_ptr<storage::object_batch_context>
+    create_batch_context(
+        const std::size_t number_objects,
+        const bool includes_object_data,
+        std::promise<std::string>& response_body)
+    {
+        return std::make_shared<storage::object_batch_context>(
+            number_objects,
+            includes_object_data,
+            [&response_body](const drogon::HttpResponsePtr& response)
+            {
+                response_body.set_value(std::string{response->getBody()});
+            });
+    }
+
+    //
+    // Gets an object of the test container straight from the storage engine.
+    //
+    status::status_code
+    get_stored_object(
+        const std::string& object_id,
+        storage::byte_stream* object_data)
+    {
+        return storage_engine_->get_object(
+            container_->get_engine_reference(0u),
+            object_id.c_str(),
+            object_data);
+    }
+
+    //
+    // Gets the value of a statistics ticker of the storage engine.
+    //
+    std::uint64_t
+    get_ticker_count(
+        const rocksdb::Tickers ticker) const
+    {
+        return statistics_->getTickerCount(ticker);
+    }
+
+    //
+    // Maximum time to wait for the response of the dispatched operations.
+    //
+    static constexpr std::chrono::seconds k_response_timeout{10u};
+
+    //
+    // Configurations of the test data partition.
+    //
+    storage::storage_configuration storage_configuration_;
+
+    //
+    // Statistics of the storage engine, used for counting its calls.
+    //
+    std::shared_ptr<rocksdb::Statistics> statistics_ = rocksdb::CreateDBStatistics();
+
+    //
+    // Storage engine of the test data partition, owned by the data partition provider.
+    //
+    storage::storage_engine* storage_engine_ = nullptr;
+
+    //
+    // Provider of the test data partition.
+    //
+    std::unique_ptr<storage::data_partition_provider> data_partition_provider_;
+
+    //
+    // Frontline cache filled by the completed operations.
+    //
+    storage::container_index container_index_{1u};
+    storage::frontline_cache frontline_cache_{
+        1u,
+        1'024u * 1'024u,
+        1'024u,
+        storage::cache_eviction_policy::lru,
+        false /* admission_enabled */,
+        0u /* max_number_negative_entries_per_shard */,
+        0u /* negative_entry_ttl_ms */,
+        container_index_};
+    storage::cache_accessor cache_accessor_{frontline_cache_};
+
+    //
+    // Object container the operations target.
+    //
+    std::shared_ptr<storage::container> container_;
+};
+
+} // namespace tests.
+} // namespace pandora.
@@ -0,0 +1,383 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'io_dispatcher_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the coalescing of the read IO
+//      dispatcher into storage engine multi-gets and for
+//      the group commit of the write IO dispatcher.
+// ****************************************************
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <stop_token>
+#include <gtest/gtest.h>
+#include <rocksdb/statistics.h>
+#include "io_dispatcher_fixture.hh"
+#include "core/status/status.hh"
+#include "core/storage/io/read_io_executor.hh"
+#include "core/storage/io/read_io_dispatcher.hh"
+#include "core/storage/io/write_io_dispatcher.hh"
+#include "core/common/work_stealing_thread_pool.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+class io_dispatcher_unit_tests : public io_dispatcher_fixture
+{
+protected:
+
+    //
+    // Runs insertions of the given {ObjectId, ObjectData} pairs, all part of the same batch request,
+    // through a write IO dispatcher with the given batch limits. Gets the body of the batch response.
+    // The tasks are enqueued before the dispatcher starts, so they are all ready for its first batch.
+    //
+    std::string
+    execute_object_insertions(
+        const std::uint32_t write_io_batch_max_number_tasks,
+        const std::uint64_t write_io_batch_max_size_bytes,
+        const std::vector<std::pair<std::string, std::string>>& objects)
+    {
+        storage::write_io_dispatcher write_io_dispatcher{
+            0u,
+            write_io_batch_max_number_tasks,
+            write_io_batch_max_size_bytes,
+            0u,
+            1'024u,
+            1'024u * 1'024u,
+            *data_partition_provider_,
+            cache_accessor_};
+
+        std::promise<std::string> response_body;
+        auto batch_context = create_batch_context(objects.size(), false, response_body);
+        std::vector<storage::object_io_task> write_io_tasks;
+        std::uint64_t write_io_tasks_size_bytes = 0u;
+
+        for (std::size_t index = 0u; index < objects.size(); ++index)
+        {
+            write_io_tasks.push_back(create_object_io_task(
+                objects[index].first,
+                objects[index].second,
+                schemas::object_request_optype::insert,
+                std::chrono::steady_clock::time_point::max(),
+                batch_context,
+                index));
+            write_io_tasks_size_bytes += storage::write_io_dispatcher::get_write_io_task_size_bytes(
+                write_io_tasks.back().object_request_);
+        }
+
+        batch_context.reset();
+
+        EXPECT_EQ(write_io_dispatcher.try_admit_io_tasks(write_io_tasks.size(), write_io_tasks_size_bytes), status::success);
+        write_io_dispatcher.enqueue_io_tasks(std::move(write_io_tasks));
+
+        std::stop_source stop_source;
+        write_io_dispatcher.start(stop_source.get_token());
+
+        std::future<std::string> response_body_future = response_body.get_future();
+        const bool is_response_ready = response_body_future.wait_for(k_response_timeout) == std::future_status::ready;
+        stop_source.request_stop();
+        write_io_dispatcher.wait_for_stop();
+
+        EXPECT_TRUE(is_response_ready);
+
+        return is_response_ready ? response_body_future.get() : std::string{};
+    }
+
+    //
+    // Gets an object of the test container from the frontline cache, or null if not cached.
+    //
+    storage::shared_byte_stream
+    get_cached_object(
+        const std::string& object_id)
+    {
+        return frontline_cache_.get(
+            object_id,
+            "Container");
+    }
+};
+
+//
+// Storage engine whose write batch commits always fail.
+//
+class commit_failing_storage_engine : public storage::storage_engine
+{
+public:
+
+    status::status_code
+    commit_write_batch(
+        storage::storage_engine_write_batch* write_batch) override
+    {
+        return status::object_write_batch_failed;
+    }
+};
+
+class io_dispatcher_commit_failure_unit_tests : public io_dispatcher_unit_tests
+{
+protected:
+
+    std::unique_ptr<storage::storage_engine>
+    create_storage_engine() override
+    {
+        return std::make_unique<commit_failing_storage_engine>();
+    }
+};
+
+TEST_F(
+    io_dispatcher_unit_tests,
+    read_dispatcher_coalesces_reads_within_batching_window)
+{
+    for (const char* object_id : {"Object0", "Object1", "Object2"})
+    {
+        ASSERT_EQ(
+            storage_engine_->insert_object(container_->get_engine_reference(0u), object_id, object_id),
+            status::success);
+    }
+
+    //
+    // The reads arrive one by one while the batching window is open,
+    // so they must all be served by the same multi-get.
+    //
+    common::work_stealing_thread_pool read_io_thread_pool{1u, "pandora_read"};
+    storage::read_io_dispatcher read_io_dispatcher{
+        0u,
+        16u,
+        200'000u /* read_io_batch_max_wait_time_us */,
+        read_io_thread_pool,
+        std::make_unique<storage::read_io_executor>(*data_partition_provider_),
+        cache_accessor_};
+
+    std::promise<std::string> response_body;
+    auto batch_context = create_batch_context(3u, true, response_body);
+    std::size_t batch_index = 0u;
+
+    for (const char* object_id : {"Object0", "Object1", "Object2"})
+    {
+        read_io_dispatcher.enqueue_io_task(create_object_io_task(
+            object_id,
+            "",
+            schemas::object_request_optype::get,
+            std::chrono::steady_clock::time_point::max(),
+            batch_context,
+            batch_index++));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10u));
+    }
+
+    batch_context.reset();
+
+    std::future<std::string> response_body_future = response_body.get_future();
+    ASSERT_EQ(response_body_future.wait_for(k_response_timeout), std::future_status::ready);
+    read_io_dispatcher.wait_for_stop();
+
+    EXPECT_EQ(
+        response_body_future.get(),
+        "{\"internal_status_code\":\"0x0\",\"objects\":["
+        "{\"internal_status_code\":\"0x0\",\"object_data\":\"Object0\"},"
+        "{\"internal_status_code\":\"0x0\",\"object_data\":\"Object1\"},"
+        "{\"internal_status_code\":\"0x0\",\"object_data\":\"Object2\"}]}");
+    EXPECT_EQ(get_ticker_count(rocksdb::NUMBER_MULTIGET_CALLS), 1u);
+    EXPECT_EQ(get_ticker_count(rocksdb::NUMBER_MULTIGET_KEYS_READ), 3u);
+}
+
+TEST_F(
+    io_dispatcher_unit_tests,
+    read_dispatcher_closes_batching_window_on_full_batch)
+{
+    for (const char* object_id : {"Object0", "Object1"})
+    {
+        ASSERT_EQ(
+            storage_engine_->insert_object(container_->get_engine_reference(0u), object_id, object_id),
+            status::success);
+    }
+
+    //
+    // The batching window outlasts the response timeout,
+    // so the reads are only served once the full batch wakes up the drain owner.
+    //
+    common::work_stealing_thread_pool read_io_thread_pool{1u, "pandora_read"};
+    storage::read_io_dispatcher read_io_dispatcher{
+        0u,
+        2u,
+        60'000'000u /* read_io_batch_max_wait_time_us */,
+        read_io_thread_pool,
+        std::make_unique<storage::read_io_executor>(*data_partition_provider_),
+        cache_accessor_};
+
+    std::promise<std::string> response_body;
+    auto batch_context = create_batch_context(2u, true, response_body);
+    read_io_dispatcher.enqueue_io_task(create_object_io_task(
+        "Object0",
+        "",
+        schemas::object_request_optype::get,
+        std::chrono::steady_clock::time_point::max(),
+        batch_context,
+        0u));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10u));
+
+    read_io_dispatcher.enqueue_io_task(create_object_io_task(
+        "Object1",
+        "",
+        schemas::object_request_optype::get,
+        std::chrono::steady_clock::time_point::max(),
+        batch_context,
+        1u));
+    batch_context.reset();
+
+    std::future<std::string> response_body_future = response_body.get_future();
+    ASSERT_EQ(response_body_future.wait_for(k_response_timeout), std::future_status::ready);
+    read_io_dispatcher.wait_for_stop();
+
+    EXPECT_EQ(
+        response_body_future.get(),
+        "{\"internal_status_code\":\"0x0\",\"objects\":["
+        "{\"internal_status_code\":\"0x0\",\"object_data\":\"Object0\"},"
+        "{\"internal_status_code\":\"0x0\",\"object_data\":\"Object1\"}]}");
+    EXPECT_EQ(get_ticker_count(rocksdb::NUMBER_MULTIGET_CALLS), 1u);
+}
+
+TEST_F(
+    io_dispatcher_unit_tests,
+    write_dispatcher_group_commits_batch)
+{
+    const std::uint64_t number_commits = get_ticker_count(rocksdb::WRITE_DONE_BY_SELF);
+
+    EXPECT_EQ(
+        execute_object_insertions(
+            16u,
+            1'024u * 1'024u,
+            {{"Object0", "Data0"}, {"Object1", "Data1"}, {"Object2", "Data2"}}),
+        "{\"internal_status_code\":\"0x0\",\"objects\":["
+        "{\"internal_status_code\":\"0x0\"},"
+        "{\"internal_status_code\":\"0x0\"},"
+        "{\"internal_status_code\":\"0x0\"}]}");
+
+    //
+    // Every insertion of the batch is applied through a single write batch commit.
+    //
+    EXPECT_EQ(get_ticker_count(rocksdb::WRITE_DONE_BY_SELF) - number_commits, 1u);
+    EXPECT_EQ(get_ticker_count(rocksdb::NUMBER_KEYS_WRITTEN), 3u);
+
+    for (const std::string object_id : {"Object0", "Object1", "Object2"})
+    {
+        const std::string object_data = "Data" + object_id.substr(object_id.size() - 1u);
+        storage::byte_stream stored_object_data;
+        EXPECT_EQ(get_stored_object(object_id, &stored_object_data), status::success);
+        EXPECT_EQ(stored_object_data, object_data);
+
+        const storage::shared_byte_stream cached_object_data = get_cached_object(object_id);
+        ASSERT_NE(cached_object_data, nullptr);
+        EXPECT_EQ(*cached_object_data, object_data);
+    }
+}
+
+TEST_F(
+    io_dispatcher_unit_tests,
+    write_dispatcher_carries_over_tasks_past_batch_size_limit)
+{
+    const std::uint64_t number_commits = get_ticker_count(rocksdb::WRITE_DONE_BY_SELF);
+
+    //
+    // Every insertion holds 11 bytes, so only two of them fit in a write batch. The tasks
+    // past the cut are carried over to the next batches, still applied in their original order.
+    //
+    EXPECT_EQ(
+        execute_object_insertions(
+            16u,
+            25u,
+            {{"Object0", "Data"}, {"Object1", "Data"}, {"Object2", "Data"}, {"Object3", "Data"}, {"Object0", "Last"}}),
+        "{\"internal_status_code\":\"0x0\",\"objects\":["
+        "{\"internal_status_code\":\"0x0\"},"
+        "{\"internal_status_code\":\"0x0\"},"
+        "{\"internal_status_code\":\"0x0\"},"
+        "{\"internal_status_code\":\"0x0\"},"
+        "{\"internal_status_code\":\"0x0\"}]}");
+
+    EXPECT_EQ(get_ticker_count(rocksdb::WRITE_DONE_BY_SELF) - number_commits, 3u);
+
+    storage::byte_stream stored_object_data;
+    EXPECT_EQ(get_stored_object("Object0", &stored_object_data), status::success);
+    EXPECT_EQ(stored_object_data, "Last");
+    EXPECT_EQ(get_stored_object("Object3", &stored_object_data), status::success);
+    EXPECT_EQ(stored_object_data, "Data");
+
+    const storage::shared_byte_stream cached_object_data = get_cached_object("Object0");
+    ASSERT_NE(cached_object_data, nullptr);
+    EXPECT_EQ(*cached_object_data, "Last");
+}
+
+TEST_F(
+    io_dispatcher_unit_tests,
+    write_dispatcher_splits_batches_at_number_tasks_limit)
+{
+    const std::uint64_t number_commits = get_ticker_count(rocksdb::WRITE_DONE_BY_SELF);
+
+    EXPECT_EQ(
+        execute_object_insertions(
+            2u,
+            1'024u * 1'024u,
+            {{"Object0", "Data"}, {"Object1", "Data"}, {"Object2", "Data"}, {"Object3", "Data"}, {"Object0", "Last"}}),
+        "{\"internal_status_code\":\"0x0\",\"objects\":["
+        "{\"internal_status_code\":\"0x0\"},"
+        "{\"internal_status_code\":\"0x0\"},"
+        "{\"internal_status_code\":\"0x0\"},"
+        "{\"internal_status_code\":\"0x0\"},"
+        "{\"internal_status_code\":\"0x0\"}]}");
+
+    EXPECT_EQ(get_ticker_count(rocksdb::WRITE_DONE_BY_SELF) - number_commits, 3u);
+
+    storage::byte_stream stored_object_data;
+    EXPECT_EQ(get_stored_object("Object0", &stored_object_data), status::success);
+    EXPECT_EQ(stored_object_data, "Last");
+}
+
+TEST_F(
+    io_dispatcher_commit_failure_unit_tests,
+    write_dispatcher_fails_every_staged_task_on_commit_failure)
+{
+    ASSERT_EQ(
+        storage_engine_->insert_object(container_->get_engine_reference(0u), "Object0", "Old"),
+        status::success);
+    ASSERT_EQ(
+        frontline_cache_.put("Object0", std::make_shared<const storage::byte_stream>("Old"), "Container"),
+        status::success);
+
+    EXPECT_EQ(
+        execute_object_insertions(
+            16u,
+            1'024u * 1'024u,
+            {{"Object0", "New"}, {"Object1", "Data"}}),
+        "{\"internal_status_code\":\"0x0\",\"objects\":["
+        "{\"internal_status_code\":\"0x8000001d\"},"
+        "{\"internal_status_code\":\"0x8000001d\"}]}");
+
+    //
+    // Nothing of the failed write batch may be visible, neither in the storage engine nor in the cache.
+    //
+    storage::byte_stream stored_object_data;
+    EXPECT_EQ(get_stored_object("Object0", &stored_object_data), status::success);
+    EXPECT_EQ(stored_object_data, "Old");
+    EXPECT_EQ(get_stored_object("Object1", &stored_object_data), status::object_not_found);
+
+    const storage::shared_byte_stream cached_object_data = get_cached_object("Object0");
+    ASSERT_NE(cached_object_data, nullptr);
+    EXPECT_EQ(*cached_object_data, "Old");
+    EXPECT_EQ(get_cached_object("Object1"), nullptr);
+}
+
+} // namespace tests.
+} // namespace pandora.
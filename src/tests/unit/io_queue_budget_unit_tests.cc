@@ -0,0 +1,74 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'io_queue_budget_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the IO queue budget component.
+// ****************************************************
+
+#include <gtest/gtest.h>
+#include "core/storage/io/io_queue_budget.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+TEST(
+    io_queue_budget_unit_tests,
+    rejects_tasks_over_the_limits)
+{
+    storage::io_queue_budget budget{3u, 100u};
+
+    EXPECT_TRUE(budget.try_acquire(2u, 40u));
+    EXPECT_FALSE(budget.try_acquire(2u, 10u));
+    EXPECT_FALSE(budget.try_acquire(1u, 61u));
+    EXPECT_TRUE(budget.try_acquire(1u, 60u));
+
+    EXPECT_EQ(budget.get_number_tasks(), 3u);
+    EXPECT_EQ(budget.get_size_bytes(), 100u);
+
+    budget.release(2u, 40u);
+
+    EXPECT_TRUE(budget.try_acquire(1u, 40u));
+    EXPECT_EQ(budget.get_number_tasks(), 2u);
+    EXPECT_EQ(budget.get_size_bytes(), 100u);
+}
+
+TEST(
+    io_queue_budget_unit_tests,
+    admits_oversized_tasks_into_an_empty_queue)
+{
+    storage::io_queue_budget budget{3u, 100u};
+
+    EXPECT_TRUE(budget.try_acquire(5u, 500u));
+    EXPECT_FALSE(budget.try_acquire(1u, 1u));
+
+    budget.release(5u, 500u);
+
+    EXPECT_TRUE(budget.try_acquire(1u, 1u));
+}
+
+TEST(
+    io_queue_budget_unit_tests,
+    zero_limits_are_unbounded)
+{
+    storage::io_queue_budget budget{0u, 0u};
+
+    for (std::uint32_t iteration = 0u; iteration < 1'000u; ++iteration)
+    {
+        EXPECT_TRUE(budget.try_acquire(1u, 1'024u));
+    }
+
+    EXPECT_EQ(budget.get_number_tasks(), 1'000u);
+    EXPECT_EQ(budget.get_size_bytes(), 1'024'000u);
+}
+
+} // namespace tests.
+} // namespace pandora.
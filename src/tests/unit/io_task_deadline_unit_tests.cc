@@ -0,0 +1,201 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'io_task_deadline_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the client deadlines of object
+//      operations and for the IO dispatchers dropping
+//      the operations whose deadline has passed.
+// ****************************************************
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+#include <optional>
+#include <stop_token>
+#include <gtest/gtest.h>
+#include <drogon/drogon.h>
+#include "io_dispatcher_fixture.hh"
+#include "core/status/status.hh"
+#include "core/storage/io/read_io_executor.hh"
+#include "core/storage/io/read_io_dispatcher.hh"
+#include "core/storage/io/write_io_dispatcher.hh"
+#include "core/common/work_stealing_thread_pool.hh"
+#include "core/schemas/request-interfaces/object_request.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+//
+// Gets the deadline of a request carrying the given deadline header value, if any.
+//
+std::chrono::steady_clock::time_point
+get_deadline_from_header(
+    const std::optional<std::string>& deadline_header)
+{
+    auto request = drogon::HttpRequest::newHttpRequest();
+    request->setMethod(drogon::Get);
+
+    if (deadline_header.has_value())
+    {
+        request->addHeader(schemas::object_request::deadline_header_tag, deadline_header.value());
+    }
+
+    return schemas::object_request::get_deadline_from_request(request);
+}
+
+TEST(
+    io_task_deadline_unit_tests,
+    deadline_header_is_relative_to_reception)
+{
+    const auto before_parse_time = std::chrono::steady_clock::now();
+    const auto deadline = get_deadline_from_header("250");
+    const auto after_parse_time = std::chrono::steady_clock::now();
+
+    EXPECT_GE(deadline, before_parse_time + std::chrono::milliseconds(250u));
+    EXPECT_LE(deadline, after_parse_time + std::chrono::milliseconds(250u));
+}
+
+TEST(
+    io_task_deadline_unit_tests,
+    missing_or_malformed_deadline_header_never_expires)
+{
+    EXPECT_EQ(get_deadline_from_header(std::nullopt), std::chrono::steady_clock::time_point::max());
+
+    for (const std::string deadline_header : {"", "0", "-5", "+5", "12ms", "1.5", " 12", "4294967296"})
+    {
+        EXPECT_EQ(
+            get_deadline_from_header(deadline_header),
+            std::chrono::steady_clock::time_point::max()) << deadline_header;
+    }
+}
+
+class io_task_deadline_dispatcher_unit_tests : public io_dispatcher_fixture
+{};
+
+TEST_F(
+    io_task_deadline_dispatcher_unit_tests,
+    write_dispatcher_drops_expired_writes)
+{
+    storage::write_io_dispatcher write_io_dispatcher{
+        0u,
+        16u,
+        1'024u * 1'024u,
+        0u,
+        1'024u,
+        1'024u * 1'024u,
+        *data_partition_provider_,
+        cache_accessor_};
+    std::stop_source stop_source;
+    write_io_dispatcher.start(stop_source.get_token());
+
+    std::promise<std::string> response_body;
+    auto batch_context = create_batch_context(2u, false, response_body);
+    std::vector<storage::object_io_task> write_io_tasks;
+    write_io_tasks.push_back(create_object_io_task(
+        "ExpiredObject",
+        "Data",
+        schemas::object_request_optype::insert,
+        std::chrono::steady_clock::now() - std::chrono::milliseconds(1u),
+        batch_context,
+        0u));
+    write_io_tasks.push_back(create_object_io_task(
+        "Object",
+        "Data",
+        schemas::object_request_optype::insert,
+        std::chrono::steady_clock::time_point::max(),
+        batch_context,
+        1u));
+    batch_context.reset();
+
+    std::uint64_t write_io_tasks_size_bytes = 0u;
+    for (const storage::object_io_task& write_io_task : write_io_tasks)
+    {
+        write_io_tasks_size_bytes += storage::write_io_dispatcher::get_write_io_task_size_bytes(
+            write_io_task.object_request_);
+    }
+
+    ASSERT_EQ(write_io_dispatcher.try_admit_io_tasks(write_io_tasks.size(), write_io_tasks_size_bytes), status::success);
+    write_io_dispatcher.enqueue_io_tasks(std::move(write_io_tasks));
+
+    std::future<std::string> response_body_future = response_body.get_future();
+    ASSERT_EQ(response_body_future.wait_for(k_response_timeout), std::future_status::ready);
+    stop_source.request_stop();
+    write_io_dispatcher.wait_for_stop();
+
+    EXPECT_EQ(
+        response_body_future.get(),
+        "{\"internal_status_code\":\"0x0\",\"objects\":["
+        "{\"internal_status_code\":\"0x80000031\"},"
+        "{\"internal_status_code\":\"0x0\"}]}");
+
+    //
+    // The expired write must never reach the storage engine.
+    //
+    storage::byte_stream object_data;
+    EXPECT_EQ(get_stored_object("ExpiredObject", &object_data), status::object_not_found);
+    EXPECT_EQ(get_stored_object("Object", &object_data), status::success);
+    EXPECT_EQ(object_data, "Data");
+}
+
+TEST_F(
+    io_task_deadline_dispatcher_unit_tests,
+    read_dispatcher_drops_expired_reads)
+{
+    ASSERT_EQ(
+        storage_engine_->insert_object(container_->get_engine_reference(0u), "Object", "Data"),
+        status::success);
+
+    common::work_stealing_thread_pool read_io_thread_pool{1u, "pandora_read"};
+    storage::read_io_dispatcher read_io_dispatcher{
+        0u,
+        16u,
+        0u,
+        read_io_thread_pool,
+        std::make_unique<storage::read_io_executor>(*data_partition_provider_),
+        cache_accessor_};
+
+    std::promise<std::string> response_body;
+    auto batch_context = create_batch_context(2u, true, response_body);
+    std::vector<storage::object_io_task> read_io_tasks;
+    read_io_tasks.push_back(create_object_io_task(
+        "Object",
+        "",
+        schemas::object_request_optype::get,
+        std::chrono::steady_clock::now() - std::chrono::milliseconds(1u),
+        batch_context,
+        0u));
+    read_io_tasks.push_back(create_object_io_task(
+        "Object",
+        "",
+        schemas::object_request_optype::get,
+        std::chrono::steady_clock::time_point::max(),
+        batch_context,
+        1u));
+    batch_context.reset();
+
+    read_io_dispatcher.enqueue_io_tasks(std::move(read_io_tasks));
+
+    std::future<std::string> response_body_future = response_body.get_future();
+    ASSERT_EQ(response_body_future.wait_for(k_response_timeout), std::future_status::ready);
+    read_io_dispatcher.wait_for_stop();
+
+    EXPECT_EQ(
+        response_body_future.get(),
+        "{\"internal_status_code\":\"0x0\",\"objects\":["
+        "{\"internal_status_code\":\"0x80000031\"},"
+        "{\"internal_status_code\":\"0x0\",\"object_data\":\"Data\"}]}");
+}
+
+} // namespace tests.
+} // namespace pandora.
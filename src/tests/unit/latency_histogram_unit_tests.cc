@@ -0,0 +1,78 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'latency_histogram_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the latency histogram component.
+// ****************************************************
+
+#include <gtest/gtest.h>
+#include "core/metrics/latency_histogram.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+TEST(
+    latency_histogram_unit_tests,
+    buckets_are_upper_inclusive)
+{
+    using metrics::latency_histogram;
+
+    EXPECT_EQ(latency_histogram::get_bucket_index(0u), 0u);
+    EXPECT_EQ(latency_histogram::get_bucket_index(1'024u), 0u);
+    EXPECT_EQ(latency_histogram::get_bucket_index(1'025u), 1u);
+
+    for (std::size_t bucket_index = 0u; bucket_index < latency_histogram::k_number_buckets - 1u; ++bucket_index)
+    {
+        const std::uint64_t upper_bound_ns = latency_histogram::get_bucket_upper_bound_ns(bucket_index);
+        EXPECT_EQ(latency_histogram::get_bucket_index(upper_bound_ns), bucket_index);
+        EXPECT_EQ(latency_histogram::get_bucket_index(upper_bound_ns + 1u), bucket_index + 1u);
+    }
+}
+
+TEST(
+    latency_histogram_unit_tests,
+    bucket_bounds_are_within_a_quarter)
+{
+    using metrics::latency_histogram;
+
+    //
+    // Four sub-buckets per power of two bound every bucket width to a quarter of its lower bound.
+    //
+    for (std::size_t bucket_index = 1u; bucket_index < latency_histogram::k_number_buckets - 1u; ++bucket_index)
+    {
+        const std::uint64_t lower_bound_ns = latency_histogram::get_bucket_upper_bound_ns(bucket_index - 1u);
+        const std::uint64_t upper_bound_ns = latency_histogram::get_bucket_upper_bound_ns(bucket_index);
+        EXPECT_GT(upper_bound_ns, lower_bound_ns);
+        EXPECT_LE((upper_bound_ns - lower_bound_ns) * 4u, lower_bound_ns);
+    }
+
+    EXPECT_EQ(latency_histogram::get_bucket_index(std::uint64_t{1u} << 40u), latency_histogram::k_number_buckets - 1u);
+}
+
+TEST(
+    latency_histogram_unit_tests,
+    snapshot_sums_recorded_latencies)
+{
+    metrics::latency_histogram histogram;
+    histogram.record(500u);
+    histogram.record(500u);
+    histogram.record(3'000u);
+
+    const metrics::latency_histogram_snapshot snapshot = histogram.get_snapshot();
+    EXPECT_EQ(snapshot.count_, 3u);
+    EXPECT_EQ(snapshot.sum_ns_, 4'000u);
+    EXPECT_EQ(snapshot.bucket_counts_[0u], 2u);
+    EXPECT_EQ(snapshot.bucket_counts_[metrics::latency_histogram::get_bucket_index(3'000u)], 1u);
+}
+
+} // namespace tests.
+} // namespace pandora.
@@ -0,0 +1,94 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'log_levels_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the log levels component.
+// ****************************************************
+
+#include <gtest/gtest.h>
+#include "core/logger/log_levels.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+TEST(
+    log_levels_unit_tests,
+    subsystem_follows_source_file_path)
+{
+    static_assert(
+        logger::get_log_subsystem_from_path("/pandora/src/core/storage/cache/cache_shard.cc") ==
+        logger::log_subsystem::cache);
+
+    EXPECT_EQ(
+        logger::get_log_subsystem_from_path("/pandora/src/core/network/server/server.cc"),
+        logger::log_subsystem::network);
+    EXPECT_EQ(
+        logger::get_log_subsystem_from_path("/pandora/src/core/storage/io/read_io_executor.cc"),
+        logger::log_subsystem::io);
+    EXPECT_EQ(
+        logger::get_log_subsystem_from_path("/pandora/src/core/startup/system_init.cc"),
+        logger::log_subsystem::general);
+    EXPECT_EQ(
+        logger::get_log_subsystem_from_path("src/core/storage/gc/garbage_collector.cc"),
+        logger::log_subsystem::gc);
+}
+
+TEST(
+    log_levels_unit_tests,
+    subsystem_ignores_checkout_directory)
+{
+    //
+    // Only the path under the core source directory is matched,
+    // whatever the directories the repository is checked out in.
+    //
+    EXPECT_EQ(
+        logger::get_log_subsystem_from_path("/mnt/network/pandora/src/core/startup/system_init.cc"),
+        logger::log_subsystem::general);
+    EXPECT_EQ(
+        logger::get_log_subsystem_from_path("/srv/storage/io/pandora/src/core/storage/cache/cache_shard.cc"),
+        logger::log_subsystem::cache);
+    EXPECT_EQ(
+        logger::get_log_subsystem_from_path("/pandora/src/tests/unit/network/server_tests.cc"),
+        logger::log_subsystem::general);
+    EXPECT_EQ(
+        logger::get_log_subsystem_from_path("/pandora/mysrc/core/network/server.cc"),
+        logger::log_subsystem::general);
+}
+
+TEST(
+    log_levels_unit_tests,
+    names_are_parsed)
+{
+    EXPECT_EQ(logger::get_log_subsystem_from_name("gc"), logger::log_subsystem::gc);
+    EXPECT_FALSE(logger::get_log_subsystem_from_name("storage").has_value());
+    EXPECT_EQ(logger::get_log_level_from_name("error"), logger::log_level::error);
+    EXPECT_FALSE(logger::get_log_level_from_name("warning").has_value());
+}
+
+TEST(
+    log_levels_unit_tests,
+    levels_are_set_per_subsystem)
+{
+    logger::log_levels::set_level(logger::log_level::info);
+    logger::log_levels::set_level(logger::log_subsystem::cache, logger::log_level::error);
+
+    EXPECT_FALSE(logger::log_levels::is_enabled(logger::log_subsystem::cache, logger::log_level::warn));
+    EXPECT_TRUE(logger::log_levels::is_enabled(logger::log_subsystem::cache, logger::log_level::error));
+    EXPECT_TRUE(logger::log_levels::is_enabled(logger::log_subsystem::io, logger::log_level::info));
+    EXPECT_FALSE(logger::log_levels::is_enabled(logger::log_subsystem::io, logger::log_level::debug));
+
+    logger::log_levels::set_level(logger::log_level::info);
+    EXPECT_EQ(logger::log_levels::get_level(logger::log_subsystem::cache), logger::log_level::info);
+}
+
+} // namespace tests.
+} // namespace pandora.
@@ -0,0 +1,58 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'log_sampling_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the log sampling component.
+// ****************************************************
+
+#include <gtest/gtest.h>
+#include "core/logger/log_sampling.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+TEST(
+    log_sampling_unit_tests,
+    sampler_admits_one_out_of_rate)
+{
+    logger::log_sampler sampler{10u};
+    std::uint32_t number_admitted_log_lines = 0u;
+
+    for (std::uint32_t iteration = 0u; iteration < 100u; ++iteration)
+    {
+        number_admitted_log_lines += sampler.is_admitted() ? 1u : 0u;
+    }
+
+    EXPECT_EQ(number_admitted_log_lines, 10u);
+}
+
+TEST(
+    log_sampling_unit_tests,
+    rate_limiter_admits_up_to_one_second_of_log_lines)
+{
+    //
+    // A burst is admitted up to the bucket capacity, which is far
+    // larger than what refills while the loop is running.
+    //
+    logger::log_rate_limiter rate_limiter{5u};
+    std::uint32_t number_admitted_log_lines = 0u;
+
+    for (std::uint32_t iteration = 0u; iteration < 100u; ++iteration)
+    {
+        number_admitted_log_lines += rate_limiter.is_admitted() ? 1u : 0u;
+    }
+
+    EXPECT_EQ(number_admitted_log_lines, 5u);
+}
+
+} // namespace tests.
+} // namespace pandora.
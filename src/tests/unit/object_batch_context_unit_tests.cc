@@ -0,0 +1,123 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'object_batch_context_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the object batch context component.
+// ****************************************************
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#include <gtest/gtest.h>
+#include "core/storage/models/object_batch_context.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+TEST(
+    object_batch_context_unit_tests,
+    responds_once_in_request_order)
+{
+    std::size_t number_responses = 0u;
+    std::string response_body;
+    auto batch_context = std::make_shared<storage::object_batch_context>(
+        3u,
+        true /* includes_object_data */,
+        [&](const drogon::HttpResponsePtr& response)
+        {
+            ++number_responses;
+            response_body = std::string{response->getBody()};
+        });
+
+    const storage::byte_stream first_object_data{"first"};
+    const storage::byte_stream third_object_data{"th\"ird"};
+
+    //
+    // Objects complete out of order and only the last completion replies.
+    //
+    batch_context->complete_object(2u, status::success, third_object_data);
+    batch_context->complete_object(1u, status::object_retrieval_failed);
+    EXPECT_EQ(number_responses, 0u);
+    batch_context->complete_object(0u, status::success, first_object_data);
+    EXPECT_EQ(number_responses, 1u);
+
+    EXPECT_EQ(
+        response_body,
+        "{\"internal_status_code\":\"0x0\",\"objects\":["
+        "{\"internal_status_code\":\"0x0\",\"object_data\":\"first\"},"
+        "{\"internal_status_code\":\"0x80000006\"},"
+        "{\"internal_status_code\":\"0x0\",\"object_data\":\"th\\\"ird\"}]}");
+}
+
+TEST(
+    object_batch_context_unit_tests,
+    fails_objects_not_representable_in_json)
+{
+    std::string response_body;
+    auto batch_context = std::make_shared<storage::object_batch_context>(
+        2u,
+        true /* includes_object_data */,
+        [&](const drogon::HttpResponsePtr& response)
+        {
+            response_body = std::string{response->getBody()};
+        });
+
+    //
+    // Data stored over the binary transport which is not valid UTF-8
+    // fails its own object only, and is never altered.
+    //
+    const storage::byte_stream binary_object_data{"a\xff" "b"};
+    const storage::byte_stream text_object_data{"text"};
+    batch_context->complete_object(0u, status::success, binary_object_data);
+    batch_context->complete_object(1u, status::success, text_object_data);
+
+    EXPECT_EQ(
+        response_body,
+        "{\"internal_status_code\":\"0x0\",\"objects\":["
+        "{\"internal_status_code\":\"0x80000033\"},"
+        "{\"internal_status_code\":\"0x0\",\"object_data\":\"text\"}]}");
+}
+
+TEST(
+    object_batch_context_unit_tests,
+    concurrent_completions_respond_once)
+{
+    constexpr std::size_t k_number_objects = 1'024u;
+    std::atomic<std::size_t> number_responses{0u};
+    auto batch_context = std::make_shared<storage::object_batch_context>(
+        k_number_objects,
+        false /* includes_object_data */,
+        [&](const drogon::HttpResponsePtr&)
+        {
+            number_responses.fetch_add(1u);
+        });
+
+    std::vector<std::jthread> threads;
+    for (std::size_t thread_index = 0u; thread_index < 4u; ++thread_index)
+    {
+        threads.emplace_back(
+            [&, thread_index]()
+            {
+                for (std::size_t index = thread_index; index < k_number_objects; index += 4u)
+                {
+                    batch_context->complete_object(index, status::success);
+                }
+            });
+    }
+
+    threads.clear();
+    EXPECT_EQ(number_responses.load(), 1u);
+}
+
+} // namespace tests.
+} // namespace pandora.
@@ -0,0 +1,130 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'response_utilities_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the server response utilities.
+// ****************************************************
+
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+#include "core/common/response_utilities.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+//
+// Gets the given value as a JSON string through the response utilities.
+//
+std::string
+to_json_string(
+    std::string_view value)
+{
+    std::string buffer;
+    common::response_utilities::append_json_string(
+        buffer,
+        value);
+
+    return buffer;
+}
+
+TEST(
+    response_utilities_unit_tests,
+    status_goes_before_fields)
+{
+    EXPECT_EQ(
+        common::response_utilities::generate_server_json_response(status::success),
+        "{\"internal_status_code\":\"0x0\"}");
+
+    EXPECT_EQ(
+        common::response_utilities::generate_server_json_response(
+            status::fail,
+            {{"object_data", "value"}}),
+        "{\"internal_status_code\":\"0x80000001\",\"object_data\":\"value\"}");
+}
+
+TEST(
+    response_utilities_unit_tests,
+    escapes_special_characters)
+{
+    EXPECT_EQ(to_json_string(""), "\"\"");
+    EXPECT_EQ(to_json_string("a\"b\\c/d"), "\"a\\\"b\\\\c/d\"");
+    EXPECT_EQ(to_json_string("\b\f\n\r\t"), "\"\\b\\f\\n\\r\\t\"");
+    EXPECT_EQ(to_json_string(std::string_view{"\x00\x1f\x7f", 3u}), "\"\\u0000\\u001f\x7f\"");
+
+    //
+    // Special characters past the first sixteen bytes are found by the vectorized scan.
+    //
+    const std::string plain_prefix(37u, 'x');
+    EXPECT_EQ(
+        to_json_string(plain_prefix + "\"" + plain_prefix),
+        "\"" + plain_prefix + "\\\"" + plain_prefix + "\"");
+}
+
+TEST(
+    response_utilities_unit_tests,
+    keeps_valid_utf8_sequences)
+{
+    const std::string_view value = "h\xc3\xa9llo \xe2\x82\xac \xf0\x9f\x98\x80 0123456789abcdef";
+    EXPECT_EQ(to_json_string(value), "\"" + std::string{value} + "\"");
+}
+
+TEST(
+    response_utilities_unit_tests,
+    rejects_invalid_utf8_sequences)
+{
+    //
+    // Stray bytes, truncated sequences, overlong encodings and surrogates are never
+    // replaced; the value is rejected and the buffer is left as it was.
+    //
+    for (const std::string_view value : {
+        std::string_view{"a\xff" "b"},
+        std::string_view{"\xe2\x82" "a"},
+        std::string_view{"\xe2\x82"},
+        std::string_view{"\xc0\xaf"},
+        std::string_view{"\xed\xa0\x80"},
+        std::string_view{"0123456789abcdef0123456789abcde\x80"}})
+    {
+        std::string buffer = "prefix";
+        EXPECT_FALSE(common::response_utilities::append_json_string(buffer, value));
+        EXPECT_EQ(buffer, "prefix");
+        EXPECT_FALSE(common::response_utilities::is_json_representable(value));
+    }
+
+    EXPECT_TRUE(common::response_utilities::is_json_representable(""));
+    EXPECT_TRUE(common::response_utilities::is_json_representable("a\"\n\x01 h\xc3\xa9llo \xf0\x9f\x98\x80"));
+}
+
+TEST(
+    response_utilities_unit_tests,
+    server_json_response_rejects_invalid_utf8)
+{
+    //
+    // Values stored over the binary transport may be served over the JSON transport.
+    // They fail the response entry instead of being returned altered.
+    //
+    std::string buffer = "[";
+    EXPECT_FALSE(common::response_utilities::append_server_json_response(
+        buffer,
+        status::success,
+        {{"object_id", "Object"}, {"object_data", "a\xff" "b"}}));
+    EXPECT_EQ(buffer, "[");
+
+    EXPECT_EQ(
+        common::response_utilities::generate_server_json_response(
+            status::success,
+            {{"object_data", "a\xff" "b"}}),
+        "{\"internal_status_code\":\"0x80000033\"}");
+}
+
+} // namespace tests.
+} // namespace pandora.
@@ -0,0 +1,203 @@
+// ****************************************************
+// Copyright (c) 2025-Present Juan Carlos Juarez Garcia
+// Licensed under the Business Source License 1.1
+// See the LICENSE file in the
+// project root for license terms.
+// ****************************************************
+// PandoraDB
+// Tests
+// 'work_stealing_thread_pool_unit_tests.cc'
+// Author: jcjuarez
+// Description:
+//      Unit tests for the work stealing thread pool.
+// ****************************************************
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <gtest/gtest.h>
+#include "core/common/work_stealing_thread_pool.hh"
+
+namespace pandora
+{
+namespace tests
+{
+
+//
+// Maximum time to wait for the posted tasks to be executed.
+//
+constexpr std::chrono::seconds k_task_timeout{10u};
+
+TEST(
+    work_stealing_thread_pool_unit_tests,
+    every_posted_task_executes)
+{
+    constexpr std::uint32_t k_number_producers = 4u;
+    constexpr std::uint32_t k_number_tasks_per_producer = 10'000u;
+    std::atomic<std::uint32_t> number_executed_tasks{0u};
+
+    {
+        common::work_stealing_thread_pool thread_pool{4u, "pandora_test"};
+        std::vector<std::jthread> producers;
+
+        for (std::uint32_t producer_index = 0u; producer_index < k_number_producers; ++producer_index)
+        {
+            producers.emplace_back(
+                [&thread_pool, &number_executed_tasks, producer_index]()
+                {
+                    for (std::uint32_t task_index = 0u; task_index < k_number_tasks_per_producer; ++task_index)
+                    {
+                        EXPECT_TRUE(thread_pool.post(
+                            [&number_executed_tasks]()
+                            {
+                                number_executed_tasks.fetch_add(1u);
+                            },
+                            producer_index * k_number_tasks_per_producer + task_index));
+                    }
+                });
+        }
+
+        producers.clear();
+        thread_pool.join();
+    }
+
+    EXPECT_EQ(number_executed_tasks.load(), k_number_producers * k_number_tasks_per_producer);
+}
+
+TEST(
+    work_stealing_thread_pool_unit_tests,
+    idle_workers_steal_from_blocked_worker_queue)
+{
+    constexpr std::uint32_t k_number_tasks = 100u;
+    common::work_stealing_thread_pool thread_pool{2u, "pandora_test"};
+    std::promise<void> blocking_task_started;
+    std::promise<void> blocking_task_released;
+    std::shared_future<void> blocking_task_released_future = blocking_task_released.get_future().share();
+
+    //
+    // Every task lands on the same worker queue, and the first one blocks the
+    // worker running it, so the rest can only be executed by the idle worker.
+    //
+    thread_pool.post(
+        [&blocking_task_started, blocking_task_released_future]()
+        {
+            blocking_task_started.set_value();
+            blocking_task_released_future.wait();
+        },
+        0u);
+
+    ASSERT_EQ(blocking_task_started.get_future().wait_for(k_task_timeout), std::future_status::ready);
+
+    std::atomic<std::uint32_t> number_executed_tasks{0u};
+    std::promise<void> tasks_executed;
+
+    for (std::uint32_t task_index = 0u; task_index < k_number_tasks; ++task_index)
+    {
+        thread_pool.post(
+            [&number_executed_tasks, &tasks_executed]()
+            {
+                if (number_executed_tasks.fetch_add(1u) + 1u == k_number_tasks)
+                {
+                    tasks_executed.set_value();
+                }
+            },
+            0u);
+    }
+
+    EXPECT_EQ(tasks_executed.get_future().wait_for(k_task_timeout), std::future_status::ready);
+    blocking_task_released.set_value();
+    thread_pool.join();
+
+    EXPECT_EQ(number_executed_tasks.load(), k_number_tasks);
+}
+
+TEST(
+    work_stealing_thread_pool_unit_tests,
+    join_drains_pending_tasks)
+{
+    constexpr std::uint32_t k_number_tasks = 100u;
+    constexpr std::uint32_t k_number_reposts = 10u;
+    common::work_stealing_thread_pool thread_pool{1u, "pandora_test"};
+    std::atomic<std::uint32_t> number_executed_tasks{0u};
+    std::atomic<std::uint32_t> number_executed_reposts{0u};
+
+    //
+    // The first task holds the only worker, so every other task is still pending on join.
+    //
+    thread_pool.post(
+        []()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50u));
+        },
+        0u);
+
+    for (std::uint32_t task_index = 0u; task_index < k_number_tasks; ++task_index)
+    {
+        thread_pool.post(
+            [&number_executed_tasks]()
+            {
+                number_executed_tasks.fetch_add(1u);
+            },
+            task_index);
+    }
+
+    //
+    // Tasks which post a follow-up task while the thread pool is joining,
+    // as the read IO drains do, get their follow-ups executed as well.
+    //
+    std::function<void()> repost_task;
+    repost_task = [&thread_pool, &number_executed_reposts, &repost_task]()
+    {
+        if (number_executed_reposts.fetch_add(1u) + 1u < k_number_reposts)
+        {
+            EXPECT_TRUE(thread_pool.post(
+                [&repost_task]()
+                {
+                    repost_task();
+                },
+                0u));
+        }
+    };
+
+    thread_pool.post(
+        [&repost_task]()
+        {
+            repost_task();
+        },
+        0u);
+
+    thread_pool.join();
+
+    EXPECT_EQ(number_executed_tasks.load(), k_number_tasks);
+    EXPECT_EQ(number_executed_reposts.load(), k_number_reposts);
+}
+
+TEST(
+    work_stealing_thread_pool_unit_tests,
+    post_after_join_is_rejected)
+{
+    common::work_stealing_thread_pool thread_pool{2u, "pandora_test"};
+    thread_pool.join();
+
+    bool is_task_executed = false;
+
+    EXPECT_FALSE(thread_pool.post(
+        [&is_task_executed]()
+        {
+            is_task_executed = true;
+        },
+        0u));
+
+    //
+    // Joining again, as the destructor does, must not execute the rejected task either.
+    //
+    thread_pool.join();
+
+    EXPECT_FALSE(is_task_executed);
+}
+
+} // namespace tests.
+} // namespace pandora.